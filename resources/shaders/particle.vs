@@ -6,12 +6,17 @@ layout(location = 0) in vec4 vertex;
 out vec2 TexCoords;
 out vec4 ParticleColor;
 
-uniform mat4 projection;
+// sprite, particle, text 쉐이더가 공유하는 카메라 uniform block (GameRenderer 가 매 프레임 갱신, CameraUniforms 참고)
+layout(std140) uniform Camera {
+  mat4 projection; // screen space 좌표를 NDC 로 변환하는 orthogonal 투영행렬
+  mat4 view;       // world 좌표를 screen space 로 변환하는 카메라 view 행렬
+};
+
 uniform vec2 offset;
 uniform vec4 color;
 
 void main() {
-  // 각 particle quad 의 scale 을 10배 늘림
+  // 각 particle quad 의 scale 을 10배 늘림 (ParticleGenerator 의 view culling 이 같은 크기를 사용하므로 PARTICLE_SIZE 와 함께 변경)
   float scale = 10.0;
 
   // uv 및 color 데이터를 프래그먼트 쉐이더로 출력하여 보간
@@ -19,5 +24,6 @@ void main() {
   ParticleColor = color;
 
   // scale 및 offset 값으로 particle quad 정점 변환 -> 모델 행렬로 처리하는 변환을 대체
-  gl_Position = projection * vec4((vertex.xy * scale) + offset, 0.0, 1.0);
+  // particle 위치(offset)는 world 좌표이므로 view 행렬까지 적용
+  gl_Position = projection * view * vec4((vertex.xy * scale) + offset, 0.0, 1.0);
 }
@@ -0,0 +1,11 @@
+#version 330 core
+
+in vec4 QuadColor;
+
+// 최종 색상 출력 변수 선언
+out vec4 color;
+
+void main() {
+  // 텍스쳐 없이 보간된 정점 색상을 그대로 출력
+  color = QuadColor;
+}
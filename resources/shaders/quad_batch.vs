@@ -0,0 +1,17 @@
+#version 330 core
+
+// 정점 위치(screen space)와 정점 색상을 각각 별도의 attribute 로 전달받음.
+layout(location = 0) in vec2 position;
+layout(location = 1) in vec4 color;
+
+// 정점 색상 보간 출력 변수 선언
+out vec4 QuadColor;
+
+// orthogonal 투영행렬 변수 선언
+uniform mat4 projection;
+
+void main() {
+  // 정점 위치는 screen space 기준으로 계산되어 전달되므로, 모델행렬 없이 투영행렬만 곱함.
+  gl_Position = projection * vec4(position, 0.0, 1.0);
+  QuadColor = color;
+}
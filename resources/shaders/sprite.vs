@@ -6,12 +6,17 @@ layout(location = 0) in vec4 vertex;
 out vec2 TexCoords;
 
 uniform mat4 model;
-uniform mat4 projection;
+
+// sprite, particle, text 쉐이더가 공유하는 카메라 uniform block (GameRenderer 가 매 프레임 갱신, CameraUniforms 참고)
+layout(std140) uniform Camera {
+  mat4 projection; // screen space 좌표를 NDC 로 변환하는 orthogonal 투영행렬
+  mat4 view;       // world 좌표를 screen space 로 변환하는 카메라 view 행렬
+};
 
 void main() {
   // uv 좌표값을 프래그먼트 쉐이더로 출력하여 보간
   TexCoords = vertex.zw;
 
-  // Breakout 은 single-scene 게임으로, 카메라 이동이 없음. -> view 행렬 변환 과정 생략 가능!
-  gl_Position = projection * model * vec4(vertex.xy, 0.0, 1.0);
+  // 카메라가 레벨을 따라 세로로 이동하므로 model -> view -> projection 순서로 변환
+  gl_Position = projection * view * model * vec4(vertex.xy, 0.0, 1.0);
 }
@@ -7,11 +7,14 @@ layout(location = 0) in vec4 vertex;
 // uv 보간 출력 변수 선언
 out vec2 TexCoords;
 
-// orthogonal 투영행렬 변수 선언
-uniform mat4 projection;
+// sprite, particle, text 쉐이더가 공유하는 카메라 uniform block (GameRenderer 가 매 프레임 갱신, CameraUniforms 참고)
+layout(std140) uniform Camera {
+  mat4 projection; // screen space 좌표를 NDC 로 변환하는 orthogonal 투영행렬
+  mat4 view;       // world 좌표를 screen space 로 변환하는 카메라 view 행렬
+};
 
 void main() {
-  // text rendering 시 카메라를 사용하지 않으므로 정점 pos 에 투영행렬을 바로 곱해서 변환함.
+  // text 는 HUD 로 카메라를 따라 움직이지 않으므로, view 행렬 없이 정점 pos 에 투영행렬을 바로 곱해서 변환함.
   // 이때, 정점 pos(= vertex.xy) 는 screen space 기준으로 정의된 좌표값이며, orthogonal 투영행렬은 screen space 좌표값을 그대로 사용 가능하도록 계산된 상태임.
   gl_Position = projection * vec4(vertex.xy, 0.0, 1.0);
   TexCoords = vertex.zw;
@@ -0,0 +1,50 @@
+#include "irrklang_audio.hpp"
+
+#include <iostream>
+
+IrrklangAudio::IrrklangAudio() : engine(irrklang::createIrrKlangDevice())
+{
+  if (this->engine == nullptr)
+  {
+    std::cout << "WARNING::AUDIO: Failed to create irrKlang sound device, playing without sound" << std::endl;
+    return;
+  }
+
+  // irrKlang 라이브러리로 배경음 무한 재생
+  this->engine->play2D("resources/audio/breakout.mp3");
+}
+
+IrrklangAudio::~IrrklangAudio()
+{
+  if (this->engine != nullptr)
+  {
+    this->engine->drop();
+  }
+}
+
+void IrrklangAudio::Play(GameSound sound)
+{
+  if (this->engine == nullptr)
+  {
+    return;
+  }
+
+  // 효과음 종류에 대응되는 오디오 파일 재생
+  switch (sound)
+  {
+  case SOUND_BRICK:
+    this->engine->play2D("resources/audio/bleep.mp3", false);
+    break;
+  case SOUND_SOLID:
+    this->engine->play2D("resources/audio/solid.wav", false);
+    break;
+  case SOUND_POWERUP:
+    this->engine->play2D("resources/audio/powerup.wav", false);
+    break;
+  case SOUND_PADDLE:
+    this->engine->play2D("resources/audio/bleep.wav", false);
+    break;
+  default:
+    break;
+  }
+}
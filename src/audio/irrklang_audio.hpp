@@ -0,0 +1,31 @@
+#ifndef IRRKLANG_AUDIO_HPP
+#define IRRKLANG_AUDIO_HPP
+
+#include <irrklang/irrKlang.h>
+
+#include "../game/game_audio.hpp"
+
+/**
+ * IrrklangAudio 클래스
+ *
+ * irrKlang 라이브러리로 배경음 및 효과음을 재생하는 GameAudio 구현 클래스
+ * -> 생성 시점에 사운드 장치를 생성하고 배경음을 재생하며, 소멸 시점에 사운드 장치를 반납함.
+ * -> 사운드 장치 생성에 실패한 경우(오디오 장치가 없는 환경 등) 경고만 출력하고 아무것도 재생하지 않음.
+ */
+class IrrklangAudio : public GameAudio
+{
+public:
+  IrrklangAudio();
+  ~IrrklangAudio();
+
+  void Play(GameSound sound);
+
+private:
+  irrklang::ISoundEngine *engine;
+
+  // 복사 시 사운드 장치가 중복 반납되지 않도록 복사 금지
+  IrrklangAudio(const IrrklangAudio &);
+  IrrklangAudio &operator=(const IrrklangAudio &);
+};
+
+#endif /* IRRKLANG_AUDIO_HPP */
@@ -0,0 +1,645 @@
+#include "benchmark.hpp"
+#include "../physics/collision.hpp"
+#include "brick_kernel.hpp"
+#include "../game/game.hpp"
+#include "../level/game_level.hpp"
+#include "../level/level_file.hpp"
+#include "../particle/particle_generator.hpp"
+#include "../profiler/cpu_profiler.hpp"
+#include "../env/batch_env.hpp"
+#include "../utils/random.hpp"
+#include "../utils/worker_pool.hpp"
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <random>
+#include <vector>
+#include <memory>
+#include <cmath>
+#include <cstdio>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+
+/**
+ * breakout_bench
+ *
+ * 충돌 검사, particle 업데이트, 레벨 파싱, batch 환경 step, multi-ball tick 등 게임 로직의 hot path 를 GL 컨텍스트 없이 측정하는 micro benchmark 실행 파일.
+ * -> 입력 데이터는 고정된 seed 로 생성하므로 실행할 때마다 같은 workload 를 측정함.
+ * -> 결과는 JSON(기본값) 또는 CSV 로 출력하여 최적화 전후 결과를 baseline 과 비교할 수 있도록 함.
+ *
+ * 사용법: breakout_bench [--format json|csv] [--out FILE] [--filter TEXT] [--samples N] [--min-time-ms MS] [--profile-zones]
+ */
+
+// 벤치마크 입력 데이터 생성용 seed
+const unsigned int BENCH_SEED = 20240601u;
+
+// 게임 화면 해상도 및 레벨 영역 크기 (Game::Init() 과 동일하게 화면 너비 x 화면 높이 절반, ball 반지름은 game.hpp 의 BALL_RADIUS 사용)
+const unsigned int LEVEL_WIDTH = 800;
+const unsigned int LEVEL_HEIGHT = 300;
+
+// 미리 생성해 두고 순환하며 사용하는 입력 데이터 개수 (2의 거듭제곱 -> index 계산을 비트 연산으로 처리)
+const std::size_t INPUT_COUNT = 1024;
+
+// 벤치마크 실행 중 생성한 임시 레벨 파일 경로 (종료 시 삭제)
+std::vector<std::string> TemporaryFiles;
+
+// columns x rows 크기의 .lvl 파일 생성 (solidRatio, emptyRatio 비율로 solid brick, 빈 칸을 섞고 나머지는 2 ~ 5 tile code)
+static std::string writeLevelFile(const std::string &name, unsigned int columns, unsigned int rows, float solidRatio, float emptyRatio)
+{
+  std::mt19937 rng(BENCH_SEED);
+  std::uniform_real_distribution<float> chance(0.0f, 1.0f);
+  std::uniform_int_distribution<unsigned int> color(2, 5);
+
+  std::string path = "breakout_bench_" + name + ".lvl";
+  std::ofstream file(path.c_str());
+  for (unsigned int y = 0; y < rows; y++)
+  {
+    for (unsigned int x = 0; x < columns; x++)
+    {
+      float roll = chance(rng);
+      unsigned int tile = roll < emptyRatio ? 0 : roll < emptyRatio + solidRatio ? 1 : color(rng);
+      file << tile << (x + 1 < columns ? " " : "");
+    }
+    file << "\n";
+  }
+  TemporaryFiles.push_back(path);
+  return path;
+}
+
+// 레벨 파일 하나만 나열한 manifest 파일 생성 (Game::Init() 으로 생성한 레벨을 로드하기 위한 용도)
+static std::string writeManifestFile(const std::string &name, const std::string &levelPath)
+{
+  std::string path = "breakout_bench_" + name + ".txt";
+  std::ofstream file(path.c_str());
+  file << levelPath << "\n";
+  TemporaryFiles.push_back(path);
+  return path;
+}
+
+// 게임 레벨 manifest 를 현재 작업 디렉토리에서 찾을 수 있는지 확인
+// -> Game::Init() 은 실패 원인을 표준 출력으로 출력하므로, JSON / CSV 결과에 섞이지 않도록 미리 확인하고 건너뜀
+static bool levelsAvailable()
+{
+  std::ifstream manifest(LEVEL_MANIFEST);
+  return static_cast<bool>(manifest);
+}
+
+// 벤치마크 실행 중 생성한 임시 레벨 파일 삭제
+static void removeTemporaryFiles()
+{
+  for (const std::string &path : TemporaryFiles)
+  {
+    std::remove(path.c_str());
+  }
+  TemporaryFiles.clear();
+}
+
+// 벤치마크용 ball (Game 의 ball entity 와 같은 Transform, Velocity, Collider 값만 가짐)
+struct BenchBall
+{
+  TransformComponent Transform;
+  glm::vec2 Velocity;
+  float Radius;
+
+  BenchBall(glm::vec2 position, float radius, glm::vec2 velocity)
+      : Transform(position, glm::vec2(radius * 2.0f)), Velocity(velocity), Radius(radius) {};
+
+  glm::vec2 Center() const { return this->Transform.Position + this->Radius; };
+};
+
+// scalar checkCollision() 으로 모든 활성 brick 을 검사해서 충돌한 brick 을 index 순서대로 out 에 추가 (CollideCircleBricks() 비교 기준)
+static void collideCircleBricksScalar(const BenchBall &ball, const GameLevel &level, std::vector<BrickContact> &out)
+{
+  for (unsigned int i = 0; i < level.CellCount(); i++)
+  {
+    if (!level.IsAlive(i))
+    {
+      continue;
+    }
+    Collision collision = checkCollision(ball.Center(), ball.Radius, TransformComponent(level.BrickPosition(i), level.BrickSize()));
+    if (std::get<0>(collision))
+    {
+      BrickContact contact;
+      contact.Index = i;
+      contact.Dir = std::get<1>(collision);
+      contact.Difference = std::get<2>(collision);
+      out.push_back(contact);
+    }
+  }
+}
+
+/**
+ * SIMD Circle - Brick 충돌 검사 kernel 검증
+ *
+ * brick 경계, 모서리, 내부에 걸친 ball 위치들에 대해 CollideCircleBricks() 결과가 scalar checkCollision() 결과와
+ * (충돌한 brick, 충돌 방향, 거리 벡터의 bit 패턴까지) 완전히 같은지 확인함. -> 다르면 벤치마크를 실행하지 않고 종료!
+ */
+static bool verifyBrickKernel()
+{
+  GameLevel level;
+  level.Load(writeLevelFile("kernel", 37, 15, 0.1f, 0.2f).c_str(), LEVEL_WIDTH, LEVEL_HEIGHT);
+
+  // 일부 brick 은 파괴된 상태로 시작 (비활성 lane 처리 검증, 빈 칸이나 solid brick 을 고르면 아무것도 하지 않음)
+  std::mt19937 rng(BENCH_SEED);
+  std::uniform_int_distribution<unsigned int> pick(0, level.CellCount() - 1);
+  for (unsigned int i = 0; i < level.CellCount() / 10; i++)
+  {
+    level.HitBrick(pick(rng));
+  }
+  BrickBounds bounds;
+  bounds.Build(level);
+
+  // 임의의 위치 + brick 모서리 / 꼭짓점 / 중점 부근 위치 (경계값에서 비교 연산 차이가 드러나도록)
+  std::uniform_real_distribution<float> px(-BALL_RADIUS, LEVEL_WIDTH + BALL_RADIUS);
+  std::uniform_real_distribution<float> py(-BALL_RADIUS, LEVEL_HEIGHT + BALL_RADIUS);
+  std::uniform_real_distribution<float> jitter(-BALL_RADIUS * 1.5f, BALL_RADIUS * 1.5f);
+  std::vector<glm::vec2> centers;
+  for (unsigned int i = 0; i < 20000; i++)
+  {
+    centers.push_back(glm::vec2(px(rng), py(rng)));
+    unsigned int brick = pick(rng);
+    glm::vec2 corner = level.BrickPosition(brick) + level.BrickSize() * glm::vec2(static_cast<float>(i & 1), static_cast<float>((i >> 1) & 1));
+    centers.push_back(corner + glm::vec2(jitter(rng), jitter(rng)));
+    centers.push_back(corner + glm::vec2(static_cast<float>((i >> 2) & 1) * BALL_RADIUS, static_cast<float>((i >> 3) & 1) * BALL_RADIUS));
+    centers.push_back(level.BrickPosition(brick) + level.BrickSize() / 2.0f);
+  }
+
+  BenchBall ball(glm::vec2(0.0f), BALL_RADIUS, glm::vec2(0.0f));
+  std::vector<BrickContact> expected, actual;
+  unsigned int mismatches = 0, contacts = 0;
+  for (const glm::vec2 &center : centers)
+  {
+    ball.Transform.Position = center - glm::vec2(ball.Radius);
+    expected.clear();
+    actual.clear();
+    collideCircleBricksScalar(ball, level, expected);
+    CollideCircleBricks(bounds, ball.Center(), ball.Radius, actual);
+
+    bool same = expected.size() == actual.size();
+    for (std::size_t i = 0; same && i < expected.size(); i++)
+    {
+      same = expected[i].Index == actual[i].Index && expected[i].Dir == actual[i].Dir &&
+             std::memcmp(&expected[i].Difference, &actual[i].Difference, sizeof(glm::vec2)) == 0;
+    }
+    if (!same && mismatches++ < 5)
+    {
+      std::cerr << "ERROR::BENCH: Brick kernel (" << BrickKernelName() << ") differs from checkCollision() at ("
+                << center.x << ", " << center.y << "): " << actual.size() << " contacts, expected " << expected.size() << std::endl;
+    }
+    contacts += static_cast<unsigned int>(expected.size());
+  }
+
+  std::cerr << "brick kernel (" << BrickKernelName() << "): " << centers.size() << " positions, " << contacts << " contacts, "
+            << mismatches << " mismatches" << std::endl;
+  return mismatches == 0;
+}
+
+static void addCollisionBenchmarks(BenchmarkRunner &runner)
+{
+  std::mt19937 rng(BENCH_SEED);
+  std::uniform_real_distribution<float> x(0.0f, 100.0f);
+  std::uniform_real_distribution<float> size(10.0f, 60.0f);
+
+  /**
+   * 충돌 / 비충돌 케이스가 섞이도록 좁은 영역 안에 임의의 ball, brick 쌍을 생성
+   * -> 한 가지 결과만 반복되면 분기 예측이 완벽하게 맞아서 실제 게임보다 빠르게 측정되므로!
+   */
+  std::shared_ptr<std::vector<BenchBall>> balls(new std::vector<BenchBall>());
+  std::shared_ptr<std::vector<TransformComponent>> boxes(new std::vector<TransformComponent>());
+  for (std::size_t i = 0; i < INPUT_COUNT; i++)
+  {
+    balls->push_back(BenchBall(glm::vec2(x(rng), x(rng)), BALL_RADIUS, glm::vec2(0.0f)));
+    boxes->push_back(TransformComponent(glm::vec2(x(rng), x(rng)), glm::vec2(size(rng), size(rng))));
+  }
+
+  runner.Add("collision/circle_aabb", "pairs=1024", 1,
+             [balls, boxes](std::size_t iterations)
+             {
+               for (std::size_t i = 0; i < iterations; i++)
+               {
+                 std::size_t index = i & (INPUT_COUNT - 1);
+                 const BenchBall &ball = (*balls)[index];
+                 DoNotOptimize(checkCollision(ball.Center(), ball.Radius, (*boxes)[index]));
+               }
+             });
+
+  runner.Add("collision/aabb_aabb", "pairs=1024", 1,
+             [balls, boxes](std::size_t iterations)
+             {
+               for (std::size_t i = 0; i < iterations; i++)
+               {
+                 std::size_t index = i & (INPUT_COUNT - 1);
+                 DoNotOptimize(checkCollision((*balls)[index].Transform, (*boxes)[index]));
+               }
+             });
+
+  // 위와 같은 ball, brick 쌍에 대해 한 tick 이동거리 범위의 임의의 이동 벡터로 swept 충돌 검사 (brick 을 지나치는 경로 포함)
+  std::uniform_real_distribution<float> step(-60.0f, 60.0f);
+  std::shared_ptr<std::vector<glm::vec2>> motions(new std::vector<glm::vec2>());
+  for (std::size_t i = 0; i < INPUT_COUNT; i++)
+  {
+    motions->push_back(glm::vec2(step(rng), step(rng)));
+  }
+
+  runner.Add("collision/sweep_circle_aabb", "pairs=1024", 1,
+             [balls, boxes, motions](std::size_t iterations)
+             {
+               for (std::size_t i = 0; i < iterations; i++)
+               {
+                 std::size_t index = i & (INPUT_COUNT - 1);
+                 const BenchBall &ball = (*balls)[index];
+                 const TransformComponent &box = (*boxes)[index];
+                 DoNotOptimize(SweepCircleAABB(ball.Center(), ball.Radius, (*motions)[index], box.Position, box.Position + box.Size));
+               }
+             });
+
+  // 실제 충돌 시 전달되는 값처럼 길이가 ball 반지름 이하인 임의의 방향 벡터 생성
+  std::uniform_real_distribution<float> component(-BALL_RADIUS, BALL_RADIUS);
+  std::shared_ptr<std::vector<glm::vec2>> targets(new std::vector<glm::vec2>());
+  while (targets->size() < INPUT_COUNT)
+  {
+    glm::vec2 target(component(rng), component(rng));
+    if (target.x != 0.0f || target.y != 0.0f)
+    {
+      targets->push_back(target);
+    }
+  }
+
+  runner.Add("collision/vector_direction", "vectors=1024", 1,
+             [targets](std::size_t iterations)
+             {
+               for (std::size_t i = 0; i < iterations; i++)
+               {
+                 DoNotOptimize(VectorDirection((*targets)[i & (INPUT_COUNT - 1)]));
+               }
+             });
+}
+
+static void addDoCollisionsBenchmarks(BenchmarkRunner &runner)
+{
+  const unsigned int brickCounts[] = {100, 1000, 10000, 100000};
+  for (unsigned int count : brickCounts)
+  {
+    // 레벨 영역 비율(8:3)에 가깝도록 행, 열 개수 결정 (빈 칸 없이 10% 는 solid brick)
+    unsigned int columns = static_cast<unsigned int>(std::sqrt(count * 8.0f / 3.0f) + 0.5f);
+    unsigned int rows = (count + columns - 1) / columns;
+    std::string name = "collisions_" + std::to_string(count);
+    std::string levelPath = writeLevelFile(name, columns, rows, 0.1f, 0.0f);
+
+    // 생성한 레벨 하나만 나열한 manifest 로 실제 Game 을 초기화 (레벨 영역은 화면 너비 x 화면 높이 절반)
+    std::shared_ptr<Game> game(new Game(LEVEL_WIDTH, LEVEL_HEIGHT * 2));
+    game->Init(writeManifestFile(name, levelPath).c_str());
+    game->Seed(BENCH_SEED);
+    game->State = GAME_ACTIVE;
+    const GameLevel &level = game->Levels[0];
+
+    // 화면 전체에서 ball 위치를 임의로 생성 -> 레벨 영역(화면 위쪽 절반) 안팎의 프레임이 절반씩 섞임
+    std::mt19937 rng(BENCH_SEED);
+    std::uniform_real_distribution<float> px(0.0f, LEVEL_WIDTH - BALL_RADIUS * 2.0f);
+    std::uniform_real_distribution<float> py(0.0f, LEVEL_HEIGHT * 2.0f - BALL_RADIUS * 2.0f);
+    std::shared_ptr<std::vector<glm::vec2>> positions(new std::vector<glm::vec2>());
+    for (std::size_t i = 0; i < INPUT_COUNT; i++)
+    {
+      positions->push_back(glm::vec2(px(rng), py(rng)));
+    }
+    std::size_t brickCount = level.BrickCount();
+
+    std::ostringstream param;
+    param << "bricks=" << brickCount;
+
+    // 매 iteration 마다 Ball 을 임의의 위치에 놓고 Game::DoCollisions() 로 한 tick 이동 (grid broadphase + swept 충돌 검사 + 접촉 반영)
+    runner.Add(
+        "collision/do_collisions", param.str(), brickCount,
+        [game, positions](std::size_t iterations)
+        {
+          EntityRegistry &entities = game->Entities;
+          for (std::size_t i = 0; i < iterations; i++)
+          {
+            entities.Transforms.Get(game->Ball).Position = (*positions)[i & (INPUT_COUNT - 1)];
+            entities.Velocities.Get(game->Ball) = INITIAL_BALL_VELOCITY;
+            entities.Tags.Get(game->Ball).Flags = 0;
+            game->DoCollisions(1.0f / 60.0f);
+          }
+          DoNotOptimize(entities.Velocities.Get(game->Ball));
+        },
+        // sample 마다 파괴된 brick 및 생성된 powerup 을 레벨 로드 직후 상태로 복원
+        [game]()
+        { game->ResetLevel(); });
+
+    // 같은 ball 위치들에 대해 충돌 검사만 수행 (충돌 처리 없음) -> scalar checkCollision() 과 SoA SIMD kernel 비교
+    std::shared_ptr<GameLevel> bricks(new GameLevel(level));
+    std::shared_ptr<BenchBall> probe(new BenchBall(glm::vec2(0.0f), BALL_RADIUS, glm::vec2(0.0f)));
+    std::shared_ptr<std::vector<BrickContact>> contacts(new std::vector<BrickContact>());
+    runner.Add("collision/circle_bricks", param.str(), brickCount,
+               [probe, bricks, positions, contacts](std::size_t iterations)
+               {
+                 for (std::size_t i = 0; i < iterations; i++)
+                 {
+                   probe->Transform.Position = (*positions)[i & (INPUT_COUNT - 1)];
+                   contacts->clear();
+                   collideCircleBricksScalar(*probe, *bricks, *contacts);
+                 }
+                 DoNotOptimize(contacts->size());
+               });
+
+    std::shared_ptr<BrickBounds> bounds(new BrickBounds());
+    bounds->Build(level);
+    runner.Add("collision/circle_bricks_simd", param.str() + " kernel=" + BrickKernelName(), brickCount,
+               [probe, bounds, positions, contacts](std::size_t iterations)
+               {
+                 for (std::size_t i = 0; i < iterations; i++)
+                 {
+                   probe->Transform.Position = (*positions)[i & (INPUT_COUNT - 1)];
+                   contacts->clear();
+                   CollideCircleBricks(*bounds, probe->Center(), probe->Radius, *contacts);
+                 }
+                 DoNotOptimize(contacts->size());
+               });
+  }
+}
+
+static void addParticleBenchmarks(BenchmarkRunner &runner)
+{
+  const unsigned int poolSizes[] = {500, 5000, 50000};
+  for (unsigned int amount : poolSizes)
+  {
+    std::shared_ptr<ParticleGenerator> particles(new ParticleGenerator(amount));
+    std::shared_ptr<BenchBall> ball(new BenchBall(glm::vec2(400.0f, 300.0f), BALL_RADIUS, glm::vec2(100.0f, -350.0f)));
+
+    // Game::Update() 와 동일하게 프레임 당 2 개씩 respawn (수명 1초 동안 살아있는 particle 은 최대 120 개)
+    runner.Add("particles/update", "pool=" + std::to_string(amount), amount,
+               [particles, ball](std::size_t iterations)
+               {
+                 for (std::size_t i = 0; i < iterations; i++)
+                 {
+                   particles->Update(1.0f / 60.0f, ball->Transform.Position, ball->Velocity, 2, glm::vec2(BALL_RADIUS / 2.0f));
+                 }
+               });
+  }
+}
+
+static void addRandomBenchmarks(BenchmarkRunner &runner)
+{
+  // PowerUp 생성 확률 계산 (brick 하나 파괴 시 6 번 호출)
+  std::shared_ptr<Random> rng(new Random(BENCH_SEED, RANDOM_STREAM_GAMEPLAY));
+  runner.Add("random/one_in", "chance=75", 1,
+             [rng](std::size_t iterations)
+             {
+               unsigned int hits = 0;
+               for (std::size_t i = 0; i < iterations; i++)
+               {
+                 hits += rng->OneIn(75) ? 1 : 0;
+               }
+               DoNotOptimize(hits);
+             });
+
+  // particle respawn 용 난수 일괄 생성
+  const std::size_t FILL_COUNT = 4096;
+  std::shared_ptr<std::vector<float>> values(new std::vector<float>(FILL_COUNT));
+  runner.Add("random/fill_float", "count=" + std::to_string(FILL_COUNT), FILL_COUNT,
+             [rng, values](std::size_t iterations)
+             {
+               for (std::size_t i = 0; i < iterations; i++)
+               {
+                 rng->FillFloat(values->data(), values->size());
+               }
+               DoNotOptimize((*values)[0]);
+             });
+}
+
+static void addLevelLoadBenchmarks(BenchmarkRunner &runner)
+{
+  // 기본 레벨과 같은 크기의 레벨부터 수천만 개의 tile 을 가진 레벨까지 (빈 칸 20%, solid brick 10%)
+  struct LevelSize
+  {
+    const char *Name;
+    unsigned int Columns, Rows;
+  };
+  const LevelSize sizes[] = {{"small", 15, 8}, {"large", 256, 256}, {"huge", 1024, 1024}, {"giant", 4096, 4096}};
+
+  for (const LevelSize &size : sizes)
+  {
+    // 같은 레벨을 text(.lvl) 와 binary(.blvl) 로 각각 로드 -> binary 는 파싱 없이 tile byte 를 복사하므로 memory 대역폭에 가까워야 함
+    std::string textPath = writeLevelFile(std::string("load_") + size.Name, size.Columns, size.Rows, 0.1f, 0.2f);
+    std::string binaryPath = "breakout_bench_load_" + std::string(size.Name) + ".blvl";
+    MappedFile file;
+    LevelData data;
+    LevelError error;
+    if (!ReadLevelFile(textPath.c_str(), file, data, error) || !WriteLevelBinary(binaryPath.c_str(), data))
+    {
+      std::cerr << "ERROR::BENCH: Failed to compile " << textPath << " to " << binaryPath << std::endl;
+      continue;
+    }
+    TemporaryFiles.push_back(binaryPath);
+
+    std::ostringstream param;
+    param << size.Name << "=" << size.Columns << "x" << size.Rows;
+    const char *names[] = {"level/load", "level/load_binary"};
+    const std::string paths[] = {textPath, binaryPath};
+    for (unsigned int format = 0; format < 2; format++)
+    {
+      std::shared_ptr<GameLevel> level(new GameLevel());
+      std::string path = paths[format];
+      runner.Add(names[format], param.str(), static_cast<std::size_t>(size.Columns) * size.Rows,
+                 [level, path](std::size_t iterations)
+                 {
+                   for (std::size_t i = 0; i < iterations; i++)
+                   {
+                     level->Load(path.c_str(), LEVEL_WIDTH, LEVEL_HEIGHT);
+                   }
+                   DoNotOptimize(level->BrickCount());
+                 });
+    }
+
+    // 로드한 레벨을 처음 상태로 복원 (Game::ResetLevel() -> 파일을 다시 읽지 않고 template 을 복사하므로 memcpy 비용만 듦)
+    std::shared_ptr<GameLevel> level(new GameLevel());
+    level->Load(binaryPath.c_str(), LEVEL_WIDTH, LEVEL_HEIGHT);
+    runner.Add("level/reset", param.str(), static_cast<std::size_t>(size.Columns) * size.Rows,
+               [level](std::size_t iterations)
+               {
+                 for (std::size_t i = 0; i < iterations; i++)
+                 {
+                   level->Reset();
+                 }
+                 DoNotOptimize(level->LiveBrickCount());
+               });
+  }
+}
+
+static void addBatchEnvBenchmarks(BenchmarkRunner &runner)
+{
+  // 게임 4096 개를 1 ~ 하드웨어 스레드 개수까지 늘려가며 step 처리량 측정 (스레드 개수에 비례해서 증가해야 함)
+  const unsigned int ENV_COUNT = 4096;
+  unsigned int maxThreads = std::max(1u, std::thread::hardware_concurrency());
+  if (!levelsAvailable())
+  {
+    std::cerr << "WARNING::BENCH: Skipping env/step (" << LEVEL_MANIFEST << " not found)" << std::endl;
+    return;
+  }
+
+  for (unsigned int threads = 1; threads <= maxThreads; threads *= 2)
+  {
+    std::shared_ptr<BatchEnv> env(new BatchEnv(ENV_COUNT, threads));
+    if (!env->Reset(BENCH_SEED))
+    {
+      std::cerr << "WARNING::BENCH: Skipping env/step (failed to load levels)" << std::endl;
+      return;
+    }
+
+    // 게임마다 다른 행동이 섞이도록 미리 생성해 둔 행동 배열을 순환하며 사용
+    std::mt19937 rng(BENCH_SEED);
+    std::uniform_int_distribution<unsigned int> action(0, ENV_ACTION_COUNT - 1);
+    std::shared_ptr<std::vector<unsigned char>> actions(new std::vector<unsigned char>(ENV_COUNT * 4));
+    for (unsigned char &a : *actions)
+    {
+      a = static_cast<unsigned char>(action(rng));
+    }
+
+    runner.Add("env/step", "envs=" + std::to_string(ENV_COUNT) + " threads=" + std::to_string(threads), ENV_COUNT,
+               [env, actions](std::size_t iterations)
+               {
+                 for (std::size_t i = 0; i < iterations; i++)
+                 {
+                   env->Step(actions->data() + (i & 3) * env->Count(), 1.0f / 60.0f);
+                 }
+                 DoNotOptimize(env->Rewards()[0]);
+               });
+  }
+}
+
+static void addMultiBallBenchmarks(BenchmarkRunner &runner)
+{
+  // extra ball 10000 개를 유지하면서 1 ~ 하드웨어 스레드 개수까지 늘려가며 Game::Update() 처리량 측정 (ball 이동 및 충돌 처리가 병렬 진행됨)
+  const unsigned int BALL_COUNT = 10000;
+  unsigned int maxThreads = std::max(1u, std::thread::hardware_concurrency());
+  if (!levelsAvailable())
+  {
+    std::cerr << "WARNING::BENCH: Skipping game/multi_ball (" << LEVEL_MANIFEST << " not found)" << std::endl;
+    return;
+  }
+
+  for (unsigned int threads = 1; threads <= maxThreads; threads *= 2)
+  {
+    std::shared_ptr<WorkerPool> workers(new WorkerPool(threads));
+    std::shared_ptr<Game> game(new Game(LEVEL_WIDTH, LEVEL_HEIGHT * 2));
+    game->Init();
+    if (game->Levels.empty() || game->Levels[0].BrickCount() == 0)
+    {
+      std::cerr << "WARNING::BENCH: Skipping game/multi_ball (failed to load levels)" << std::endl;
+      return;
+    }
+    game->ReserveBalls(BALL_COUNT);
+    game->Seed(BENCH_SEED);
+    game->Workers = workers.get();
+    game->State = GAME_ACTIVE;
+
+    runner.Add("game/multi_ball", "balls=" + std::to_string(BALL_COUNT) + " threads=" + std::to_string(threads), BALL_COUNT,
+               [game, workers](std::size_t iterations)
+               {
+                 for (std::size_t i = 0; i < iterations; i++)
+                 {
+                   // 화면 밖으로 떨어진 만큼 보충 -> 매 tick 거의 같은 개수의 ball 을 처리
+                   if (game->State != GAME_ACTIVE)
+                   {
+                     game->State = GAME_ACTIVE;
+                   }
+                   if (game->BallCount() - 1 < BALL_COUNT)
+                   {
+                     game->SpawnBalls(BALL_COUNT - (game->BallCount() - 1));
+                   }
+                   game->Update(1.0f / 60.0f);
+                 }
+                 DoNotOptimize(game->BallCount());
+               });
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  /** 커맨드라인 옵션 파싱 */
+  BenchmarkOptions options;
+  std::string format = "json";
+  std::string outPath;
+  bool profileZones = false;
+  for (int i = 1; i < argc; i++)
+  {
+    if (std::strcmp(argv[i], "--format") == 0 && i + 1 < argc)
+    {
+      format = argv[++i];
+    }
+    else if (std::strcmp(argv[i], "--out") == 0 && i + 1 < argc)
+    {
+      outPath = argv[++i];
+    }
+    else if (std::strcmp(argv[i], "--filter") == 0 && i + 1 < argc)
+    {
+      options.Filter = argv[++i];
+    }
+    else if (std::strcmp(argv[i], "--samples") == 0 && i + 1 < argc)
+    {
+      options.Samples = static_cast<unsigned int>(std::max(1, std::atoi(argv[++i])));
+    }
+    else if (std::strcmp(argv[i], "--min-time-ms") == 0 && i + 1 < argc)
+    {
+      options.MinSampleMs = std::atof(argv[++i]);
+    }
+    else if (std::strcmp(argv[i], "--profile-zones") == 0)
+    {
+      // PROFILE_SCOPE 기록 비용까지 포함하여 측정 (기본값은 기록을 끄고 측정)
+      profileZones = true;
+    }
+    else
+    {
+      std::cout << "usage: breakout_bench [--format json|csv] [--out FILE] [--filter TEXT] [--samples N] [--min-time-ms MS] [--profile-zones]" << std::endl;
+      return std::strcmp(argv[i], "--help") == 0 ? 0 : 1;
+    }
+  }
+
+  if (format != "json" && format != "csv")
+  {
+    std::cout << "ERROR::BENCH: Unknown output format '" << format << "'" << std::endl;
+    return 1;
+  }
+
+  CpuProfiler::SetEnabled(profileZones);
+
+  if (!verifyBrickKernel())
+  {
+    removeTemporaryFiles();
+    return 1;
+  }
+
+  BenchmarkRunner runner(options);
+  addCollisionBenchmarks(runner);
+  addDoCollisionsBenchmarks(runner);
+  addParticleBenchmarks(runner);
+  addRandomBenchmarks(runner);
+  addLevelLoadBenchmarks(runner);
+  addBatchEnvBenchmarks(runner);
+  addMultiBallBenchmarks(runner);
+
+  // 진행 상황은 표준 에러로 출력 -> 표준 출력으로 내보낸 결과를 그대로 파일로 redirect 할 수 있도록!
+  runner.Run(std::cerr);
+
+  removeTemporaryFiles();
+
+  if (outPath.empty())
+  {
+    format == "json" ? runner.WriteJson(std::cout) : runner.WriteCsv(std::cout);
+  }
+  else
+  {
+    std::ofstream out(outPath.c_str());
+    if (!out)
+    {
+      std::cout << "ERROR::BENCH: Failed to open output file " << outPath << std::endl;
+      return 1;
+    }
+    format == "json" ? runner.WriteJson(out) : runner.WriteCsv(out);
+  }
+  return 0;
+}
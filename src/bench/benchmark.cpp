@@ -0,0 +1,162 @@
+#include "benchmark.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <algorithm>
+
+// 현재 시각 (ns)
+static double nowNs()
+{
+  return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+// JSON 문자열 이스케이프 (벤치마크 이름에는 따옴표, 역슬래시만 들어올 수 있다고 가정)
+static std::string escapeJson(const std::string &str)
+{
+  std::string escaped;
+  for (char c : str)
+  {
+    if (c == '"' || c == '\\')
+    {
+      escaped += '\\';
+    }
+    escaped += c;
+  }
+  return escaped;
+}
+
+BenchmarkRunner::BenchmarkRunner(const BenchmarkOptions &options) : options(options) {};
+
+void BenchmarkRunner::Add(const std::string &name, const std::string &param, std::size_t itemsPerIteration, BenchmarkBody body, BenchmarkSetup setup)
+{
+  if (!this->options.Filter.empty() && (name + "/" + param).find(this->options.Filter) == std::string::npos)
+  {
+    return;
+  }
+
+  Entry entry;
+  entry.Name = name;
+  entry.Param = param;
+  entry.ItemsPerIteration = itemsPerIteration;
+  entry.Body = body;
+  entry.Setup = setup;
+  this->entries.push_back(entry);
+};
+
+void BenchmarkRunner::Run(std::ostream &progress)
+{
+  this->results.clear();
+  for (const Entry &entry : this->entries)
+  {
+    BenchmarkResult result = this->measure(entry);
+    progress << std::left << std::setw(36) << result.Name << std::setw(18) << result.Param
+             << std::right << std::fixed << std::setprecision(1) << std::setw(14) << result.MedianNs << " ns/iter"
+             << std::setprecision(3) << std::setw(12) << result.NsPerItem() << " ns/item"
+             << "  (x" << result.Iterations << ", " << result.Samples << " samples)" << std::endl;
+    this->results.push_back(result);
+  }
+};
+
+BenchmarkResult BenchmarkRunner::measure(const Entry &entry)
+{
+  /**
+   * 반복 횟수 보정
+   *
+   * -> 1회부터 시작해서 측정 시간이 MinSampleMs 를 넘을 때까지 반복 횟수를 늘려가며 실행.
+   * -> 보정 과정은 cache, 분기 예측기 warm-up 역할도 겸함.
+   */
+  std::size_t iterations = 1;
+  while (true)
+  {
+    if (entry.Setup)
+    {
+      entry.Setup();
+    }
+    double start = nowNs();
+    entry.Body(iterations);
+    double elapsedMs = (nowNs() - start) / 1.0e6;
+
+    if (elapsedMs >= this->options.MinSampleMs || iterations >= this->options.MaxIterations)
+    {
+      break;
+    }
+
+    // 목표 시간에 도달하도록 반복 횟수 추정 (너무 빠르게 측정된 경우 10배씩 증가)
+    std::size_t next = elapsedMs > 0.0 ? static_cast<std::size_t>(iterations * this->options.MinSampleMs * 1.2 / elapsedMs) : iterations * 10;
+    next = std::min(std::max(next, iterations + 1), iterations * 10);
+    iterations = std::min(next, this->options.MaxIterations);
+  }
+
+  // 보정된 반복 횟수로 sample 측정
+  std::vector<double> samples;
+  samples.reserve(this->options.Samples);
+  for (unsigned int i = 0; i < this->options.Samples; i++)
+  {
+    if (entry.Setup)
+    {
+      entry.Setup();
+    }
+    double start = nowNs();
+    entry.Body(iterations);
+    samples.push_back((nowNs() - start) / iterations);
+  }
+
+  BenchmarkResult result;
+  result.Name = entry.Name;
+  result.Param = entry.Param;
+  result.Iterations = iterations;
+  result.Samples = static_cast<unsigned int>(samples.size());
+  result.ItemsPerIteration = entry.ItemsPerIteration;
+
+  std::sort(samples.begin(), samples.end());
+  double sum = 0.0;
+  for (double sample : samples)
+  {
+    sum += sample;
+  }
+  result.MeanNs = sum / samples.size();
+  result.MinNs = samples.front();
+  result.MaxNs = samples.back();
+  result.MedianNs = samples.size() % 2 == 1 ? samples[samples.size() / 2] : (samples[samples.size() / 2 - 1] + samples[samples.size() / 2]) / 2.0;
+
+  double variance = 0.0;
+  for (double sample : samples)
+  {
+    variance += (sample - result.MeanNs) * (sample - result.MeanNs);
+  }
+  result.StdDevNs = std::sqrt(variance / samples.size());
+  return result;
+};
+
+void BenchmarkRunner::WriteJson(std::ostream &out) const
+{
+  out << std::setprecision(3) << std::fixed;
+  out << "{\n  \"benchmarks\": [";
+  for (std::size_t i = 0; i < this->results.size(); i++)
+  {
+    const BenchmarkResult &result = this->results[i];
+    out << (i == 0 ? "\n" : ",\n")
+        << "    {\"name\": \"" << escapeJson(result.Name) << "\", \"param\": \"" << escapeJson(result.Param) << "\""
+        << ", \"iterations\": " << result.Iterations << ", \"samples\": " << result.Samples
+        << ", \"items_per_iteration\": " << result.ItemsPerIteration
+        << ", \"median_ns\": " << result.MedianNs << ", \"mean_ns\": " << result.MeanNs
+        << ", \"min_ns\": " << result.MinNs << ", \"max_ns\": " << result.MaxNs << ", \"stddev_ns\": " << result.StdDevNs
+        << ", \"ns_per_item\": " << result.NsPerItem() << "}";
+  }
+  out << "\n  ]\n}" << std::endl;
+  out << std::defaultfloat;
+};
+
+void BenchmarkRunner::WriteCsv(std::ostream &out) const
+{
+  out << std::setprecision(3) << std::fixed;
+  out << "name,param,iterations,samples,items_per_iteration,median_ns,mean_ns,min_ns,max_ns,stddev_ns,ns_per_item\n";
+  for (const BenchmarkResult &result : this->results)
+  {
+    out << result.Name << "," << result.Param << "," << result.Iterations << "," << result.Samples << ","
+        << result.ItemsPerIteration << "," << result.MedianNs << "," << result.MeanNs << "," << result.MinNs << ","
+        << result.MaxNs << "," << result.StdDevNs << "," << result.NsPerItem() << "\n";
+  }
+  out << std::defaultfloat << std::flush;
+};
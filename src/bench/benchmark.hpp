@@ -0,0 +1,103 @@
+#ifndef BENCHMARK_HPP
+#define BENCHMARK_HPP
+
+#include <string>
+#include <vector>
+#include <ostream>
+#include <functional>
+#include <cstddef>
+
+// 벤치마크 하나의 측정 결과 (시간 단위는 모두 iteration 당 ns)
+struct BenchmarkResult
+{
+  std::string Name;              // 벤치마크 이름 (ex> "collision/circle_aabb")
+  std::string Param;             // 입력 크기 등 파라미터 (ex> "bricks=1000")
+  std::size_t Iterations;        // sample 하나 당 반복 횟수
+  unsigned int Samples;          // 측정한 sample 개수
+  std::size_t ItemsPerIteration; // iteration 한 번에 처리하는 항목 수 (brick, particle 개수 등)
+  double MeanNs, MedianNs, MinNs, MaxNs, StdDevNs;
+
+  // 항목 하나 당 시간 (중앙값 기준)
+  double NsPerItem() const { return this->ItemsPerIteration > 0 ? this->MedianNs / this->ItemsPerIteration : this->MedianNs; };
+};
+
+// 벤치마크 측정 옵션
+struct BenchmarkOptions
+{
+  unsigned int Samples;      // 측정할 sample 개수
+  double MinSampleMs;        // sample 하나의 최소 측정 시간 -> 반복 횟수는 이 시간을 넘도록 보정됨
+  std::size_t MaxIterations; // 보정된 반복 횟수 상한
+  std::string Filter;        // 이름에 이 문자열이 포함된 벤치마크만 실행 (빈 문자열이면 전부 실행)
+
+  BenchmarkOptions() : Samples(15), MinSampleMs(20.0), MaxIterations(100000000), Filter() {};
+};
+
+/**
+ * 측정 본문 함수 타입 -> 전달받은 반복 횟수만큼 측정 대상을 실행
+ *
+ * 반복 루프를 본문 안에 두어 std::function 호출 비용이 iteration 마다 섞이지 않도록 함.
+ */
+typedef std::function<void(std::size_t iterations)> BenchmarkBody;
+
+// sample 측정 직전마다 호출되는 준비 함수 타입 (측정 시간에 포함되지 않음 -> 본문이 변경한 상태 복원 용도)
+typedef std::function<void()> BenchmarkSetup;
+
+/**
+ * BenchmarkRunner 클래스
+ *
+ * GL 컨텍스트 없이 실행되는 micro benchmark 등록 및 측정 클래스.
+ * -> 반복 횟수를 MinSampleMs 이상이 되도록 한 번 보정한 뒤, 같은 반복 횟수로 여러 sample 을 측정하여 통계를 계산함.
+ * -> 결과는 JSON 또는 CSV 로 출력하여 최적화 전후 결과를 기계적으로 비교할 수 있도록 함.
+ */
+class BenchmarkRunner
+{
+public:
+  BenchmarkRunner(const BenchmarkOptions &options);
+
+  // 벤치마크 등록 (setup 은 생략 가능)
+  void Add(const std::string &name, const std::string &param, std::size_t itemsPerIteration, BenchmarkBody body, BenchmarkSetup setup = BenchmarkSetup());
+
+  // 등록된 벤치마크를 순서대로 측정 (진행 상황은 progress 스트림에 출력)
+  void Run(std::ostream &progress);
+
+  const std::vector<BenchmarkResult> &Results() const { return this->results; };
+
+  // 측정 결과 출력
+  void WriteJson(std::ostream &out) const;
+  void WriteCsv(std::ostream &out) const;
+
+private:
+  struct Entry
+  {
+    std::string Name, Param;
+    std::size_t ItemsPerIteration;
+    BenchmarkBody Body;
+    BenchmarkSetup Setup;
+  };
+
+  BenchmarkOptions options;
+  std::vector<Entry> entries;
+  std::vector<BenchmarkResult> results;
+
+  // 반복 횟수 보정 및 sample 측정
+  BenchmarkResult measure(const Entry &entry);
+};
+
+/**
+ * 측정 대상의 계산 결과를 컴파일러가 dead code 로 제거하지 못하도록 하는 함수
+ *
+ * -> GCC/Clang 은 빈 inline asm 에 메모리 의존성을 걸어 값이 실제로 계산되도록 하고,
+ *    그 외 컴파일러는 volatile 변수에 기록하는 방식으로 대체함.
+ */
+template <typename T>
+inline void DoNotOptimize(const T &value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : "r,m"(value) : "memory");
+#else
+  static volatile const void *sink;
+  sink = &value;
+#endif
+}
+
+#endif /* BENCHMARK_HPP */
@@ -0,0 +1,230 @@
+#include "brick_kernel.hpp"
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#define BRICK_KERNEL_AVX
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define BRICK_KERNEL_SSE2
+#endif
+
+// 비활성 brick 및 padding 의 AABB 중점 -> 어떤 circle 과의 거리 제곱도 float 범위를 넘어가서(inf) 충돌로 판정되지 않음
+const float DISABLED_BRICK_CENTER = -1.0e30f;
+
+BrickBounds::BrickBounds()
+    : count(0) {};
+
+void BrickBounds::Build(const GameLevel &level)
+{
+  this->count = level.CellCount();
+  std::size_t padded = (this->count + BRICK_KERNEL_PADDING - 1) / BRICK_KERNEL_PADDING * BRICK_KERNEL_PADDING;
+  this->CenterX.assign(padded, DISABLED_BRICK_CENTER);
+  this->CenterY.assign(padded, DISABLED_BRICK_CENTER);
+  this->HalfX.assign(padded, 0.0f);
+  this->HalfY.assign(padded, 0.0f);
+
+  glm::vec2 size = level.BrickSize();
+  for (unsigned int i = 0; i < this->count; i++)
+  {
+    if (!level.IsAlive(i))
+    {
+      continue;
+    }
+    // checkCollision(center, radius, brick) 과 같은 연산 순서로 계산
+    glm::vec2 position = level.BrickPosition(i);
+    this->HalfX[i] = size.x / 2.0f;
+    this->HalfY[i] = size.y / 2.0f;
+    this->CenterX[i] = position.x + this->HalfX[i];
+    this->CenterY[i] = position.y + this->HalfY[i];
+  }
+}
+
+void BrickBounds::Disable(unsigned int index)
+{
+  this->CenterX[index] = DISABLED_BRICK_CENTER;
+  this->CenterY[index] = DISABLED_BRICK_CENTER;
+  this->HalfX[index] = 0.0f;
+  this->HalfY[index] = 0.0f;
+}
+
+#if !defined(BRICK_KERNEL_AVX) && !defined(BRICK_KERNEL_SSE2)
+/**
+ * 정규화 없이 충돌 방향 계산
+ *
+ * VectorDirection() 은 target 을 정규화한 뒤 UP, RIGHT, DOWN, LEFT 순서로 내적값(y, x, -y, -x)이 0 보다 크고 지금까지의 최대값보다 큰 방향을 고름.
+ * -> 정규화는 모든 성분에 같은 양수를 곱하는 것이므로 대소 관계가 바뀌지 않음. 따라서 정규화하지 않은 성분끼리 같은 순서로 비교해도 같은 방향이 선택됨.
+ */
+static Direction classifyContact(float x, float y)
+{
+  float max = 0.0f;
+  unsigned int best = UP;
+  if (y > max)
+  {
+    max = y;
+  }
+  if (x > max)
+  {
+    max = x;
+    best = RIGHT;
+  }
+  if (-y > max)
+  {
+    max = -y;
+    best = DOWN;
+  }
+  if (-x > max)
+  {
+    best = LEFT;
+  }
+  return static_cast<Direction>(best);
+}
+#else
+// SIMD 로 계산한 lane 들 중 충돌한 lane(mask 의 bit)만 out 에 추가
+static void appendContacts(int mask, unsigned int base, const float *dx, const float *dy, const float *dir, std::vector<BrickContact> &out)
+{
+  while (mask != 0)
+  {
+    unsigned int lane = 0;
+    while (!(mask & (1 << lane)))
+    {
+      lane++;
+    }
+    mask &= ~(1 << lane);
+
+    BrickContact contact;
+    contact.Index = base + lane;
+    contact.Dir = static_cast<Direction>(static_cast<int>(dir[lane]));
+    contact.Difference = glm::vec2(dx[lane], dy[lane]);
+    out.push_back(contact);
+  }
+}
+#endif
+
+void CollideCircleBricks(const BrickBounds &bounds, glm::vec2 center, float radius, std::vector<BrickContact> &out)
+{
+  const float radiusSquared = radius * radius;
+  const unsigned int size = static_cast<unsigned int>(bounds.CenterX.size());
+  const float *centerX = bounds.CenterX.data();
+  const float *centerY = bounds.CenterY.data();
+  const float *halfX = bounds.HalfX.data();
+  const float *halfY = bounds.HalfY.data();
+
+#if defined(BRICK_KERNEL_AVX)
+  const __m256 px = _mm256_set1_ps(center.x), py = _mm256_set1_ps(center.y);
+  const __m256 r2 = _mm256_set1_ps(radiusSquared);
+  const __m256 zero = _mm256_setzero_ps(), sign = _mm256_set1_ps(-0.0f);
+  alignas(32) float dxLanes[8], dyLanes[8], dirLanes[8];
+
+  for (unsigned int i = 0; i < size; i += 8)
+  {
+    __m256 cx = _mm256_loadu_ps(centerX + i), cy = _mm256_loadu_ps(centerY + i);
+    __m256 hx = _mm256_loadu_ps(halfX + i), hy = _mm256_loadu_ps(halfY + i);
+
+    // 가장 가까운 점 P = AABB 중점 + clamp(circle 중점 - AABB 중점, -절반 크기, 절반 크기)
+    __m256 clampedX = _mm256_min_ps(_mm256_max_ps(_mm256_sub_ps(px, cx), _mm256_xor_ps(hx, sign)), hx);
+    __m256 clampedY = _mm256_min_ps(_mm256_max_ps(_mm256_sub_ps(py, cy), _mm256_xor_ps(hy, sign)), hy);
+    __m256 dx = _mm256_sub_ps(_mm256_add_ps(cx, clampedX), px);
+    __m256 dy = _mm256_sub_ps(_mm256_add_ps(cy, clampedY), py);
+
+    // 거리 제곱 < 반지름 제곱 인 lane 만 충돌 (대부분의 묶음은 여기서 바로 다음 묶음으로 넘어감)
+    __m256 distanceSquared = _mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy));
+    int mask = _mm256_movemask_ps(_mm256_cmp_ps(distanceSquared, r2, _CMP_LT_OQ));
+    if (mask == 0)
+    {
+      continue;
+    }
+
+    // VectorDirection() 과 같은 순서(UP, RIGHT, DOWN, LEFT)로 lane 마다 최대값 갱신
+    __m256 max = _mm256_max_ps(dy, zero);
+    __m256 best = zero;
+    __m256 candidate = dx;
+    __m256 greater = _mm256_cmp_ps(candidate, max, _CMP_GT_OQ);
+    max = _mm256_blendv_ps(max, candidate, greater);
+    best = _mm256_blendv_ps(best, _mm256_set1_ps(static_cast<float>(RIGHT)), greater);
+    candidate = _mm256_xor_ps(dy, sign);
+    greater = _mm256_cmp_ps(candidate, max, _CMP_GT_OQ);
+    max = _mm256_blendv_ps(max, candidate, greater);
+    best = _mm256_blendv_ps(best, _mm256_set1_ps(static_cast<float>(DOWN)), greater);
+    candidate = _mm256_xor_ps(dx, sign);
+    greater = _mm256_cmp_ps(candidate, max, _CMP_GT_OQ);
+    best = _mm256_blendv_ps(best, _mm256_set1_ps(static_cast<float>(LEFT)), greater);
+
+    _mm256_store_ps(dxLanes, dx);
+    _mm256_store_ps(dyLanes, dy);
+    _mm256_store_ps(dirLanes, best);
+    appendContacts(mask, i, dxLanes, dyLanes, dirLanes, out);
+  }
+#elif defined(BRICK_KERNEL_SSE2)
+  const __m128 px = _mm_set1_ps(center.x), py = _mm_set1_ps(center.y);
+  const __m128 r2 = _mm_set1_ps(radiusSquared);
+  const __m128 zero = _mm_setzero_ps(), sign = _mm_set1_ps(-0.0f);
+  alignas(16) float dxLanes[4], dyLanes[4], dirLanes[4];
+
+  for (unsigned int i = 0; i < size; i += 4)
+  {
+    __m128 cx = _mm_loadu_ps(centerX + i), cy = _mm_loadu_ps(centerY + i);
+    __m128 hx = _mm_loadu_ps(halfX + i), hy = _mm_loadu_ps(halfY + i);
+
+    // 가장 가까운 점 P = AABB 중점 + clamp(circle 중점 - AABB 중점, -절반 크기, 절반 크기)
+    __m128 clampedX = _mm_min_ps(_mm_max_ps(_mm_sub_ps(px, cx), _mm_xor_ps(hx, sign)), hx);
+    __m128 clampedY = _mm_min_ps(_mm_max_ps(_mm_sub_ps(py, cy), _mm_xor_ps(hy, sign)), hy);
+    __m128 dx = _mm_sub_ps(_mm_add_ps(cx, clampedX), px);
+    __m128 dy = _mm_sub_ps(_mm_add_ps(cy, clampedY), py);
+
+    // 거리 제곱 < 반지름 제곱 인 lane 만 충돌 (대부분의 묶음은 여기서 바로 다음 묶음으로 넘어감)
+    __m128 distanceSquared = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+    int mask = _mm_movemask_ps(_mm_cmplt_ps(distanceSquared, r2));
+    if (mask == 0)
+    {
+      continue;
+    }
+
+    // VectorDirection() 과 같은 순서(UP, RIGHT, DOWN, LEFT)로 lane 마다 최대값 갱신 (SSE2 에는 blend 명령이 없으므로 and / andnot / or 로 선택)
+    __m128 max = _mm_max_ps(dy, zero);
+    __m128 best = zero;
+    __m128 candidate = dx;
+    __m128 greater = _mm_cmpgt_ps(candidate, max);
+    max = _mm_or_ps(_mm_and_ps(greater, candidate), _mm_andnot_ps(greater, max));
+    best = _mm_or_ps(_mm_and_ps(greater, _mm_set1_ps(static_cast<float>(RIGHT))), _mm_andnot_ps(greater, best));
+    candidate = _mm_xor_ps(dy, sign);
+    greater = _mm_cmpgt_ps(candidate, max);
+    max = _mm_or_ps(_mm_and_ps(greater, candidate), _mm_andnot_ps(greater, max));
+    best = _mm_or_ps(_mm_and_ps(greater, _mm_set1_ps(static_cast<float>(DOWN))), _mm_andnot_ps(greater, best));
+    candidate = _mm_xor_ps(dx, sign);
+    greater = _mm_cmpgt_ps(candidate, max);
+    best = _mm_or_ps(_mm_and_ps(greater, _mm_set1_ps(static_cast<float>(LEFT))), _mm_andnot_ps(greater, best));
+
+    _mm_store_ps(dxLanes, dx);
+    _mm_store_ps(dyLanes, dy);
+    _mm_store_ps(dirLanes, best);
+    appendContacts(mask, i, dxLanes, dyLanes, dirLanes, out);
+  }
+#else
+  for (unsigned int i = 0; i < size; i++)
+  {
+    float clampedX = glm::clamp(center.x - centerX[i], -halfX[i], halfX[i]);
+    float clampedY = glm::clamp(center.y - centerY[i], -halfY[i], halfY[i]);
+    float dx = (centerX[i] + clampedX) - center.x;
+    float dy = (centerY[i] + clampedY) - center.y;
+    if (dx * dx + dy * dy < radiusSquared)
+    {
+      BrickContact contact;
+      contact.Index = i;
+      contact.Dir = classifyContact(dx, dy);
+      contact.Difference = glm::vec2(dx, dy);
+      out.push_back(contact);
+    }
+  }
+#endif
+}
+
+const char *BrickKernelName()
+{
+#if defined(BRICK_KERNEL_AVX)
+  return "avx";
+#elif defined(BRICK_KERNEL_SSE2)
+  return "sse2";
+#else
+  return "scalar";
+#endif
+}
@@ -0,0 +1,67 @@
+#ifndef BRICK_KERNEL_HPP
+#define BRICK_KERNEL_HPP
+
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "../physics/collision.hpp"
+#include "../level/game_level.hpp"
+
+// BrickBounds 배열 길이를 맞추는 단위 (AVX 한 번에 검사하는 brick 개수) -> 배열 끝에서 남는 lane 을 따로 처리하지 않도록!
+const unsigned int BRICK_KERNEL_PADDING = 8;
+
+// Circle - Brick 충돌 결과 (checkCollision(center, radius, brick) 결과 중 충돌한 brick 의 index 와 충돌 정보)
+struct BrickContact
+{
+  unsigned int Index;   // brick index (GameLevel 의 cell index)
+  Direction Dir;        // 충돌 방향 (VectorDirection 과 같은 값)
+  glm::vec2 Difference; // circle 중점 ~ 가장 가까운 점 P 사이의 거리
+};
+
+/**
+ * BrickBounds 클래스
+ *
+ * brick AABB 의 중점과 절반 크기를 항목별 float 배열(SoA)로 보관하는 클래스.
+ * -> GameLevel 은 brick 위치를 cell index 로부터 계산하므로, SIMD register 로 한 번에 읽을 수 있도록 cell 순서대로 미리 풀어서 저장함.
+ * -> 중점과 절반 크기는 checkCollision() 과 같은 연산 순서로 미리 계산해 두므로, 충돌 검사 결과가 bit 단위로 같음.
+ *
+ * 빈 칸, 파괴된 brick 과 padding 은 어떤 circle 과도 충돌하지 않는 아주 먼 점으로 기록함.
+ */
+class BrickBounds
+{
+public:
+  std::vector<float> CenterX, CenterY; // AABB 중점
+  std::vector<float> HalfX, HalfY;     // AABB 절반 크기
+
+  BrickBounds();
+
+  // level 의 cell 마다 한 항목씩 SoA 배열 생성 (빈 칸, 파괴된 brick 은 비활성 상태로 기록)
+  void Build(const GameLevel &level);
+
+  // brick 하나를 비활성화 (brick 파괴 시 호출)
+  void Disable(unsigned int index);
+
+  // padding 을 제외한 항목 개수 (= level 의 cell 개수)
+  unsigned int Count() const { return this->count; };
+
+private:
+  unsigned int count;
+};
+
+/**
+ * Circle - Brick 충돌 검사 kernel
+ *
+ * 중점 center, 반지름 radius 인 circle 과 모든 활성 brick 을 검사해서 충돌한 brick 을 index 순서대로 out 에 추가함.
+ * -> AVX 빌드에서는 brick 8 개, SSE2 빌드에서는 4 개씩 한 번에 검사하고, 그 외에는 scalar 로 검사함.
+ * -> 거리는 제곱한 값끼리 비교하고(sqrt 생략), 충돌 방향은 정규화 없이 성분 크기 비교로 계산함.
+ *
+ * 게임은 overlap 검사가 아닌 swept 충돌 검사(SweepCircleAABB)와 grid broadphase(GameLevel::QueryBricks)를 사용하므로 이 kernel 을 호출하지 않음.
+ * -> brick 수천 개 전체를 검사하는 경우의 SIMD 처리량 비교 기준으로만 breakout_bench 에 포함됨.
+ */
+void CollideCircleBricks(const BrickBounds &bounds, glm::vec2 center, float radius, std::vector<BrickContact> &out);
+
+// 현재 빌드에서 사용하는 kernel 종류 ("avx", "sse2", "scalar")
+const char *BrickKernelName();
+
+#endif /* BRICK_KERNEL_HPP */
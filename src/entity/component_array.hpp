@@ -0,0 +1,130 @@
+#ifndef COMPONENT_ARRAY_HPP
+#define COMPONENT_ARRAY_HPP
+
+#include <vector>
+#include <cstddef>
+#include <algorithm>
+
+/**
+ * Entity ID
+ *
+ * 하위 24bit 는 entity index, 상위 8bit 는 해당 index 의 세대(generation) 번호.
+ * -> 파괴된 entity 의 index 를 재사용하더라도 세대 번호가 달라지므로, 이전 entity 를 가리키던 ID 로는 새 entity 의 component 에 접근할 수 없음.
+ */
+typedef unsigned int Entity;
+
+const unsigned int ENTITY_INDEX_BITS = 24;
+const unsigned int ENTITY_INDEX_MASK = (1u << ENTITY_INDEX_BITS) - 1;
+const Entity NULL_ENTITY = 0xFFFFFFFFu; // 어떤 entity 도 가리키지 않는 ID
+
+inline unsigned int EntityIndex(Entity entity) { return entity & ENTITY_INDEX_MASK; }
+inline unsigned int EntityGeneration(Entity entity) { return entity >> ENTITY_INDEX_BITS; }
+inline Entity MakeEntity(unsigned int index, unsigned int generation) { return (generation << ENTITY_INDEX_BITS) | index; }
+
+/**
+ * ComponentArray 클래스 템플릿
+ *
+ * 한 종류의 component 를 빈틈없이 연속된 배열(dense)에 보관하는 sparse set.
+ * -> entity index 로 dense 위치를 찾는 sparse 배열을 따로 두므로, entity 하나의 component 조회, 추가는 O(1).
+ * -> 해당 component 를 가진 entity 들을 순회할 때는 Data() ~ Data() + Size() 범위만 읽으면 되므로, 다른 component 는 cache 에 올라오지 않음.
+ *
+ * dense 배열은 component 를 추가한 순서를 유지함. (제거 시에도 남은 component 의 순서를 바꾸지 않음)
+ * -> 순회 순서가 생성 순서와 같으므로, 같은 입력이면 항상 같은 순서로 처리되어 입력 기록 재생 결과가 달라지지 않음.
+ */
+template <typename T>
+class ComponentArray
+{
+public:
+  ComponentArray() : highWater(0) {}
+
+  // entity 에 component 추가 (이미 가지고 있다면 값만 교체)
+  T &Add(Entity entity, const T &value)
+  {
+    unsigned int index = EntityIndex(entity);
+    if (index >= this->sparse.size())
+    {
+      this->sparse.resize(index + 1, INVALID);
+    }
+    if (this->Has(entity))
+    {
+      return this->dense[this->sparse[index]] = value;
+    }
+    this->sparse[index] = static_cast<unsigned int>(this->dense.size());
+    this->dense.push_back(value);
+    this->owners.push_back(entity);
+    this->highWater = std::max(this->highWater, this->dense.size());
+    return this->dense.back();
+  }
+
+  bool Has(Entity entity) const
+  {
+    unsigned int index = EntityIndex(entity);
+    return index < this->sparse.size() && this->sparse[index] != INVALID && this->owners[this->sparse[index]] == entity;
+  }
+
+  // entity 의 component 조회 (entity 가 component 를 가지고 있는 경우에만 호출해야 함)
+  T &Get(Entity entity) { return this->dense[this->sparse[EntityIndex(entity)]]; }
+  const T &Get(Entity entity) const { return this->dense[this->sparse[EntityIndex(entity)]]; }
+
+  // pred(owner) 가 true 인 component 를 한 번에 제거 (남은 component 들의 순서는 유지하고, 앞으로 당겨진 component 의 sparse 위치만 갱신)
+  template <typename Predicate>
+  void RemoveIf(Predicate pred)
+  {
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < this->dense.size(); i++)
+    {
+      Entity owner = this->owners[i];
+      if (pred(owner))
+      {
+        this->sparse[EntityIndex(owner)] = INVALID;
+        continue;
+      }
+      if (kept != i)
+      {
+        this->dense[kept] = this->dense[i];
+        this->owners[kept] = owner;
+        this->sparse[EntityIndex(owner)] = static_cast<unsigned int>(kept);
+      }
+      kept++;
+    }
+    this->dense.resize(kept);
+    this->owners.resize(kept);
+  }
+
+  void Clear()
+  {
+    this->dense.clear();
+    this->owners.clear();
+    this->sparse.clear();
+  }
+
+  // component count 개, entity index count 개까지 추가해도 heap 할당이 일어나지 않도록 공간 확보
+  void Reserve(std::size_t count)
+  {
+    this->dense.reserve(count);
+    this->owners.reserve(count);
+    this->sparse.reserve(count);
+  }
+
+  /** dense 범위 순회 -> i 번째 component 와 그 component 를 가진 entity */
+  std::size_t Size() const { return this->dense.size(); }
+  T *Data() { return this->dense.data(); }
+  const T *Data() const { return this->dense.data(); }
+  const Entity *Entities() const { return this->owners.data(); }
+
+  // 지금까지 동시에 보관했던 최대 component 개수 (Clear() 해도 초기화되지 않음)
+  std::size_t HighWater() const { return this->highWater; }
+
+private:
+  static const unsigned int INVALID = 0xFFFFFFFFu; // component 가 없는 entity 의 sparse 값
+
+  std::vector<T> dense;             // component 값 (추가한 순서)
+  std::vector<Entity> owners;       // dense 와 같은 위치에 저장한 component 소유 entity
+  std::vector<unsigned int> sparse; // entity index -> dense 위치
+  std::size_t highWater;
+};
+
+template <typename T>
+const unsigned int ComponentArray<T>::INVALID;
+
+#endif /* COMPONENT_ARRAY_HPP */
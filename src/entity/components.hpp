@@ -0,0 +1,103 @@
+#ifndef COMPONENTS_HPP
+#define COMPONENTS_HPP
+
+#include <glm/glm.hpp>
+
+#include "../utils/timer_queue.hpp"
+
+/**
+ * entity component 정의
+ *
+ * 게임 내의 object(player paddle, ball, powerup)는 클래스 상속 대신 아래 component 들의 조합으로 표현함.
+ * -> component 종류마다 별도의 배열(EntityRegistry 의 ComponentArray)에 모아두므로, 위치만 필요한 루프는 위치 배열만, 파괴 여부만 필요한 루프는 tag 배열만 읽음.
+ * -> brick 은 개수가 훨씬 많고 grid 에 고정되어 있으므로 entity 가 아닌 GameLevel 의 cell 별 tile byte 로 표현함.
+ *
+ * object 종류별 component 구성
+ * -> player paddle: Transform, Sprite, Tag
+ * -> ball: Transform, Velocity, Sprite, Collider, Tag
+ * -> powerup: Transform, Velocity, Sprite, Lifetime, Tag, PowerUpType
+ */
+
+// object 종류
+enum EntityKind
+{
+  ENTITY_PADDLE,
+  ENTITY_BALL,
+  ENTITY_POWERUP
+};
+
+// object 상태 flag (TagComponent::Flags 에 bit 단위로 기록)
+enum EntityFlag
+{
+  ENTITY_DESTROYED = 1 << 0,    // 습득했거나 화면 밖으로 떨어진 powerup
+  ENTITY_STUCK = 1 << 1,        // player paddle 에 고정된 ball
+  ENTITY_STICKY = 1 << 2,       // sticky powerup 이 적용된 ball -> paddle 에 닿으면 고정됨
+  ENTITY_PASS_THROUGH = 1 << 3, // pass-through powerup 이 적용된 ball -> non-solid brick 에 반사되지 않음
+  ENTITY_ACTIVATED = 1 << 4     // 효과가 적용 중인 powerup
+};
+
+// powerup 타입 (PowerUpTypes component 값, 타입별 속성은 game/power_up_table.hpp 의 정의 표 참고)
+enum PowerUpType
+{
+  POWERUP_SPEED,
+  POWERUP_STICKY,
+  POWERUP_PASS_THROUGH,
+  POWERUP_PAD_SIZE_INCREASE,
+  POWERUP_MULTI_BALL,
+  POWERUP_CONFUSE,
+  POWERUP_CHAOS,
+  POWERUP_TYPE_COUNT
+};
+
+// 위치 및 크기 (screen space 기준 2D Sprite 좌상단 좌표 및 AABB 크기)
+struct TransformComponent
+{
+  glm::vec2 Position, Size;
+
+  TransformComponent() : Position(0.0f), Size(1.0f) {};
+  TransformComponent(glm::vec2 position, glm::vec2 size) : Position(position), Size(size) {};
+};
+
+// 렌더링 정보 (텍스쳐는 GameRenderer 가 object 종류에 따라 결정함)
+struct SpriteComponent
+{
+  glm::vec3 Color;
+  float Rotation;
+
+  SpriteComponent() : Color(1.0f), Rotation(0.0f) {};
+  explicit SpriteComponent(glm::vec3 color) : Color(color), Rotation(0.0f) {};
+};
+
+// circle collider (ball) -> AABB collider 는 TransformComponent 를 그대로 사용함
+struct ColliderComponent
+{
+  float Radius;
+
+  ColliderComponent() : Radius(0.0f) {};
+  explicit ColliderComponent(float radius) : Radius(radius) {};
+};
+
+// 효과 지속시간 (powerup) -> 지속시간 0.0f 는 효과 영구 적용
+struct LifetimeComponent
+{
+  float Duration;
+  TimerHandle Timer; // 효과 적용 후 Duration 뒤에 만료되는 timer (효과 적용 전이거나 만료되었다면 NULL_TIMER)
+
+  LifetimeComponent() : Duration(0.0f), Timer(NULL_TIMER) {};
+  explicit LifetimeComponent(float duration) : Duration(duration), Timer(NULL_TIMER) {};
+};
+
+// object 종류 및 상태 flag
+struct TagComponent
+{
+  EntityKind Kind;
+  unsigned int Flags;
+
+  TagComponent() : Kind(ENTITY_PADDLE), Flags(0) {};
+  TagComponent(EntityKind kind, unsigned int flags) : Kind(kind), Flags(flags) {};
+
+  bool Has(EntityFlag flag) const { return (this->Flags & flag) != 0; };
+  void Set(EntityFlag flag, bool enabled) { this->Flags = enabled ? (this->Flags | flag) : (this->Flags & ~static_cast<unsigned int>(flag)); };
+};
+
+#endif /* COMPONENTS_HPP */
@@ -0,0 +1,100 @@
+#include "entity_registry.hpp"
+
+#include <algorithm>
+
+EntityRegistry::EntityRegistry()
+    : count(0), highWater(0), reserved(0) {};
+
+Entity EntityRegistry::Create()
+{
+  unsigned int index;
+  if (!this->freeIndices.empty())
+  {
+    index = this->freeIndices.back();
+    this->freeIndices.pop_back();
+  }
+  else
+  {
+    index = static_cast<unsigned int>(this->generations.size());
+    this->generations.push_back(0);
+  }
+  this->count++;
+  this->highWater = std::max(this->highWater, this->count);
+  return MakeEntity(index, this->generations[index]);
+}
+
+void EntityRegistry::Destroy(Entity entity)
+{
+  if (this->IsAlive(entity))
+  {
+    this->pending.push_back(entity);
+  }
+}
+
+void EntityRegistry::Flush()
+{
+  if (this->pending.empty())
+  {
+    return;
+  }
+
+  // 세대 번호를 올려서 예약된 entity 들의 ID 를 무효화 (같은 entity 가 여러 번 예약되었다면 한 번만 처리)
+  for (Entity entity : this->pending)
+  {
+    if (this->IsAlive(entity))
+    {
+      unsigned int index = EntityIndex(entity);
+      this->generations[index]++;
+      this->freeIndices.push_back(index);
+      this->count--;
+    }
+  }
+  this->pending.clear();
+
+  // 무효화된 ID 가 소유한 component 를 배열마다 한 번의 pass 로 제거
+  auto dead = [this](Entity owner)
+  { return !this->IsAlive(owner); };
+  this->Transforms.RemoveIf(dead);
+  this->Velocities.RemoveIf(dead);
+  this->Sprites.RemoveIf(dead);
+  this->Colliders.RemoveIf(dead);
+  this->Lifetimes.RemoveIf(dead);
+  this->Tags.RemoveIf(dead);
+  this->PowerUpTypes.RemoveIf(dead);
+}
+
+bool EntityRegistry::IsAlive(Entity entity) const
+{
+  unsigned int index = EntityIndex(entity);
+  return entity != NULL_ENTITY && index < this->generations.size() && this->generations[index] == EntityGeneration(entity);
+}
+
+void EntityRegistry::Clear()
+{
+  this->Transforms.Clear();
+  this->Velocities.Clear();
+  this->Sprites.Clear();
+  this->Colliders.Clear();
+  this->Lifetimes.Clear();
+  this->Tags.Clear();
+  this->PowerUpTypes.Clear();
+  this->generations.clear();
+  this->freeIndices.clear();
+  this->pending.clear();
+  this->count = 0;
+}
+
+void EntityRegistry::Reserve(unsigned int capacity)
+{
+  this->Transforms.Reserve(capacity);
+  this->Velocities.Reserve(capacity);
+  this->Sprites.Reserve(capacity);
+  this->Colliders.Reserve(capacity);
+  this->Lifetimes.Reserve(capacity);
+  this->Tags.Reserve(capacity);
+  this->PowerUpTypes.Reserve(capacity);
+  this->generations.reserve(capacity);
+  this->freeIndices.reserve(capacity);
+  this->pending.reserve(capacity);
+  this->reserved = std::max(this->reserved, capacity);
+}
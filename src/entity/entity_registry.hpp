@@ -0,0 +1,69 @@
+#ifndef ENTITY_REGISTRY_HPP
+#define ENTITY_REGISTRY_HPP
+
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "component_array.hpp"
+#include "components.hpp"
+
+/**
+ * EntityRegistry 클래스
+ *
+ * entity ID 발급 및 component 배열들을 한데 모아 관리하는 클래스. (Game 의 paddle, ball, powerup 들)
+ *
+ * -> entity 는 ID 일 뿐이고, object 의 상태는 component 종류별 배열에 나누어 저장함.
+ * -> Destroy() 는 파괴 예약만 하고, Flush() 호출 시점에 모든 component 배열에서 한 번의 pass 로 제거함.
+ *    (루프 도중에 파괴해도 순회 중인 배열이 바뀌지 않고, entity 가 여러 개 파괴되어도 배열마다 한 번만 당겨짐)
+ */
+class EntityRegistry
+{
+public:
+  /** component 배열 */
+  ComponentArray<TransformComponent> Transforms;
+  ComponentArray<glm::vec2> Velocities;
+  ComponentArray<SpriteComponent> Sprites;
+  ComponentArray<ColliderComponent> Colliders;
+  ComponentArray<LifetimeComponent> Lifetimes;
+  ComponentArray<TagComponent> Tags;
+  ComponentArray<PowerUpType> PowerUpTypes;
+
+  EntityRegistry();
+
+  // 새 entity ID 발급 (파괴된 entity 의 index 가 있다면 재사용)
+  Entity Create();
+
+  // entity 파괴 예약 (Flush() 호출 전까지는 component 가 그대로 남아있음)
+  void Destroy(Entity entity);
+
+  // 파괴 예약된 entity 들의 component 를 모든 배열에서 제거하고 ID 반납
+  void Flush();
+
+  // entity 가 아직 파괴되지 않았는 지 여부 (파괴 예약만 된 entity 는 Flush() 전까지 살아있음)
+  bool IsAlive(Entity entity) const;
+
+  // 모든 entity 및 component 제거 (이전에 발급한 ID 는 더 이상 사용하면 안 됨)
+  void Clear();
+
+  // entity 및 모든 component 배열의 공간을 capacity 개만큼 미리 확보
+  // -> 동시에 살아있는 entity 가 capacity 개 이하라면 생성, 파괴를 반복해도 heap 할당이 일어나지 않음.
+  void Reserve(unsigned int capacity);
+
+  // 살아있는 entity 개수 및 지금까지 동시에 살아있던 최대 entity 개수
+  unsigned int Count() const { return this->count; };
+  unsigned int HighWater() const { return this->highWater; };
+
+  // Reserve() 로 확보한 최대 entity 개수 (HighWater() 가 이보다 크면 확보한 공간을 넘어서 배열이 재할당된 것)
+  unsigned int Reserved() const { return this->reserved; };
+
+private:
+  std::vector<unsigned char> generations; // entity index 별 현재 세대 번호
+  std::vector<unsigned int> freeIndices;  // 재사용 가능한 entity index
+  std::vector<Entity> pending;            // 파괴 예약된 entity
+  unsigned int count;
+  unsigned int highWater;
+  unsigned int reserved;
+};
+
+#endif /* ENTITY_REGISTRY_HPP */
@@ -0,0 +1,158 @@
+#include "batch_env.hpp"
+
+#include <iostream>
+#include <algorithm>
+
+// 게임 번호와 episode 번호로 게임별 seed 계산 (인접한 번호끼리도 난수열이 겹치지 않도록 bit 를 섞음)
+static unsigned int mixSeed(unsigned int seed, unsigned int index, unsigned int episode)
+{
+  unsigned int h = seed ^ (index * 0x9E3779B9u) ^ (episode * 0x85EBCA6Bu);
+  h ^= h >> 16;
+  h *= 0x7FEB352Du;
+  h ^= h >> 15;
+  h *= 0x846CA68Bu;
+  h ^= h >> 16;
+  return h;
+}
+
+// 게임 개수보다 많은 스레드는 할 일이 없으므로 생성하지 않음 (0 이면 하드웨어 스레드 개수)
+static unsigned int clampThreads(unsigned int threads, unsigned int count)
+{
+  if (threads == 0)
+  {
+    threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+  return std::max(1u, std::min(threads, count));
+}
+
+BatchEnv::BatchEnv(unsigned int count, unsigned int threads, unsigned int width, unsigned int height)
+    : count(count), width(width), height(height), seed(0), maxEpisodeSteps(0), prototype(width, height), prototypeSolidBricks(0),
+      observations(static_cast<std::size_t>(ENV_OBS_COUNT) * count, 0.0f), rewards(count, 0.0f), dones(count, 0),
+      workers(clampThreads(threads, count))
+{
+}
+
+bool BatchEnv::Reset(unsigned int seed)
+{
+  // .lvl 파일은 처음 한 번만 로드하고, 이후 episode reset 은 로드된 초기 상태를 복사함
+  if (this->prototype.Levels.empty())
+  {
+    this->prototype.Init();
+    if (this->prototype.Levels.empty() || this->prototype.Levels[0].BrickCount() == 0)
+    {
+      std::cout << "ERROR::BATCH_ENV: Failed to load levels (run from the directory containing resources/levels)" << std::endl;
+      this->prototype.Levels.clear();
+      return false;
+    }
+    this->prototypeSolidBricks = this->prototype.Levels[this->prototype.Level].SolidBrickCount();
+  }
+
+  this->seed = seed;
+  this->games.assign(this->count, this->prototype);
+  this->episodes.assign(this->count, 0);
+  this->steps.assign(this->count, 0);
+  for (unsigned int i = 0; i < this->count; i++)
+  {
+    this->games[i].Seed(mixSeed(this->seed, i, 0));
+    this->writeObservation(i);
+  }
+  std::fill(this->rewards.begin(), this->rewards.end(), 0.0f);
+  std::fill(this->dones.begin(), this->dones.end(), 0);
+  return true;
+}
+
+void BatchEnv::Step(const unsigned char *actions, float dt)
+{
+  if (this->games.size() != this->count)
+  {
+    std::cout << "ERROR::BATCH_ENV: Step() called before a successful Reset()" << std::endl;
+    return;
+  }
+
+  // 게임들을 스레드 개수만큼의 구간으로 나누어 병렬 진행 (호출한 스레드도 0 번 구간을 담당)
+  this->workers.Run([this, actions, dt](unsigned int chunk)
+                    { this->stepChunk(chunk, actions, dt); });
+}
+
+void BatchEnv::stepChunk(unsigned int chunk, const unsigned char *actions, float dt)
+{
+  // 게임들을 스레드 개수만큼의 연속된 구간으로 나눔 -> 구간마다 결과 배열의 서로 다른 부분에만 기록하므로 동기화가 필요 없음
+  unsigned int threads = this->ThreadCount();
+  unsigned int begin = static_cast<unsigned int>(static_cast<unsigned long long>(this->count) * chunk / threads);
+  unsigned int end = static_cast<unsigned int>(static_cast<unsigned long long>(this->count) * (chunk + 1) / threads);
+
+  for (unsigned int i = begin; i < end; i++)
+  {
+    Game &game = this->games[i];
+    unsigned char action = actions != nullptr ? actions[i] : static_cast<unsigned char>(ENV_ACTION_NONE);
+
+    unsigned int bricksBefore = game.Levels[game.Level].LiveBrickCount();
+    unsigned int livesBefore = game.Lives;
+
+    // 행동에 대응되는 키 입력 후 한 tick 진행
+    game.SetKey(GAME_KEY_A, action == ENV_ACTION_LEFT);
+    game.SetKey(GAME_KEY_D, action == ENV_ACTION_RIGHT);
+    game.SetKey(GAME_KEY_SPACE, action == ENV_ACTION_LAUNCH);
+    game.ProcessInput(dt);
+    game.Update(dt);
+    this->steps[i]++;
+
+    float reward = 0.0f;
+    bool done = false;
+    if (game.State == GAME_WIN)
+    {
+      // 레벨 클리어 시 Game::Update() 에서 level 이 다시 로드되므로, 이번 tick 에 파괴한 brick 수는 solid brick 만 남았다고 보고 계산
+      reward += static_cast<float>(bricksBefore - this->prototypeSolidBricks);
+      done = true;
+    }
+    else if (game.State == GAME_MENU)
+    {
+      // 마지막 수명을 잃으면 Game::Update() 에서 수명이 다시 채워지고 메뉴 상태로 전환됨
+      reward -= 1.0f;
+      done = true;
+    }
+    else
+    {
+      reward += static_cast<float>(bricksBefore - game.Levels[game.Level].LiveBrickCount());
+      reward -= static_cast<float>(livesBefore - game.Lives);
+      done = this->maxEpisodeSteps > 0 && this->steps[i] >= this->maxEpisodeSteps;
+    }
+
+    this->rewards[i] = reward;
+    this->dones[i] = done ? 1 : 0;
+    if (done)
+    {
+      this->resetGame(i);
+    }
+    this->writeObservation(i);
+  }
+}
+
+void BatchEnv::resetGame(unsigned int index)
+{
+  this->episodes[index]++;
+  this->steps[index] = 0;
+  this->games[index] = this->prototype;
+  this->games[index].Seed(mixSeed(this->seed, index, this->episodes[index]));
+}
+
+void BatchEnv::writeObservation(unsigned int index)
+{
+  const Game &game = this->games[index];
+  float *obs = this->observations.data();
+  const unsigned int n = this->count;
+
+  const TransformComponent &ball = game.Entities.Transforms.Get(game.Ball);
+  const glm::vec2 &velocity = game.Entities.Velocities.Get(game.Ball);
+  const TransformComponent &player = game.Entities.Transforms.Get(game.Player);
+
+  obs[ENV_OBS_BALL_X * n + index] = ball.Position.x;
+  obs[ENV_OBS_BALL_Y * n + index] = ball.Position.y;
+  obs[ENV_OBS_BALL_VX * n + index] = velocity.x;
+  obs[ENV_OBS_BALL_VY * n + index] = velocity.y;
+  obs[ENV_OBS_BALL_STUCK * n + index] = game.Entities.Tags.Get(game.Ball).Has(ENTITY_STUCK) ? 1.0f : 0.0f;
+  obs[ENV_OBS_PADDLE_X * n + index] = player.Position.x;
+  obs[ENV_OBS_PADDLE_WIDTH * n + index] = player.Size.x;
+  obs[ENV_OBS_LIVES * n + index] = static_cast<float>(game.Lives);
+  obs[ENV_OBS_LIVE_BRICKS * n + index] = static_cast<float>(game.Levels[game.Level].LiveBrickCount());
+}
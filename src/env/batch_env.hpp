@@ -0,0 +1,99 @@
+#ifndef BATCH_ENV_HPP
+#define BATCH_ENV_HPP
+
+#include <vector>
+
+#include "../game/game.hpp"
+#include "../utils/worker_pool.hpp"
+
+// 매 step 마다 각 게임에 전달하는 행동 (paddle 조작)
+enum EnvAction
+{
+  ENV_ACTION_NONE,   // 아무 키도 누르지 않음
+  ENV_ACTION_LEFT,   // A 키 -> paddle 좌측 이동
+  ENV_ACTION_RIGHT,  // D 키 -> paddle 우측 이동
+  ENV_ACTION_LAUNCH, // Space 키 -> paddle 에 붙어있는 ball 발사
+  ENV_ACTION_COUNT
+};
+
+// 게임 하나의 관측값 항목 (모두 screen space 좌표 기준 float)
+enum EnvObservation
+{
+  ENV_OBS_BALL_X,       // ball 좌상단 x 좌표
+  ENV_OBS_BALL_Y,       // ball 좌상단 y 좌표
+  ENV_OBS_BALL_VX,      // ball x 축 속도
+  ENV_OBS_BALL_VY,      // ball y 축 속도
+  ENV_OBS_BALL_STUCK,   // ball 이 paddle 에 붙어있으면 1, 아니면 0
+  ENV_OBS_PADDLE_X,     // paddle 좌상단 x 좌표
+  ENV_OBS_PADDLE_WIDTH, // paddle 너비 (pad-size-increase powerup 으로 변경됨)
+  ENV_OBS_LIVES,        // 남은 수명
+  ENV_OBS_LIVE_BRICKS,  // 남아있는 brick 개수 (solid brick 포함)
+  ENV_OBS_COUNT
+};
+
+/**
+ * BatchEnv 클래스
+ *
+ * 서로 독립적인 게임 N 개를 한 번의 Step() 호출로 동시에 진행하는 batch 환경 클래스. (bot 학습 및 밸런스 분석 용도)
+ *
+ * -> 게임 인스턴스는 연속된 구간으로 나누어 worker 스레드들이 병렬로 진행함. (호출한 스레드도 첫 번째 구간을 담당)
+ * -> 관측값, 보상, 종료 여부는 항목별로 N 개씩 연속된 배열(SoA)에 기록하므로, 학습 코드에서 복사 없이 그대로 batch 텐서로 사용할 수 있음.
+ *    ex> 게임 i 의 ball x 좌표 = Observations()[ENV_OBS_BALL_X * Count() + i]
+ * -> 게임 오버, 레벨 클리어 또는 최대 step 수 도달 시 Dones() 에 1 을 기록하고, 해당 게임은 즉시 새 episode 로 reset 됨.
+ *
+ * 보상: brick 파괴 시 +1, 수명 감소(게임 오버 포함) 시 -1
+ */
+class BatchEnv
+{
+public:
+  // count: 게임 개수, threads: 사용할 스레드 개수 (0 이면 하드웨어 스레드 개수)
+  BatchEnv(unsigned int count, unsigned int threads = 0, unsigned int width = 800, unsigned int height = 600);
+
+  // 모든 게임을 첫 번째 level 의 새 episode 로 reset (.lvl 파일을 로드하지 못하면 에러 로그 출력 후 false 반환)
+  bool Reset(unsigned int seed);
+
+  // 모든 게임을 한 tick 진행 (actions 는 게임마다 EnvAction 값 하나씩 N 개)
+  void Step(const unsigned char *actions, float dt);
+
+  // episode 최대 step 수 (0 이면 제한 없음 -> solid brick 사이에서 ball 이 끝없이 튕기는 episode 를 끊기 위한 목적)
+  void SetMaxEpisodeSteps(unsigned int steps) { this->maxEpisodeSteps = steps; };
+
+  unsigned int Count() const { return this->count; };
+  unsigned int ThreadCount() const { return this->workers.ThreadCount(); };
+
+  // 직전 Step() (또는 Reset()) 결과 -> [ENV_OBS_COUNT][Count()] 관측값, [Count()] 보상, [Count()] 종료 여부
+  const float *Observations() const { return this->observations.data(); };
+  const float *Rewards() const { return this->rewards.data(); };
+  const unsigned char *Dones() const { return this->dones.data(); };
+
+  // 게임 i 의 전체 상태 (관측값 외의 정보가 필요한 경우)
+  const Game &GetGame(unsigned int index) const { return this->games[index]; };
+
+private:
+  unsigned int count, width, height;
+  unsigned int seed;
+  unsigned int maxEpisodeSteps;
+
+  Game prototype;                     // .lvl 파일을 한 번만 로드해 두고 episode reset 시 복사하는 초기 게임 상태
+  unsigned int prototypeSolidBricks;  // 초기 level 의 solid brick 개수 (레벨 클리어 시 보상 계산용)
+  std::vector<Game> games;            // 게임 인스턴스
+  std::vector<unsigned int> episodes; // 게임별 episode 번호 (reset 시 seed 계산용)
+  std::vector<unsigned int> steps;    // 게임별 현재 episode 의 step 수
+
+  std::vector<float> observations;
+  std::vector<float> rewards;
+  std::vector<unsigned char> dones;
+
+  WorkerPool workers; // 게임들을 연속된 구간으로 나누어 진행할 스레드 pool
+
+  // chunk 번 구간의 게임들을 한 tick 진행
+  void stepChunk(unsigned int chunk, const unsigned char *actions, float dt);
+
+  // 게임 하나를 새 episode 로 reset
+  void resetGame(unsigned int index);
+
+  // 게임 하나의 관측값 기록
+  void writeObservation(unsigned int index);
+};
+
+#endif /* BATCH_ENV_HPP */
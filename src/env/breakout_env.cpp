@@ -0,0 +1,87 @@
+#include "breakout_env.h"
+#include "batch_env.hpp"
+#include "../profiler/cpu_profiler.hpp"
+
+#include <new>
+
+// C 인터페이스의 불투명 handle -> 내부적으로는 BatchEnv 인스턴스
+struct BreakoutEnv
+{
+  BatchEnv Env;
+
+  BreakoutEnv(unsigned int count, unsigned int threads) : Env(count, threads) {};
+};
+
+BreakoutEnv *breakout_env_create(unsigned int count, unsigned int threads, unsigned int seed)
+{
+  if (count == 0)
+  {
+    return nullptr;
+  }
+
+  // 게임마다 매 tick 기록되는 timing zone 은 학습 중에는 의미가 없고 비용만 발생하므로 CPU 프로파일러 비활성화
+  CpuProfiler::SetEnabled(false);
+
+  // C 호출자에게 예외가 전파되지 않도록 할당 실패는 NULL 로 반환
+  BreakoutEnv *env = new (std::nothrow) BreakoutEnv(count, threads);
+  if (env == nullptr)
+  {
+    return nullptr;
+  }
+  if (!env->Env.Reset(seed))
+  {
+    delete env;
+    return nullptr;
+  }
+  return env;
+}
+
+void breakout_env_destroy(BreakoutEnv *env)
+{
+  delete env;
+}
+
+int breakout_env_reset(BreakoutEnv *env, unsigned int seed)
+{
+  return env->Env.Reset(seed) ? 1 : 0;
+}
+
+void breakout_env_step(BreakoutEnv *env, const unsigned char *actions, float dt)
+{
+  env->Env.Step(actions, dt);
+}
+
+void breakout_env_set_max_episode_steps(BreakoutEnv *env, unsigned int steps)
+{
+  env->Env.SetMaxEpisodeSteps(steps);
+}
+
+unsigned int breakout_env_count(const BreakoutEnv *env)
+{
+  return env->Env.Count();
+}
+
+unsigned int breakout_env_observation_size(void)
+{
+  return ENV_OBS_COUNT;
+}
+
+unsigned int breakout_env_action_count(void)
+{
+  return ENV_ACTION_COUNT;
+}
+
+const float *breakout_env_observations(const BreakoutEnv *env)
+{
+  return env->Env.Observations();
+}
+
+const float *breakout_env_rewards(const BreakoutEnv *env)
+{
+  return env->Env.Rewards();
+}
+
+const unsigned char *breakout_env_dones(const BreakoutEnv *env)
+{
+  return env->Env.Dones();
+}
@@ -0,0 +1,60 @@
+#ifndef BREAKOUT_ENV_H
+#define BREAKOUT_ENV_H
+
+/**
+ * breakout_env C 인터페이스
+ *
+ * BatchEnv 를 C 함수로 감싼 인터페이스 -> Python(ctypes, cffi) 등 다른 언어의 학습 코드에서 공유 라이브러리(breakout_env)로 불러서 사용함.
+ *
+ * 관측값 배열은 항목별로 게임 N 개씩 연속으로 저장됨. (SoA, [observation_size][count] float 배열)
+ * 행동 값: 0 = 없음, 1 = 좌측 이동, 2 = 우측 이동, 3 = ball 발사
+ * 보상 값: brick 파괴 시 +1, 수명 감소 시 -1
+ * 종료된 게임은 step 직후 자동으로 새 episode 로 reset 되며, 반환되는 관측값은 새 episode 의 첫 관측값임.
+ *
+ * 반환되는 배열 포인터는 다음 breakout_env_step() / breakout_env_reset() 호출 전까지만 유효함.
+ * 레벨 파일(resources/levels 디렉토리의 .lvl 파일)은 현재 작업 디렉토리 기준 상대 경로로 로드함.
+ */
+
+#if defined(_WIN32)
+#if defined(BREAKOUT_ENV_BUILD)
+#define BREAKOUT_ENV_API __declspec(dllexport)
+#else
+#define BREAKOUT_ENV_API __declspec(dllimport)
+#endif
+#else
+#define BREAKOUT_ENV_API __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+  typedef struct BreakoutEnv BreakoutEnv;
+
+  // 게임 count 개를 가진 환경 생성 및 seed 로 reset (threads 가 0 이면 하드웨어 스레드 개수 사용, 실패 시 NULL 반환)
+  BREAKOUT_ENV_API BreakoutEnv *breakout_env_create(unsigned int count, unsigned int threads, unsigned int seed);
+  BREAKOUT_ENV_API void breakout_env_destroy(BreakoutEnv *env);
+
+  // 모든 게임을 새 episode 로 reset (성공 시 1, 실패 시 0 반환)
+  BREAKOUT_ENV_API int breakout_env_reset(BreakoutEnv *env, unsigned int seed);
+
+  // 모든 게임을 dt 초만큼 한 tick 진행 (actions 는 게임마다 하나씩 count 개, NULL 이면 모두 행동 없음)
+  BREAKOUT_ENV_API void breakout_env_step(BreakoutEnv *env, const unsigned char *actions, float dt);
+
+  // episode 최대 step 수 지정 (0 이면 제한 없음)
+  BREAKOUT_ENV_API void breakout_env_set_max_episode_steps(BreakoutEnv *env, unsigned int steps);
+
+  BREAKOUT_ENV_API unsigned int breakout_env_count(const BreakoutEnv *env);
+  BREAKOUT_ENV_API unsigned int breakout_env_observation_size(void);
+  BREAKOUT_ENV_API unsigned int breakout_env_action_count(void);
+
+  BREAKOUT_ENV_API const float *breakout_env_observations(const BreakoutEnv *env);
+  BREAKOUT_ENV_API const float *breakout_env_rewards(const BreakoutEnv *env);
+  BREAKOUT_ENV_API const unsigned char *breakout_env_dones(const BreakoutEnv *env);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BREAKOUT_ENV_H */
@@ -0,0 +1,27 @@
+#include "camera.hpp"
+
+#include <algorithm>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+Camera::Camera()
+    : Position(0.0f), ViewportSize(1.0f), Zoom(1.0f) {};
+
+Camera::Camera(glm::vec2 viewportSize)
+    : Position(0.0f), ViewportSize(viewportSize), Zoom(1.0f) {};
+
+glm::mat4 Camera::ViewMatrix() const
+{
+  // view 좌상단을 원점으로 옮긴 뒤 확대 (scale * translate)
+  glm::mat4 view = glm::scale(glm::mat4(1.0f), glm::vec3(this->Zoom, this->Zoom, 1.0f));
+  return glm::translate(view, glm::vec3(-this->Position, 0.0f));
+}
+
+void Camera::FollowY(float centerY, float minY, float maxY)
+{
+  float height = this->ViewSize().y;
+  float y = centerY - height / 2.0f;
+  y = std::min(y, maxY - height);
+  y = std::max(y, std::min(minY, maxY - height));
+  this->Position.y = y;
+}
@@ -0,0 +1,44 @@
+#ifndef CAMERA_HPP
+#define CAMERA_HPP
+
+#include <glm/glm.hpp>
+
+/**
+ * Camera 클래스
+ *
+ * 화면에 보이는 world 영역(view)을 정의하는 2D 카메라. (world 좌표계는 기존 screen space 와 같이 좌상단 원점, y 축이 아래 방향)
+ * -> Position 은 view 의 좌상단 world 좌표, Zoom 은 확대 배율 (1.0f 이면 world 1 단위가 화면 1 pixel).
+ * -> Game 이 시뮬레이션 상태로부터 갱신하고, GameRenderer 는 ViewMatrix() 를 sprite, particle, text 쉐이더가 공유하는 uniform block 에 전송함.
+ *
+ * GL 에 의존하지 않으므로 breakout_sim 에 포함되며, 카메라 이동이 없는 일반 레벨에서는 Position (0, 0), Zoom 1.0f 로 기존 screen space 와 같음.
+ */
+class Camera
+{
+public:
+  glm::vec2 Position;     // view 좌상단의 world 좌표
+  glm::vec2 ViewportSize; // 화면 해상도
+  float Zoom;             // 확대 배율
+
+  Camera();
+  explicit Camera(glm::vec2 viewportSize);
+
+  // 화면에 보이는 world 영역의 크기 및 [min, max] 범위
+  glm::vec2 ViewSize() const { return this->ViewportSize / this->Zoom; };
+  glm::vec2 ViewMin() const { return this->Position; };
+  glm::vec2 ViewMax() const { return this->Position + this->ViewSize(); };
+
+  // 좌상단 position, 크기 size 인 사각형이 view 와 겹치는지 여부 (렌더링 전 화면 밖 object 를 걸러내는 view culling 용)
+  bool IsVisible(glm::vec2 position, glm::vec2 size) const
+  {
+    glm::vec2 min = this->ViewMin(), max = this->ViewMax();
+    return position.x < max.x && position.y < max.y && position.x + size.x > min.x && position.y + size.y > min.y;
+  };
+
+  // world 좌표를 screen space 좌표로 변환하는 view 행렬 (projection 행렬은 화면 해상도 기준 orthogonal 투영 그대로 사용)
+  glm::mat4 ViewMatrix() const;
+
+  // view 의 세로 중심이 centerY 에 오도록 이동하되, view 가 [minY, maxY] 범위를 벗어나지 않도록 고정 (범위가 view 보다 작으면 maxY 에 맞춤)
+  void FollowY(float centerY, float minY, float maxY);
+};
+
+#endif /* CAMERA_HPP */
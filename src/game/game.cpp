@@ -1,149 +1,223 @@
 #include <cmath>
-#include <sstream>
-#include <irrklang/irrKlang.h>
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <string>
 #include "game.hpp"
-#include "../manager/resource_manager.hpp"
-#include "../renderer/sprite_renderer.hpp"
-#include "../game_object/game_object.hpp"
-#include "../game_object/ball_object.hpp"
-#include "../particle/particle_generator.hpp"
-#include "../postprocess/post_processor.hpp"
-#include "../renderer/text_renderer.hpp"
-
-/** 게임 관련 상태 변수들 전역 선언(가급적 전역 변수 사용 지양...) */
-SpriteRenderer *Renderer;
-GameObejct *Player;
-BallObject *Ball;
-ParticleGenerator *Particles;
-PostProcessor *Effects;
-irrklang::ISoundEngine *SoundEngine = irrklang::createIrrKlangDevice();
-TextRenderer *Text;
-
-// solid collision 발생 시 reset 되는 shake effect 활성화 지속시간 전역 변수로 선언
-float ShakeTime = 0.0f;
+#include "../level/level_file.hpp"
+#include "../profiler/cpu_profiler.hpp"
+#include "../physics/collision.hpp"
 
 Game::Game(unsigned int width, unsigned int height)
-    : State(GAME_ACTIVE), Keys(), KeysProcessed(), Width(width), Height(height), Level(0), Lives(3)
+    : State(GAME_ACTIVE), Keys(), KeysProcessed(), Width(width), Height(height), Level(0), Lives(3), Player(NULL_ENTITY), Ball(NULL_ENTITY), ActivePowerUps(), Audio(nullptr), Workers(nullptr), View(glm::vec2(width, height)), Rng(1, RANDOM_STREAM_GAMEPLAY), contactHighWater(0)
 {
 }
 
-Game::~Game()
+void Game::Seed(unsigned int seed)
 {
-  // 동적 할당된 게임 상태 변수(전역 선언)들 메모리 반납
-  delete Renderer;
-  delete Player;
-  delete Ball;
-  delete Particles;
-  delete Effects;
-  delete Text;
-  SoundEngine->drop();
+  this->Rng.Seed(seed, RANDOM_STREAM_GAMEPLAY);
 }
 
-void Game::Init()
+void Game::SetKey(int key, bool pressed)
 {
-  // 2D Sprite 쉐이더 객체 생성
-  ResourceManager::LoadShader("resources/shaders/sprite.vs", "resources/shaders/sprite.fs", nullptr, "sprite");
-  ResourceManager::LoadShader("resources/shaders/particle.vs", "resources/shaders/particle.fs", nullptr, "particle");
-  ResourceManager::LoadShader("resources/shaders/post_processing.vs", "resources/shaders/post_processing.fs", nullptr, "postprocessing");
-
-  // 2D Sprite 에 적용할 orthogonal projection 행렬 계산
-  // 2D Quad 정점 데이터 및 위치를 직관적인 screen space 좌표계로 다루기 위해, screen size 해상도로 left, right, top, bottom 정의
-  // 아래와 같이 orthogonal 투영행렬을 정의하면 world space 좌표를 screen space 와 동일하게 다루어도 알아서 [-1, 1] 범위의 NDC 좌표계로 변환해 줌.
-  // https://github.com/jooo0922/opengl-text-rendering/blob/main/src/main.cpp 참고
-  glm::mat4 projection = glm::ortho(0.0f, static_cast<float>(this->Width), static_cast<float>(this->Height), 0.0f, -1.0f, 1.0f);
-
-  // 2D Sprite 쉐이더에 uniform 변수 전송
-  ResourceManager::GetShader("sprite").Use().SetInt("image", 0);
-  ResourceManager::GetShader("sprite").SetMat4("projection", projection);
-  ResourceManager::GetShader("particle").Use().SetInt("sprite", 0);
-  ResourceManager::GetShader("particle").SetMat4("projection", projection);
-
-  // 2D Sprite 에 적용할 텍스쳐 객체 생성
-  ResourceManager::LoadTexture("resources/textures/awesomeface.png", true, "face");
-  ResourceManager::LoadTexture("resources/textures/background.jpg", false, "background");
-  ResourceManager::LoadTexture("resources/textures/block.png", false, "block");
-  ResourceManager::LoadTexture("resources/textures/block_solid.png", false, "block_solid");
-  ResourceManager::LoadTexture("resources/textures/paddle.png", true, "paddle");
-  ResourceManager::LoadTexture("resources/textures/particle.png", true, "particle");
-  ResourceManager::LoadTexture("resources/textures/powerup_speed.png", true, "powerup_speed");
-  ResourceManager::LoadTexture("resources/textures/powerup_sticky.png", true, "powerup_sticky");
-  ResourceManager::LoadTexture("resources/textures/powerup_increase.png", true, "powerup_increase");
-  ResourceManager::LoadTexture("resources/textures/powerup_confuse.png", true, "powerup_confuse");
-  ResourceManager::LoadTexture("resources/textures/powerup_chaos.png", true, "powerup_chaos");
-  ResourceManager::LoadTexture("resources/textures/powerup_passthrough.png", true, "powerup_passthrough");
-
-  // 생성된 2D Sprite 쉐이더 객체를 넘겨줘서 SpriteRenderer 인스턴스 동적 할당 생성
-  Renderer = new SpriteRenderer(ResourceManager::GetShader("sprite"));
-
-  // 생성된 Particle 쉐이더 객체를 넘겨줘서 ParticleGenerator 인스턴스 동적 할당 생성
-  Particles = new ParticleGenerator(ResourceManager::GetShader("particle"), ResourceManager::GetTexture("particle"), 500);
-
-  // 생성된 post processing 쉐이더 객체를 넘겨줘서 PostProcessor 인스턴스 동적 할당 생성
-  Effects = new PostProcessor(ResourceManager::GetShader("postprocessing"), this->Width, this->Height);
-
-  // TextRenderer 인스턴스 동적 할당 생성 및 .ttf 파일 로드
-  Text = new TextRenderer(this->Width, this->Height);
-  Text->Load("resources/fonts/OCRAEXT.TTF", 24);
-
-  // .lvl 파일을 로드하여 각 단계별 GameLevel 인스턴스 생성 및 컨테이너에 추가(= 인스턴스 복사)
-  GameLevel one;
-  GameLevel two;
-  GameLevel three;
-  GameLevel four;
-  one.Load("resources/levels/one.lvl", this->Width, this->Height / 2);
-  two.Load("resources/levels/two.lvl", this->Width, this->Height / 2);
-  three.Load("resources/levels/three.lvl", this->Width, this->Height / 2);
-  four.Load("resources/levels/four.lvl", this->Width, this->Height / 2);
-  this->Levels.push_back(one);
-  this->Levels.push_back(two);
-  this->Levels.push_back(three);
-  this->Levels.push_back(four);
-
-  // 현재 게임 level 을 1단계(one)로 초기화
+  if (key < 0 || key >= 1024)
+  {
+    return;
+  }
+
+  if (pressed)
+  {
+    // key press 시, 해당 키 입력 플래그 활성화
+    this->Keys[key] = true;
+  }
+  else
+  {
+    // key release 시, 해당 키 입력 플래그 비활성화
+    this->Keys[key] = false;
+    // key release 시, 해당 키 입력 처리 상태도 초기화
+    this->KeysProcessed[key] = false;
+  }
+}
+
+// 64bit FNV-1a hash 에 임의의 값을 byte 단위로 누적 (float 은 bit 패턴 그대로 hashing 하므로 재생 결과가 bit 단위로 같아야 hash 가 일치함)
+template <typename T>
+static void hashValue(unsigned long long &hash, const T &value)
+{
+  const unsigned char *bytes = reinterpret_cast<const unsigned char *>(&value);
+  for (std::size_t i = 0; i < sizeof(T); i++)
+  {
+    hash = (hash ^ bytes[i]) * 1099511628211ull;
+  }
+}
+
+// entity 의 위치, 크기, 속도, 파괴 여부 hashing (속도 component 가 없는 entity 는 영벡터)
+static void hashEntity(unsigned long long &hash, const EntityRegistry &entities, Entity entity)
+{
+  const TransformComponent &transform = entities.Transforms.Get(entity);
+  glm::vec2 velocity = entities.Velocities.Has(entity) ? entities.Velocities.Get(entity) : glm::vec2(0.0f);
+  hashValue(hash, transform.Position.x);
+  hashValue(hash, transform.Position.y);
+  hashValue(hash, transform.Size.x);
+  hashValue(hash, transform.Size.y);
+  hashValue(hash, velocity.x);
+  hashValue(hash, velocity.y);
+  hashValue(hash, entities.Tags.Get(entity).Has(ENTITY_DESTROYED));
+}
+
+unsigned long long Game::StateHash() const
+{
+  unsigned long long hash = 14695981039346656037ull;
+  hashValue(hash, this->State);
+  hashValue(hash, this->Level);
+  hashValue(hash, this->Lives);
+  hashValue(hash, this->Rng.State());
+  hashValue(hash, this->Effects.Shake);
+  hashValue(hash, this->Effects.Confuse);
+  hashValue(hash, this->Effects.Chaos);
+  hashValue(hash, this->Timers.Remaining(this->Effects.ShakeTimer));
+
+  const EntityRegistry &entities = this->Entities;
+  hashEntity(hash, entities, this->Player);
+  hashEntity(hash, entities, this->Ball);
+  const TagComponent &ball = entities.Tags.Get(this->Ball);
+  hashValue(hash, ball.Has(ENTITY_STUCK));
+  hashValue(hash, ball.Has(ENTITY_STICKY));
+  hashValue(hash, ball.Has(ENTITY_PASS_THROUGH));
+  hashValue(hash, this->BallCount() - 1);
+  for (std::size_t i = 0; i < entities.Colliders.Size(); i++)
+  {
+    Entity extra = entities.Colliders.Entities()[i];
+    if (extra != this->Ball)
+    {
+      hashEntity(hash, entities, extra);
+      hashValue(hash, entities.Tags.Get(extra).Has(ENTITY_STUCK));
+    }
+  }
+
+  // streaming 레벨은 resident window 의 brick 만 hashing (window 위치는 Ball 위치로부터 정해지므로 따로 hashing 하지 않음)
+  const GameLevel &level = this->Levels[this->Level];
+  for (unsigned int i = level.FirstCell(); i < level.EndCell(); i++)
+  {
+    if (level.TileCode(i) != 0)
+    {
+      hashValue(hash, !level.IsAlive(i));
+    }
+  }
+  for (std::size_t i = 0; i < entities.Lifetimes.Size(); i++)
+  {
+    Entity powerUp = entities.Lifetimes.Entities()[i];
+    hashEntity(hash, entities, powerUp);
+    hashValue(hash, this->Timers.Remaining(entities.Lifetimes.Data()[i].Timer));
+    hashValue(hash, entities.Tags.Get(powerUp).Has(ENTITY_ACTIVATED));
+    for (const char *c = GetPowerUpDefinition(entities.PowerUpTypes.Get(powerUp)).Name; *c != '\0'; c++)
+    {
+      hashValue(hash, *c);
+    }
+  }
+  return hash;
+}
+
+void Game::Init(const char *manifest)
+{
+  // manifest 에 나열된 레벨 파일을 한 번씩만 파싱하여 각 단계별 GameLevel 을 제자리에서 로드 (이후 ResetLevel() 은 파일을 다시 읽지 않음)
+  // -> streaming 레벨은 header 만 읽고, brick 은 카메라 주변의 chunk 만 필요할 때 읽음
+  std::vector<LevelManifestEntry> levelFiles;
+  LevelError error;
+  if (!ReadLevelManifest(manifest, levelFiles, error))
+  {
+    // level index 가 항상 유효하도록 빈 레벨 하나로 진행 (BatchEnv 등은 brick 개수로 로드 실패를 확인함)
+    std::cout << "ERROR::GAME: Failed to read level manifest " << manifest << ": " << error.Message << std::endl;
+    levelFiles.assign(1, LevelManifestEntry());
+  }
+  this->Levels.clear();
+  this->Levels.resize(levelFiles.size());
+  for (std::size_t i = 0; i < levelFiles.size(); i++)
+  {
+    if (levelFiles[i].Stream)
+    {
+      this->Levels[i].Stream(levelFiles[i].File.c_str(), this->Width, this->Height / 2);
+    }
+    else if (!levelFiles[i].File.empty())
+    {
+      this->Levels[i].Load(levelFiles[i].File.c_str(), this->Width, this->Height / 2);
+    }
+  }
+
+  // 현재 게임 level 을 1단계로 초기화
   this->Level = 0;
 
   // player paddle 시작 위치가 화면 하단 중앙에 오도록 screen space 기준 2D Sprite 좌상단 위치값 계산
-  // -> player paddle 객체를 GameObject 인스턴스로 동적 할당 생성
+  this->Entities.Clear();
+  this->Timers.Clear();
+  this->Entities.Reserve(ENTITY_POOL_CAPACITY);
+  this->Timers.Reserve(TIMER_POOL_CAPACITY);
+  this->firedTimers.reserve(TIMER_POOL_CAPACITY);
+  this->Effects.ShakeTimer = NULL_TIMER;
+  std::fill(this->ActivePowerUps, this->ActivePowerUps + POWERUP_TYPE_COUNT, 0u);
   glm::vec2 playerPos = glm::vec2(this->Width / 2.0f - PLAYER_SIZE.x / 2.0f, this->Height - PLAYER_SIZE.y);
-  Player = new GameObejct(playerPos, PLAYER_SIZE, ResourceManager::GetTexture("paddle"));
+  this->Player = this->Entities.Create();
+  this->Entities.Transforms.Add(this->Player, TransformComponent(playerPos, PLAYER_SIZE));
+  this->Entities.Sprites.Add(this->Player, SpriteComponent());
+  this->Entities.Tags.Add(this->Player, TagComponent(ENTITY_PADDLE, 0));
 
-  // ball 시작 위치가 player paddle 중앙 윗쪽에 오도록 screen space 기준 2D Sprite 좌상단 위치값 계산
-  // -> ball 객체를 BallObject 인스턴스로 동적 할당 생성
+  // ball 시작 위치가 player paddle 중앙 윗쪽에 오도록 screen space 기준 2D Sprite 좌상단 위치값 계산 (paddle 에 고정된 상태로 시작)
   glm::vec2 ballPos = playerPos + glm::vec2(PLAYER_SIZE.x / 2.0f - BALL_RADIUS, -BALL_RADIUS * 2.0f);
-  Ball = new BallObject(ballPos, BALL_RADIUS, INITIAL_BALL_VELOCITY, ResourceManager::GetTexture("face"));
-
-  // irrKlang 라이브러리로 배경음 무한 재생
-  SoundEngine->play2D("resources/audio/breakout.mp3");
+  this->Ball = this->spawnBall(ballPos, BALL_RADIUS, INITIAL_BALL_VELOCITY, ENTITY_STUCK);
+  this->updateView();
 }
 
 void Game::Update(float dt)
 {
-  Ball->Move(dt, this->Width);
+  PROFILE_SCOPE("Game::Update");
 
-  // 매 프레임마다 ball 과의 충돌 검사
-  this->DoCollisions();
+  // 매 프레임마다 ball 이동 및 충돌 처리
+  this->DoCollisions(dt);
 
-  // 매 프레임마다 각 particle 재생성 및 업데이트
-  Particles->Update(dt, *Ball, 2, glm::vec2(Ball->Radius / 2.0f));
+  // 이번 tick 에 만료된 timer 처리 (shake 효과, powerup 지속시간) -> 만료되지 않은 timer 는 건드리지 않음
+  this->firedTimers.clear();
+  this->Timers.Advance(dt, this->firedTimers);
+  for (const TimerEvent &event : this->firedTimers)
+  {
+    this->onTimer(event);
+  }
 
   // 매 프레임마다 각 powerup 아이템 업데이트
   this->UpdatePowerUps(dt);
 
-  // 매 프레임마다 shake 효과 지속시간 업데이트
-  if (ShakeTime > 0.0f)
+  // 화면 아래로 떨어진 extra ball 은 수명 감소 없이 제거
+  Entity next = NULL_ENTITY;
+  for (std::size_t i = 0; i < this->Entities.Colliders.Size(); i++)
   {
-    // solid collision 발생으로 shake 효과 지속시간 reset 되었을 시, 매 프레임마다 지속시간 감소
-    ShakeTime -= dt;
-
-    // 지속시간이 0.0 에 도달했을 경우 shake 효과 비활성화 -> reset 한 지속시간만큼 shake 효과 유지
-    if (ShakeTime <= 0.0f)
+    Entity ball = this->Entities.Colliders.Entities()[i];
+    if (ball == this->Ball)
+    {
+      continue;
+    }
+    if (this->Entities.Transforms.Get(ball).Position.y >= this->Height)
+    {
+      this->Entities.Destroy(ball);
+    }
+    else if (next == NULL_ENTITY)
     {
-      Effects->Shake = false;
+      next = ball;
     }
   }
 
+  // Ball 이 떨어졌어도 extra ball 이 남아있다면, 가장 먼저 추가된 extra ball 이 Ball 역할을 이어받음 (Ball 에 적용된 powerup 상태는 유지)
+  if (this->Entities.Transforms.Get(this->Ball).Position.y >= this->Height && next != NULL_ENTITY)
+  {
+    const TagComponent &ball = this->Entities.Tags.Get(this->Ball);
+    TagComponent &tag = this->Entities.Tags.Get(next);
+    tag.Set(ENTITY_STICKY, ball.Has(ENTITY_STICKY));
+    tag.Set(ENTITY_PASS_THROUGH, ball.Has(ENTITY_PASS_THROUGH));
+    this->Entities.Sprites.Get(next).Color = this->Entities.Sprites.Get(this->Ball).Color;
+    this->Entities.Destroy(this->Ball);
+    this->Ball = next;
+  }
+  this->Entities.Flush();
+
   // ball 아래쪽 모서리 충돌 시 game over -> 게임 리셋 처리
-  if (Ball->Position.y >= this->Height)
+  if (this->Entities.Transforms.Get(this->Ball).Position.y >= this->Height)
   {
     // 수명을 계속 감소시키다가 수명이 남아있지 않으면 GAME_MENU(게임 level 선택창) 상태로 전환
     --this->Lives;
@@ -162,13 +236,29 @@ void Game::Update(float dt)
     // 게임 진행 상태에서 모든 non-solid block 을 파괴했다면, level 및 player 를 reset 하고, 게임 상태를 GAME_WIN 으로 변경
     this->ResetLevel();
     this->ResetPlayer();
-    Effects->Chaos = true;
+    this->Effects.Chaos = true;
     this->State = GAME_WIN;
   }
+
+  this->updateView();
+}
+
+void Game::updateView()
+{
+  // view 가 brick 영역 맨 위(일반 레벨은 0)와 화면 아래쪽 모서리 사이에 머물도록 Ball 을 따라 이동
+  GameLevel &level = this->Levels[this->Level];
+  const TransformComponent &ball = this->Entities.Transforms.Get(this->Ball);
+  float radius = this->Entities.Colliders.Get(this->Ball).Radius;
+  this->View.FollowY(ball.Position.y + radius, std::min(0.0f, level.Top()), static_cast<float>(this->Height));
+
+  // 카메라 주변 chunk 로 streaming window 이동 (일반 레벨은 아무것도 하지 않음)
+  level.UpdateStreaming(this->View.ViewMin().y, this->View.ViewMax().y);
 }
 
 void Game::ProcessInput(float dt)
 {
+  PROFILE_SCOPE("Game::ProcessInput");
+
   // 현재 게임 상태가 GAME_ACTIVE 인 경우 사용자 입력 처리
   if (this->State == GAME_ACTIVE)
   {
@@ -183,41 +273,44 @@ void Game::ProcessInput(float dt)
      * 기초적인 물리 공식을 활용한 예시
      */
     float velocity = PLAYER_VELOCITY * dt;
+    TransformComponent &player = this->Entities.Transforms.Get(this->Player);
+    TransformComponent &ball = this->Entities.Transforms.Get(this->Ball);
+    TagComponent &ballTag = this->Entities.Tags.Get(this->Ball);
 
     // A 키 입력 시 player paddle 좌측 이동
-    if (this->Keys[GLFW_KEY_A])
+    if (this->Keys[GAME_KEY_A])
     {
       // 좌측 이동 시, player paddle 이 화면 왼쪽 모서리를 넘어가지 않도록 x축 위치값(= 2D Sprite 좌상단 정점의 x좌표값) 범위 제한
-      if (Player->Position.x >= 0.0f)
+      if (player.Position.x >= 0.0f)
       {
-        Player->Position.x -= velocity;
+        player.Position.x -= velocity;
 
         // ball 이 player paddle 에 고정되어 있을 경우, player paddle 을 따라가도록 이동
-        if (Ball->Stuck)
+        if (ballTag.Has(ENTITY_STUCK))
         {
-          Ball->Position.x -= velocity;
+          ball.Position.x -= velocity;
         }
       }
     }
     // D 키 입력 시 player paddle 우측 이동
-    if (this->Keys[GLFW_KEY_D])
+    if (this->Keys[GAME_KEY_D])
     {
       // 우측 이동 시, player paddle 이 화면 오른쪽 모서리를 넘어가지 않도록 x축 위치값(= 2D Sprite 좌상단 정점의 x좌표값) 범위 제한
-      if (Player->Position.x <= this->Width - Player->Size.x)
+      if (player.Position.x <= this->Width - player.Size.x)
       {
-        Player->Position.x += velocity;
+        player.Position.x += velocity;
 
         // ball 이 player paddle 에 고정되어 있을 경우, player paddle 을 따라가도록 이동
-        if (Ball->Stuck)
+        if (ballTag.Has(ENTITY_STUCK))
         {
-          Ball->Position.x += velocity;
+          ball.Position.x += velocity;
         }
       }
     }
     // Space 키 입력 시 ball 을 player paddle 에서 분리
-    if (this->Keys[GLFW_KEY_SPACE])
+    if (this->Keys[GAME_KEY_SPACE])
     {
-      Ball->Stuck = false;
+      ballTag.Set(ENTITY_STUCK, false);
     }
   }
 
@@ -226,539 +319,584 @@ void Game::ProcessInput(float dt)
   {
     // 키 입력 처리 상태(= this->KeysProcessed)도 확인하여 키 입력 중복 처리 방지
     // Enter 키 입력 시 선택된 Game Level 에서 게임 시작
-    if (this->Keys[GLFW_KEY_ENTER] && !this->KeysProcessed[GLFW_KEY_ENTER])
+    if (this->Keys[GAME_KEY_ENTER] && !this->KeysProcessed[GAME_KEY_ENTER])
     {
       this->State = GAME_ACTIVE;
-      this->KeysProcessed[GLFW_KEY_ENTER] = true;
+      this->KeysProcessed[GAME_KEY_ENTER] = true;
     }
     // W 또는 S 키 입력 시 원하는 Game Level 선택하도록 스크롤
-    if (this->Keys[GLFW_KEY_W] && !this->KeysProcessed[GLFW_KEY_W])
+    if (this->Keys[GAME_KEY_W] && !this->KeysProcessed[GAME_KEY_W])
     {
-      this->Level = (this->Level + 1) % 4; // level 을 0 -> 3 순으로 증가시킴
-      this->KeysProcessed[GLFW_KEY_W] = true;
+      this->Level = (this->Level + 1) % static_cast<unsigned int>(this->Levels.size()); // level 을 0 -> 마지막 level 순으로 증가시킴
+      this->KeysProcessed[GAME_KEY_W] = true;
     }
-    if (this->Keys[GLFW_KEY_S] && !this->KeysProcessed[GLFW_KEY_S])
+    if (this->Keys[GAME_KEY_S] && !this->KeysProcessed[GAME_KEY_S])
     {
-      // level 을 3 -> 0 순으로 감소시킴
+      // level 을 마지막 level -> 0 순으로 감소시킴
       if (this->Level > 0)
       {
         --this->Level;
       }
       else
       {
-        this->Level = 3;
+        this->Level = static_cast<unsigned int>(this->Levels.size()) - 1;
       }
-      this->KeysProcessed[GLFW_KEY_S] = true;
+      this->KeysProcessed[GAME_KEY_S] = true;
     }
   }
 
   // 현재 게임 상태가 GAME_WIN 인 경우 사용자 입력 처리
   if (this->State == GAME_WIN)
   {
-    if (this->Keys[GLFW_KEY_ENTER])
+    if (this->Keys[GAME_KEY_ENTER])
     {
       // Enter 키 입력 시 게임을 다시 시작할 수 있도록 GAME_MENU 상태로 변경
-      this->KeysProcessed[GLFW_KEY_ENTER] = true;
-      Effects->Chaos = false;
+      this->KeysProcessed[GAME_KEY_ENTER] = true;
+      this->Effects.Chaos = false;
       this->State = GAME_MENU;
     }
   }
 }
 
-void Game::Render()
+void Game::ResetLevel()
 {
-  // 모든 게임 상태에서 항상 처리해야 할 렌더링 로직
-  if (this->State == GAME_ACTIVE || this->State == GAME_MENU || this->State == GAME_WIN)
-  {
-    // multisampled 프레임버퍼에 scene 요소 렌더링 직전 처리
-    Effects->BeginRender();
+  // 현재 게임 level 의 brick 배치를 로드 직후 상태로 복원 (파일을 다시 읽지 않고 template 복사)
+  this->Levels[this->Level].Reset();
 
-    // 배경을 2D Sprite 로 렌더링
-    Renderer->DrawSprite(
-        ResourceManager::GetTexture("background"), glm::vec2(0.0f, 0.0f), glm::vec2(this->Width, this->Height), 0.0f);
+  // 이전 level 에서 생성된 powerup 은 새 level 로 넘어가지 않음
+  this->clearPowerUps();
 
-    // 현재 게임 level 에 대응되는 GameLevel draw call 호출
-    this->Levels[this->Level].Draw(*Renderer);
-
-    // playder paddle draw call 호출
-    Player->Draw(*Renderer);
+  // 수명이 남아있지 않을 때 게임 level reset 되므로, 이후 새롭게 시작할 게임을 위해 수명을 다시 채움
+  this->Lives = 3;
+};
 
-    // powerup draw call 호출 (아직 파괴되지 않은 PowerUp 들만 렌더링)
-    for (PowerUp &powerUp : this->PowerUps)
+void Game::ResetPlayer()
+{
+  // Player 및 Ball 의 component 와 상태 flag 를 모두 초기화함(Game::Init() 함수 참고)
+  TransformComponent &player = this->Entities.Transforms.Get(this->Player);
+  player.Size = PLAYER_SIZE;
+  player.Position = glm::vec2(this->Width / 2.0f - PLAYER_SIZE.x / 2.0f, this->Height - PLAYER_SIZE.y);
+  this->Entities.Transforms.Get(this->Ball).Position = player.Position + glm::vec2(PLAYER_SIZE.x / 2.0f - BALL_RADIUS, -(BALL_RADIUS * 2.0f));
+  this->Entities.Velocities.Get(this->Ball) = INITIAL_BALL_VELOCITY;
+
+  // PowerUp 습득에 의해 변경된 게임 상태 모두 rollback (ball 은 다시 paddle 에 고정)
+  this->Effects.Chaos = false;
+  this->Effects.Confuse = false;
+  this->Entities.Tags.Get(this->Ball).Flags = ENTITY_STUCK;
+  this->Entities.Sprites.Get(this->Player).Color = glm::vec3(1.0f);
+  this->Entities.Sprites.Get(this->Ball).Color = glm::vec3(1.0f);
+
+  // multi-ball 로 추가된 ball 제거
+  for (std::size_t i = 0; i < this->Entities.Colliders.Size(); i++)
+  {
+    Entity ball = this->Entities.Colliders.Entities()[i];
+    if (ball != this->Ball)
     {
-      if (!powerUp.Destroyed)
-      {
-        powerUp.Draw(*Renderer);
-      }
+      this->Entities.Destroy(ball);
     }
+  }
+  this->Entities.Flush();
 
-    // particle draw call 호출 -> particle 은 ball 을 따라다니는 잔상 효과이므로, 다른 오브젝트들보다는 위에 그리지만, ball 을 가리지 않도록 그보다는 먼저 그림
-    Particles->Draw();
-
-    // ball draw call 호출
-    Ball->Draw(*Renderer);
-
-    // multisampled 프레임버퍼에 렌더링된 결과를 intermediate 프레임버퍼에 blit 으로 복사
-    Effects->EndRender();
-
-    // intermediate 프레임버퍼 렌더링 결과에 post processing 적용 후 2D Quad 렌더링
-    Effects->Render(glfwGetTime());
+  // 낙하 중이거나 효과가 적용 중인 powerup 제거 (효과는 위에서 모두 rollback 했으므로 만료 처리 없이 timer 만 취소)
+  this->clearPowerUps();
+};
 
-    // std::stringstream 의 메모리 기반 버퍼에 현재 남은 수명값을 복사
-    std::stringstream ss;
-    ss << this->Lives;
-    // 버퍼에 저장된 남은 수명값을 std::string 에 복사 후 반환하여 text rendering
-    Text->RenderText("Lives:" + ss.str(), 5.0f, 5.0f, 1.0f);
-  }
+// 매 프레임마다 컨테이너 저장된 PowerUp 아이템 업데이트
+void Game::UpdatePowerUps(float dt)
+{
+  PROFILE_SCOPE("Game::UpdatePowerUps");
 
-  // GAME_MENU 상태일 때에만 추가로 처리해야 할 렌더링 로직
-  if (this->State == GAME_MENU)
+  // powerup entity(= Lifetime component 를 가진 entity) 순회 -> 생성된 PowerUp 아래로 떨어지도록 위치 업데이트
+  // (효과 지속시간 만료는 Game::Timers 가 처리하므로 여기서는 검사하지 않음)
+  EntityRegistry &entities = this->Entities;
+  for (std::size_t i = 0; i < entities.Lifetimes.Size(); i++)
   {
-    Text->RenderText("Press ENTER to start", 250.0f, this->Height / 2.0f, 1.0f);
-    Text->RenderText("Press W or S to select level", 245.0f, this->Height / 2.0f + 20.0f, 0.75f);
+    Entity powerUp = entities.Lifetimes.Entities()[i];
+    entities.Transforms.Get(powerUp).Position += entities.Velocities.Get(powerUp) * dt;
   }
 
-  // GAME_WIN 상태일 때에만 추가로 처리해야 할 렌더링 로직
-  if (this->State == GAME_WIN)
+  // 파괴 처리 및 비활성화된 powerup entity 제거 (모든 component 배열에서 한 번에 제거하고, 남은 powerup 들의 순서는 유지)
+  for (std::size_t i = 0; i < entities.Lifetimes.Size(); i++)
   {
-    Text->RenderText("You WON!!", 320.0f, this->Height / 2.0f - 20.0f, 1.0f, glm::vec3(0.0f, 1.0f, 0.0f));
-    Text->RenderText("Press ENTER to retry or ESC to quit", 130.0f, this->Height / 2.0f, 1.0f, glm::vec3(1.0f, 1.0f, 0.0f));
+    Entity powerUp = entities.Lifetimes.Entities()[i];
+    const TagComponent &tag = entities.Tags.Get(powerUp);
+    if (tag.Has(ENTITY_DESTROYED) && !tag.Has(ENTITY_ACTIVATED))
+    {
+      entities.Destroy(powerUp);
+    }
   }
-}
+  entities.Flush();
+};
 
-void Game::ResetLevel()
+// PowerUp 랜덤 생성 함수
+void Game::SpawnPowerUps(glm::vec2 position)
 {
-  // 현재 게임 level 에 대응되는 .lvl 파일을 다시 로드하여 GameLevel::Bricks 컨테이너를 초기화함
-  if (this->Level == 0)
+  // 정의 표 순서대로 타입마다 생성 확률 계산 (gameplay 난수열 사용 -> 같은 seed 로 재생하면 같은 PowerUp 이 생성됨)
+  // -> powerup pool 이 가득 차도 난수는 그대로 뽑음. (pool 크기를 바꿔도 이후 난수열이 달라지지 않도록)
+  for (unsigned int type = 0; type < POWERUP_TYPE_COUNT; type++)
   {
-    this->Levels[0].Load("resources/levels/one.lvl", this->Width, this->Height / 2);
-  }
-  else if (this->Level == 1)
-  {
-    this->Levels[1].Load("resources/levels/two.lvl", this->Width, this->Height / 2);
-  }
-  else if (this->Level == 2)
-  {
-    this->Levels[2].Load("resources/levels/three.lvl", this->Width, this->Height / 2);
-  }
-  else if (this->Level == 3)
-  {
-    this->Levels[3].Load("resources/levels/four.lvl", this->Width, this->Height / 2);
+    if (this->Rng.OneIn(POWERUP_DEFINITIONS[type].SpawnChance) && this->Entities.Lifetimes.Size() < MAX_POWERUPS)
+    {
+      this->spawnPowerUp(static_cast<PowerUpType>(type), position);
+    }
   }
-
-  // 수명이 남아있지 않을 때 게임 level reset 되므로, 이후 새롭게 시작할 게임을 위해 수명을 다시 채움
-  this->Lives = 3;
 };
 
-void Game::ResetPlayer()
+void Game::SpawnBalls(unsigned int count)
 {
-  // Player 및 Ball 의 멤버변수와 상태값을 모두 초기화함(Game::Init() 함수 참고)
-  Player->Size = PLAYER_SIZE;
-  Player->Position = glm::vec2(this->Width / 2.0f - PLAYER_SIZE.x / 2.0f, this->Height - PLAYER_SIZE.y);
-  Ball->Reset(Player->Position + glm::vec2(PLAYER_SIZE.x / 2.0f - BALL_RADIUS, -(BALL_RADIUS * 2.0f)), INITIAL_BALL_VELOCITY);
-
-  // PowerUp 습득에 의해 변경된 게임 상태 모두 rollback
-  Effects->Chaos = false;
-  Effects->Confuse = false;
-  Ball->PassThrough = false;
-  Ball->Sticky = false;
-  Player->Color = glm::vec3(1.0f);
-  Ball->Color = glm::vec3(1.0f);
-};
+  // paddle 에 붙어있는 Ball 에서 추가할 때는 발사 방향(초기 속도) 기준 (ball 추가 시 component 배열이 재할당될 수 있으므로 값으로 복사해 둠)
+  glm::vec2 position = this->Entities.Transforms.Get(this->Ball).Position;
+  float radius = this->Entities.Colliders.Get(this->Ball).Radius;
+  glm::vec2 velocity = this->Entities.Tags.Get(this->Ball).Has(ENTITY_STUCK) ? INITIAL_BALL_VELOCITY : this->Entities.Velocities.Get(this->Ball);
+  float speed = glm::length(velocity);
+  float heading = std::atan2(velocity.y, velocity.x);
 
-// 특정 타입의 powerup 활성화 여부 검사 함수 전방선언
-bool IsOtherPowerUpActive(std::vector<PowerUp> &powerUps, std::string type);
+  // Ball 이동방향 기준 -60 ~ +60 도 범위를 (count + 1) 등분한 방향으로 추가 -> Ball 과 같은 방향은 피함
+  for (unsigned int i = 0; i < count; i++)
+  {
+    float angle = heading + glm::radians(-60.0f + 120.0f * (i + 1.0f) / (count + 1.0f));
+    this->spawnBall(position, radius, glm::vec2(std::cos(angle), std::sin(angle)) * speed, 0);
+  }
+}
 
-// 매 프레임마다 컨테이너 저장된 PowerUp 아이템 업데이트
-void Game::UpdatePowerUps(float dt)
+void Game::ReserveBalls(unsigned int count)
 {
-  // 생성된 PowerUp 아이템이 저장된 컨테이너 순회
-  for (PowerUp &powerUp : this->PowerUps)
-  {
-    // 생성된 PowerUp 아래로 떨어지도록 위치 업데이트
-    powerUp.Position += powerUp.Velocity * dt;
+  this->Entities.Reserve(ENTITY_POOL_CAPACITY + count);
+}
 
-    // player paddle 과 충돌하여 현재 활성화된 PowerUp 만 순회 -> 활성화 시점에 파괴되어 화면에는 안보이는 상태
-    if (powerUp.Activated)
-    {
-      // effect 지속시간을 계속 감소시킴.
-      powerUp.Duration -= dt;
+Entity Game::spawnBall(glm::vec2 position, float radius, glm::vec2 velocity, unsigned int flags)
+{
+  Entity ball = this->Entities.Create();
+  this->Entities.Transforms.Add(ball, TransformComponent(position, glm::vec2(radius * 2.0f, radius * 2.0f)));
+  this->Entities.Velocities.Add(ball, velocity);
+  this->Entities.Sprites.Add(ball, SpriteComponent());
+  this->Entities.Colliders.Add(ball, ColliderComponent(radius));
+  this->Entities.Tags.Add(ball, TagComponent(ENTITY_BALL, flags));
+  return ball;
+}
 
-      // 지속시간이 만료된 PowerUp 이 존재한다면, 변경된 게임 상태를 rollback 해서 비활성화함.
-      if (powerUp.Duration <= 0.0f)
-      {
-        powerUp.Activated = false;
+void Game::spawnPowerUp(PowerUpType type, glm::vec2 position)
+{
+  const PowerUpDefinition &definition = GetPowerUpDefinition(type);
+  Entity powerUp = this->Entities.Create();
+  this->Entities.Transforms.Add(powerUp, TransformComponent(position, POWERUP_SIZE));
+  this->Entities.Velocities.Add(powerUp, POWERUP_VELOCITY);
+  this->Entities.Sprites.Add(powerUp, SpriteComponent(definition.Color));
+  this->Entities.Lifetimes.Add(powerUp, LifetimeComponent(definition.Duration));
+  this->Entities.Tags.Add(powerUp, TagComponent(ENTITY_POWERUP, 0));
+  this->Entities.PowerUpTypes.Add(powerUp, type);
+}
 
-        // PowerUp 타입에 따라 변경된 게임 상태를 rollback 처리 (지속시간이 0.0f(무한대)인 PowerUp 은 생략)
-        if (powerUp.Type == "sticky")
-        {
-          // 해당 타입의 effect 가 활성화되어 있을 때, 동일한 타입의 PowerUp 을 습득했는지 검사
-          // -> 만약 그랬다면 rollback 처리를 생략함. (하단 필기 참고)
-          if (!IsOtherPowerUpActive(this->PowerUps, "sticky"))
-          {
-            Ball->Sticky = false;
-            Player->Color = glm::vec3(1.0f);
-          }
-        }
-        else if (powerUp.Type == "pass-through")
-        {
-          if (!IsOtherPowerUpActive(this->PowerUps, "pass-through"))
-          {
-            Ball->PassThrough = false;
-            Ball->Color = glm::vec3(1.0f);
-          }
-        }
-        else if (powerUp.Type == "confuse")
-        {
-          if (!IsOtherPowerUpActive(this->PowerUps, "confuse"))
-          {
-            Effects->Confuse = false;
-          }
-        }
-        else if (powerUp.Type == "chaos")
-        {
-          if (!IsOtherPowerUpActive(this->PowerUps, "chaos"))
-          {
-            Effects->Chaos = false;
-          }
-        }
-      }
-    }
+void Game::clearPowerUps()
+{
+  for (std::size_t i = 0; i < this->Entities.Lifetimes.Size(); i++)
+  {
+    this->Timers.Cancel(this->Entities.Lifetimes.Data()[i].Timer);
+    this->Entities.Destroy(this->Entities.Lifetimes.Entities()[i]);
   }
+  this->Entities.Flush();
+  std::fill(this->ActivePowerUps, this->ActivePowerUps + POWERUP_TYPE_COUNT, 0u);
+}
 
-  // 컨테이너에 남아있는 powerup 중에서 파괴 처리 및 비활성회된 아이템 제거 (관련 std::vector 문법 필기 참고)
-  this->PowerUps.erase(std::remove_if(this->PowerUps.begin(), this->PowerUps.end(), [](const PowerUp &powerUp)
-                                      { return powerUp.Destroyed && !powerUp.Activated; }),
-                       this->PowerUps.end());
-};
+GamePoolUsage Game::PoolUsage() const
+{
+  GamePoolUsage usage;
+  usage.EntityHighWater = this->Entities.HighWater();
+  usage.EntityReserved = this->Entities.Reserved();
+  usage.PowerUpHighWater = static_cast<unsigned int>(this->Entities.Lifetimes.HighWater());
+  usage.PowerUpCapacity = MAX_POWERUPS;
+  usage.TimerHighWater = this->Timers.HighWater();
+  usage.TimerCapacity = TIMER_POOL_CAPACITY;
+  usage.ContactHighWater = this->contactHighWater;
+  return usage;
+}
 
-// 각 PowerUp 아이템 생성 확률 계산 함수
-bool ShouldSpawn(unsigned int chance)
+// PowerUp 아이템 습득 시 타입에 따른 게임 상태 변경
+void Game::activatePowerUp(PowerUpType type)
 {
-  unsigned int random = std::rand() % chance; // [0, chance] 범위 난수 생성
-  return random == 0;                         // 생성된 난수의 값이 0일 확률 -> 1/chance 확률로 PowerUp 아이템 생성 여부 결정
+  GetPowerUpDefinition(type).Activate(*this);
+  this->ActivePowerUps[type]++;
 }
 
-// PowerUp 랜덤 생성 함수
-void Game::SpawnPowerUps(GameObejct &block)
+// PowerUp 지속시간 만료 시 활성화 개수 감소 -> 같은 타입의 활성화된 PowerUp 이 더 이상 없으면 rollback (영구 적용 PowerUp 은 생략)
+void Game::deactivatePowerUp(PowerUpType type)
 {
-  // positive powerups 는 1/75 확률로 아이템 생성
-  if (ShouldSpawn(75))
-  {
-    // 지속시간 0.0f 으로 전달 시 변경된 게임 상태 영구 적용.
-    this->PowerUps.push_back(PowerUp("speed", glm::vec3(0.5f, 0.5f, 1.0f), 0.0f, block.Position, ResourceManager::GetTexture("powerup_speed")));
-  }
-  if (ShouldSpawn(75))
-  {
-    this->PowerUps.push_back(PowerUp("sticky", glm::vec3(1.0f, 0.5f, 1.0f), 20.0f, block.Position, ResourceManager::GetTexture("powerup_sticky")));
-  }
-  if (ShouldSpawn(75))
-  {
-    this->PowerUps.push_back(PowerUp("pass-through", glm::vec3(0.5f, 1.0f, 0.5f), 10.0f, block.Position, ResourceManager::GetTexture("powerup_passthrough")));
-  }
-  if (ShouldSpawn(75))
+  if (--this->ActivePowerUps[type] == 0 && GetPowerUpDefinition(type).Deactivate != nullptr)
   {
-    // 지속시간 0.0f 으로 전달 시 변경된 게임 상태 영구 적용.
-    this->PowerUps.push_back(PowerUp("pad-size-increase", glm::vec3(1.0f, 0.6f, 0.4f), 0.0f, block.Position, ResourceManager::GetTexture("powerup_increase")));
+    GetPowerUpDefinition(type).Deactivate(*this);
   }
+}
 
-  // negative powerups 는 1/15 확률로 아이템 생성 -> 더 자주 생성
-  if (ShouldSpawn(15))
+void Game::onTimer(const TimerEvent &event)
+{
+  if (event.Kind == GAME_TIMER_SHAKE)
   {
-    this->PowerUps.push_back(PowerUp("confuse", glm::vec3(1.0f, 0.3f, 0.3f), 15.0f, block.Position, ResourceManager::GetTexture("powerup_confuse")));
+    // reset 한 지속시간만큼 shake 효과 유지 후 비활성화
+    this->Effects.Shake = false;
+    this->Effects.ShakeTimer = NULL_TIMER;
   }
-  if (ShouldSpawn(15))
+  else if (event.Kind == GAME_TIMER_POWERUP && this->Entities.IsAlive(event.Payload))
   {
-    this->PowerUps.push_back(PowerUp("chaos", glm::vec3(0.9f, 0.25f, 0.25f), 15.0f, block.Position, ResourceManager::GetTexture("powerup_chaos")));
+    // 지속시간이 만료된 PowerUp 비활성화 -> 같은 타입의 다른 powerup 이 아직 활성화되어 있지 않을 때만 변경된 게임 상태를 rollback 처리 (하단 필기 참고)
+    Entity powerUp = event.Payload;
+    this->Entities.Tags.Get(powerUp).Set(ENTITY_ACTIVATED, false);
+    this->Entities.Lifetimes.Get(powerUp).Timer = NULL_TIMER;
+    this->deactivatePowerUp(this->Entities.PowerUpTypes.Get(powerUp));
   }
-};
+}
 
-// PowerUp 아이템 습득 시 타입에 따른 게임 상태 변경
-void ActivatePowerUp(PowerUp &powerUp)
+void Game::playSound(GameSound sound)
 {
-  if (powerUp.Type == "speed")
+  // 오디오 장치가 없는 환경(headless 시뮬레이션, 렌더링 없는 재생 등)에서는 효과음 생략
+  if (this->Audio != nullptr)
   {
-    Ball->Velocity *= 1.2f;
+    this->Audio->Play(sound);
   }
-  else if (powerUp.Type == "sticky")
+}
+
+void Game::DoCollisions(float dt)
+{
+  PROFILE_SCOPE("Game::DoCollisions");
+
+  /**
+   * Ball 이동 및 Ball - 벽 / Brick / Player Paddle 충돌 처리
+   *
+   * 1. 모든 ball 을 이번 tick 시작 시점의 brick 상태를 기준으로 이동시킴.
+   *    -> ball 끼리는 서로의 결과를 읽지 않으므로, ball 이 많으면 연속된 구간으로 나누어 worker 스레드들이 동시에 진행함.
+   *    -> brick 파괴, PowerUp 생성, 효과음처럼 공유 상태를 바꾸는 처리는 구간별 접촉 기록(conflict buffer)에 모아 둠.
+   * 2. 접촉 기록을 ball 번호 순서대로 반영함.
+   *    -> 같은 brick 에 여러 ball 이 닿았다면 번호가 가장 작은 ball 만 brick 을 파괴함. (나머지 ball 은 반사만 됨)
+   *    -> 스레드 개수나 구간 분할과 무관하게 항상 같은 결과이므로, 입력 기록 재생 결과(StateHash)가 달라지지 않음.
+   */
+  unsigned int total = this->BallCount();
+  unsigned int chunks = 1;
+  if (this->Workers != nullptr && total >= MIN_BALLS_PER_CHUNK * 2)
   {
-    Ball->Sticky = true;                         // uber 클래스 내에서 Ball 관련 게임 로직 변경을 위해 상태 변경
-    Player->Color = glm::vec3(1.0f, 0.5f, 1.0f); // 현재 활성화된 effect 를 강조하기 위해 player paddle 색상 변경
+    chunks = std::min(this->Workers->ThreadCount(), total / MIN_BALLS_PER_CHUNK);
   }
-  else if (powerUp.Type == "pass-through")
+  if (this->sweepScratch.size() < chunks)
   {
-    Ball->PassThrough = true;                  // uber 클래스 내에서 Ball 관련 게임 로직 변경을 위해 상태 변경
-    Ball->Color = glm::vec3(1.0f, 0.5f, 0.5f); // 현재 활성화된 effect 를 강조하기 위해 ball 색상 변경
+    this->sweepScratch.resize(chunks);
   }
-  else if (powerUp.Type == "pad-size-increase")
+
+  // std::function 은 capture 가 포인터 2 개 크기를 넘으면 매번 heap 할당하므로, tick 인자는 지역 구조체로 묶어서 참조로 전달
+  struct SweepJob
   {
-    Player->Size.x += 50;
-  }
-  else if (powerUp.Type == "confuse")
+    float Dt;
+    unsigned int Total, Chunks;
+  } job = {dt, total, chunks};
+  std::function<void(unsigned int)> sweepChunk = [this, &job](unsigned int chunk)
   {
-    /**
-     * post_processing.vs 쉐이더에서 분기문에 의해 chaos 와 confuse 효과는 동시 적용 불가
-     * -> 두 효과의 uv 좌표 계산 방법이 서로 충돌하기 때문!
-     *
-     * 따라서, 상대변 effect 가 비활성화되어 있는지 먼저 검사
-     */
-    if (!Effects->Chaos)
+    if (chunk >= job.Chunks)
     {
-      Effects->Confuse = true;
+      return;
     }
-  }
-  else if (powerUp.Type == "chaos")
-  {
-    if (!Effects->Confuse)
+    PROFILE_SCOPE("Game::sweepBalls");
+    BallSweepScratch &scratch = this->sweepScratch[chunk];
+    scratch.Contacts.clear();
+    unsigned int begin = static_cast<unsigned int>(static_cast<unsigned long long>(job.Total) * chunk / job.Chunks);
+    unsigned int end = static_cast<unsigned int>(static_cast<unsigned long long>(job.Total) * (chunk + 1) / job.Chunks);
+    EntityRegistry &entities = this->Entities;
+    for (unsigned int i = begin; i < end; i++)
     {
-      Effects->Chaos = true;
+      // ball 마다 서로 다른 component 원소만 변경하므로 동시에 진행해도 안전함
+      Entity ball = entities.Colliders.Entities()[i];
+      this->sweepBall(entities.Transforms.Get(ball), entities.Velocities.Get(ball), entities.Tags.Get(ball), entities.Colliders.Data()[i].Radius, i, job.Dt, scratch);
     }
+  };
+  if (chunks > 1)
+  {
+    this->Workers->Run(sweepChunk);
   }
-}
-
-bool IsOtherPowerUpActive(std::vector<PowerUp> &powerUps, std::string type)
-{
-  // 현재 활성화된 PowerUp 아이템들을 순회하면서 특정 타입을 탐색
-  for (const PowerUp &powerUp : powerUps)
+  else
   {
-    if (powerUp.Activated)
-    {
-      if (powerUp.Type == type)
-      {
-        return true;
-      }
-    }
+    sweepChunk(0);
   }
-  return false;
-}
 
-// collision detection 관련 함수 전방선언
-bool checkCollision(GameObejct &one, GameObejct &two);
-Collision checkCollision(BallObject &one, GameObejct &two);
-Direction VectorDirection(glm::vec2 target);
-
-void Game::DoCollisions()
-{
-  // 현재 Level 의 모든 Brick 들을 순회하면서 Ball 과의 충돌 검사
-  for (GameObejct &box : this->Levels[this->Level].Bricks)
+  // 구간 순서 = ball 번호 순서로 접촉 기록 반영 (같은 효과음은 tick 당 한 번만 재생 -> ball 이 많아도 효과음이 겹쳐 쌓이지 않도록)
+  bool soundPlayed[SOUND_COUNT] = {};
+  unsigned int contactCount = 0;
+  for (unsigned int chunk = 0; chunk < chunks; chunk++)
   {
-    // 아직 파괴되지 않은 Brick 들에 대해서만 충돌 검사
-    if (!box.Destroyed)
+    contactCount += static_cast<unsigned int>(this->sweepScratch[chunk].Contacts.size());
+    for (const BallContact &contact : this->sweepScratch[chunk].Contacts)
     {
-      Collision collision = checkCollision(*Ball, box);
-      if (std::get<0>(collision)) // std::get<n>(std::tuple) -> 현재 tuple 데이터쌍에서 n번째 요소를 읽음.
-      {
-        // 현재 Brick 이 non-solid brick 인 경우에만 파괴 상태 업데이트
-        if (!box.IsSolid)
-        {
-          box.Destroyed = true;
-          // non-solid block 파괴 시, 해당 block 자리에 PowerUp 아이템 랜덤 생성
-          this->SpawnPowerUps(box);
-          // non-solid block 충돌 시 효과음 재생
-          SoundEngine->play2D("resources/audio/bleep.mp3", false);
-        }
-        else
-        {
-          // solid block collision 발생 시, shake effect 활성화 및 지속시간 reset
-          ShakeTime = 0.05f;
-          Effects->Shake = true;
-          // solid block 충돌 시 효과음 재생
-          SoundEngine->play2D("resources/audio/solid.wav", false);
-        }
-
-        // -> 왜 solid brick 도 충돌 검사를 할까? solid brick 과 충돌 시 처리할 것도 있으니까!(ex> 이동방향 전환 등)
-        Direction dir = std::get<1>(collision);         // 충돌 방향
-        glm::vec2 diff_vector = std::get<2>(collision); // circle 중점 ~ 가장 가까운 점 P 사이의 거리
-
-        // non-solid block 충돌 시, pass-through 아이템이 활성화되어 있다면 collision resolution(충돌 처리) 무시 -> 충돌한 non-solid block 자리를 뚫고 지나감
-        if (!(Ball->PassThrough && !box.IsSolid))
-        {
-          // 충돌 방향에 따른 충돌 처리
-          if (dir == LEFT || dir == RIGHT) // 수평 방향 충돌 처리
-          {
-            // 공의 수평 이동방향 뒤집기
-            Ball->Velocity.x = -Ball->Velocity.x;
-
-            // Circle - AABB 충돌 시, 수평 방향으로 AABB 내부로 침투한 거리(level of penetration) 계산
-            float penetration = Ball->Radius - std::abs(diff_vector.x);
-
-            // 충돌 방향에 따라 반대 방향으로 침투 거리만큼 relocate -> 충돌한 공이 AABB 내부에 들어가지 못하도록 위치를 재조정한 것!
-            if (dir == LEFT)
-            {
-              Ball->Position.x += penetration;
-            }
-            else
-            {
-              Ball->Position.x -= penetration;
-            }
-          }
-          else // 수직 방향 충돌 처리
-          {
-            // 공의 수직 이동방향 뒤집기
-            Ball->Velocity.y = -Ball->Velocity.y;
-
-            // Circle - AABB 충돌 시, 수직 방향으로 AABB 내부로 침투한 거리(level of penetration) 계산
-            float penetration = Ball->Radius - std::abs(diff_vector.y);
-
-            // 충돌 방향에 따라 반대 방향으로 침투 거리만큼 relocate -> 충돌한 공이 AABB 내부에 들어가지 못하도록 위치를 재조정한 것!
-            if (dir == UP)
-            {
-              Ball->Position.y -= penetration;
-            }
-            else
-            {
-              Ball->Position.y += penetration;
-            }
-          }
-        }
-      }
+      this->applyContact(contact, soundPlayed);
     }
   }
+  this->contactHighWater = std::max(this->contactHighWater, contactCount);
 
   // PowerUp - Player Paddle 충돌 검사
-  for (PowerUp &powerUp : this->PowerUps)
+  for (std::size_t i = 0; i < this->Entities.Lifetimes.Size(); i++)
   {
     // 아직 파괴되지 않은 powerup 들을 순회하며 충돌 검사
-    if (!powerUp.Destroyed)
+    Entity powerUp = this->Entities.Lifetimes.Entities()[i];
+    TagComponent &tag = this->Entities.Tags.Get(powerUp);
+    if (!tag.Has(ENTITY_DESTROYED))
     {
       // 이미 window bottom edge 밑으로 내려간 powerup 은 즉시 파괴
-      if (powerUp.Position.y >= this->Height)
+      const TransformComponent &transform = this->Entities.Transforms.Get(powerUp);
+      if (transform.Position.y >= this->Height)
       {
-        powerUp.Destroyed = true;
+        tag.Set(ENTITY_DESTROYED, true);
       }
 
       // player paddle 과 충돌한 powerup 은 효과 활성화 후 파괴
-      if (checkCollision(*Player, powerUp))
+      if (checkCollision(this->Entities.Transforms.Get(this->Player), transform))
       {
-        ActivatePowerUp(powerUp);
-        powerUp.Destroyed = true;
-        powerUp.Activated = true;
+        // multi-ball 효과로 ball entity 가 추가되면 component 배열이 재할당될 수 있으므로, tag 는 효과 적용 후 다시 조회
+        this->activatePowerUp(this->Entities.PowerUpTypes.Get(powerUp));
+        TagComponent &activated = this->Entities.Tags.Get(powerUp);
+        activated.Set(ENTITY_DESTROYED, true);
+        activated.Set(ENTITY_ACTIVATED, true);
+        // 효과 지속시간 만료 timer 예약 (지속시간 0.0f 인 powerup 은 다음 만료 처리 시점에 바로 비활성화됨)
+        LifetimeComponent &lifetime = this->Entities.Lifetimes.Get(powerUp);
+        lifetime.Timer = this->Timers.Schedule(lifetime.Duration, GAME_TIMER_POWERUP, powerUp);
         // powerup 습득 시 효과음 재생
-        SoundEngine->play2D("resources/audio/powerup.wav", false);
+        this->playSound(SOUND_POWERUP);
       }
     }
   }
+};
 
-  // Ball - Player Paddle 충돌 검사
-  Collision result = checkCollision(*Ball, *Player);
-  if (!Ball->Stuck && std::get<0>(result))
+// Ball - Brick 접촉 시 접촉 면의 법선에 따라 이동방향 뒤집기
+static void reflectOffBrick(glm::vec2 &velocity, glm::vec2 normal)
+{
+  /**
+   * 접촉 면에 따라 이동방향 뒤집기
+   * -> 모서리 접촉은 법선 성분이 더 큰 축을 먼저 뒤집음 (ResolveBallCollision 의 VectorDirection 과 같은 기준, 속력 유지)
+   * -> 그래도 여전히 brick 안쪽을 향하면 나머지 축도 뒤집음 (같은 접촉 지점에서 매번 같은 축만 뒤집으며 멈춰있지 않도록)
+   */
+  bool horizontal = std::abs(normal.x) > std::abs(normal.y);
+  if (horizontal)
+  {
+    velocity.x = -velocity.x;
+  }
+  else
   {
-    /** Ball - Paddle 충돌 처리 */
-    // Ball 충돌 지점이 Paddle 중심에서 떨어진 거리의 비율값(percentage) 계산 -> Paddle 끝부분에 가까울수록 1, 중심에 가까울수록 0
-    float centerBoard = Player->Position.x + Player->Size.x / 2.0f;
-    float distance = (Ball->Position.x + Ball->Radius) - centerBoard;
-    float percentage = distance / (Player->Size.x / 2.0f);
+    velocity.y = -velocity.y;
+  }
+  if (glm::dot(velocity, normal) < 0.0f)
+  {
+    if (horizontal)
+    {
+      velocity.y = -velocity.y;
+    }
+    else
+    {
+      velocity.x = -velocity.x;
+    }
+  }
+}
 
-    // 원래 속도 벡터를 복사해 둠.
-    glm::vec2 oldVelocity = Ball->Velocity;
+void Game::sweepBall(TransformComponent &transform, glm::vec2 &velocity, TagComponent &tag, float radius, unsigned int index, float dt, BallSweepScratch &scratch) const
+{
+  // player paddle 에 고정되어 있지 않은 상태에서만 이동 로직 수행
+  if (tag.Has(ENTITY_STUCK))
+  {
+    return;
+  }
 
-    // Ball 충돌 지점이 Paddle 중심에서 멀수록 x축 속도를 증가시킴
-    float strength = 2.0f;
-    Ball->Velocity.x = INITIAL_BALL_VELOCITY.x * percentage * strength;
+  const GameLevel &level = this->Levels[this->Level];
+  const glm::vec2 brickSize = level.BrickSize();
+  const TransformComponent &player = this->Entities.Transforms.Get(this->Player);
+  scratch.Passed.clear();
 
-    // Paddle 과 충돌할 경우, 수직 이동방향이 항상 위쪽을 향하도록 계산 (수직 이동방향을 뒤집지 않는 이유 하단 필기)
-    Ball->Velocity.y = -1.0f * std::abs(Ball->Velocity.y);
+  // 화면 왼쪽, 오른쪽, 위쪽 모서리를 화면 바깥쪽으로 충분히 두꺼운 AABB 로 취급 (아래쪽 모서리는 game over 판정이므로 막지 않음)
+  // -> 위쪽 모서리는 brick 영역 맨 위 (화면 위로 쌓아 올린 streaming 레벨은 레벨 꼭대기, 그 외에는 0)
+  const float wall = static_cast<float>(this->Width + this->Height);
+  const float top = std::min(0.0f, level.Top());
+  const glm::vec2 wallMin[] = {glm::vec2(-wall, top - wall), glm::vec2(this->Width, top - wall), glm::vec2(-wall, top - wall)};
+  const glm::vec2 wallMax[] = {glm::vec2(0.0f, this->Height + wall), glm::vec2(this->Width + wall, this->Height + wall), glm::vec2(this->Width + wall, top)};
 
-    // 속'력'은 일정하게 유지하도록 속도 벡터의 길이를 원래 속도 벡터와 동일하게 맞춤. -> Ball 충돌 지점에 따라 속도 벡터의 방향만 변경되겠군!
-    Ball->Velocity = glm::normalize(Ball->Velocity) * glm::length(oldVelocity);
+  /**
+   * continuous collision detection
+   *
+   * 한 tick 이동 경로(ball 중점이 지나가는 선분)에서 가장 먼저 닿는 object 를 찾아 그 시점까지만 이동하고 충돌 처리한 뒤,
+   * 바뀐 속도로 남은 시간만큼 다시 이동 경로를 검사함.
+   * -> 이동 후 위치의 overlap 만 검사하던 이전 방식은 한 tick 이동거리가 brick 두께보다 길면(speed powerup 누적, 프레임 지연으로 dt 가 큰 경우) brick, paddle 을 통과했음.
+   * -> tick 을 잘게 나누어 여러 번 검사(substep)하지 않고, 실제 접촉 횟수만큼만 경로를 검사하므로 속도와 무관하게 정확함.
+   */
+  float remaining = dt;
+  for (unsigned int contact = 0; contact < MAX_BALL_CONTACTS && remaining > 0.0f && !tag.Has(ENTITY_STUCK); contact++)
+  {
+    glm::vec2 center = transform.Position + radius;
+    glm::vec2 motion = velocity * remaining;
 
-    // Ball - Paddle 충돌 시, Sticky 아이템 활성화되어 있다면 paddle 에 붙게 됨.
-    Ball->Stuck = Ball->Sticky;
+    // 가장 이른 접촉 정보 (-1: 벽, -2: paddle, 0 이상: brick index)
+    SweepHit earliest;
+    earliest.Hit = false;
+    earliest.Time = 1.0f;
+    int target = -1;
 
-    // ball 충돌 시 효과음 재생
-    SoundEngine->play2D("resources/audio/bleep.wav", false);
-  }
-};
+    for (unsigned int i = 0; i < 3; i++)
+    {
+      SweepHit hit = SweepCircleAABB(center, radius, motion, wallMin[i], wallMax[i]);
+      if (hit.Hit && (!earliest.Hit || hit.Time < earliest.Time))
+      {
+        earliest = hit;
+        target = -1;
+      }
+    }
 
-// AABB - AABB 간 충돌 검사
-bool checkCollision(GameObejct &one, GameObejct &two)
-{
-  // 두 GameObject 의 AABB 간 x축 방향 충돌 검사(= 수평 방향 overlap 검사)
-  bool collisionX = one.Position.x + one.Size.x >= two.Position.x &&
-                    two.Position.x + two.Size.x >= one.Position.x;
+    /**
+     * Ball - Brick 충돌 검사 broadphase
+     *
+     * 남은 이동 경로 전체를 감싸는 AABB 와 겹치는 grid cell 의 brick 만 검사함.
+     * -> ball 이 brick 영역보다 아래에 있는 tick(대부분의 tick)은 brick 충돌 검사를 통째로 생략함.
+     */
+    glm::vec2 sweepMin = glm::min(transform.Position, transform.Position + motion);
+    glm::vec2 sweepMax = glm::max(transform.Position, transform.Position + motion) + glm::vec2(radius * 2.0f);
+    scratch.Candidates.clear();
+    if (sweepMin.y <= level.Bottom())
+    {
+      level.QueryBricks(sweepMin, sweepMax, scratch.Candidates);
+    }
+    for (unsigned int candidate : scratch.Candidates)
+    {
+      // QueryBricks() 는 아직 파괴되지 않은 Brick 들만 반환함 (같은 시점이면 brick index 가 작은 brick 우선)
+      if (std::find(scratch.Passed.begin(), scratch.Passed.end(), candidate) == scratch.Passed.end())
+      {
+        glm::vec2 boxPosition = level.BrickPosition(candidate);
+        SweepHit hit = SweepCircleAABB(center, radius, motion, boxPosition, boxPosition + brickSize);
+        if (hit.Hit && (!earliest.Hit || hit.Time < earliest.Time))
+        {
+          earliest = hit;
+          target = static_cast<int>(candidate);
+        }
+      }
+    }
+
+    SweepHit paddle = SweepCircleAABB(center, radius, motion, player.Position, player.Position + player.Size);
+    if (paddle.Hit && (!earliest.Hit || paddle.Time < earliest.Time))
+    {
+      earliest = paddle;
+      target = -2;
+    }
 
-  // 두 GameObject 의 AABB 간 y축 방향 충돌 검사(= 수직 방향 overlap 검사)
-  bool collisionY = one.Position.y + one.Size.y >= two.Position.y &&
-                    two.Position.y + two.Size.y >= one.Position.y;
+    // 남은 경로에서 닿는 object 가 없으면 끝까지 이동
+    if (!earliest.Hit)
+    {
+      transform.Position += motion;
+      return;
+    }
 
-  // x축, y축 방향 모두 충돌 시, 두 AABB 가 충돌한 것으로 판정
-  return collisionX && collisionY;
+    // 접촉 시점까지 이동 후 충돌 처리
+    transform.Position += motion * earliest.Time;
+    remaining -= remaining * earliest.Time;
+    if (target >= 0)
+    {
+      // brick 파괴 등은 접촉 기록을 반영할 때 처리하고, 여기서는 반사만 함
+      bool solid = level.IsSolid(static_cast<unsigned int>(target));
+      BallContact hit = {index, target};
+      scratch.Contacts.push_back(hit);
+      if (!solid)
+      {
+        scratch.Passed.push_back(static_cast<unsigned int>(target));
+      }
+      // non-solid block 충돌 시, pass-through 아이템이 활성화되어 있다면 반사하지 않음 -> 충돌한 non-solid block 자리를 뚫고 지나감
+      if (!(tag.Has(ENTITY_PASS_THROUGH) && !solid))
+      {
+        reflectOffBrick(velocity, earliest.Normal);
+      }
+    }
+    else if (target == -2)
+    {
+      BallContact hit = {index, -1};
+      scratch.Contacts.push_back(hit);
+      this->bounceOffPaddle(transform, velocity, tag, radius);
+    }
+    else
+    {
+      // 벽 충돌 시 법선 방향으로 이동방향 뒤집기
+      if (earliest.Normal.x != 0.0f)
+      {
+        velocity.x = -velocity.x;
+      }
+      if (earliest.Normal.y != 0.0f)
+      {
+        velocity.y = -velocity.y;
+      }
+    }
+  }
 };
 
-// Circle - AABB 간 충돌 검사 (docs/nodes.md 참고)
-Collision checkCollision(BallObject &one, GameObejct &two)
+void Game::applyContact(const BallContact &contact, bool soundPlayed[])
 {
-  // BallObject 의 circle 중점 계산
-  glm::vec2 center(one.Position + one.Radius);
-
-  // 두 번째 GameObject 의 AABB 절반 크기 및 중점 계산 계산
-  glm::vec2 aabb_half_extents(two.Size.x / 2.0f, two.Size.y / 2.0f);
-  glm::vec2 aabb_center(
-      two.Position.x + aabb_half_extents.x,
-      two.Position.y + aabb_half_extents.y);
-
-  // Circle 과 AABB 중점 사이의 vector D 계산
-  glm::vec2 difference = center - aabb_center;
-
-  // [-aabb_half_extents, aabb_half_extents] 범위 내로 vector D clamping
-  glm::vec2 clamped = glm::clamp(difference, -aabb_half_extents, aabb_half_extents);
-
-  // AABB edges 와 clamp 된 vector D 가 교차하는 임의의 점 P 계산 -> circle 중점에서 가장 가까운 점 P
-  glm::vec2 closest = aabb_center + clamped;
+  GameSound sound = SOUND_PADDLE;
+  if (contact.Brick >= 0)
+  {
+    GameLevel &level = this->Levels[this->Level];
+    unsigned int brick = static_cast<unsigned int>(contact.Brick);
 
-  // circle 중점 ~ 가장 가까운 점 P 사이의 거리 계산
-  difference = closest - center;
+    // 번호가 더 작은 ball 이 이번 tick 에 이미 파괴한 brick 이면 무시
+    if (!level.IsAlive(brick))
+    {
+      return;
+    }
 
-  // 'circle 중점 ~ 가장 가까운 점 P 사이의 거리' 가 circle 반지름보다 작다면, Circle 과 AABB 가 충돌한 것으로 판정
-  if (glm::length(difference) < one.Radius)
-  {
-    // 더 자세한 충돌 정보를 사용자 정의 타입 Collision 으로 파싱하여 반환
-    return std::make_tuple(true, VectorDirection(difference), difference);
+    // 현재 Brick 이 non-solid brick 인 경우에만 hit point 감소 (남은 brick 개수는 GameLevel 이 갱신함)
+    if (!level.IsSolid(brick))
+    {
+      // non-solid block 파괴 시, 해당 block 자리에 PowerUp 아이템 랜덤 생성
+      if (level.HitBrick(brick))
+      {
+        this->SpawnPowerUps(level.BrickPosition(brick));
+      }
+      sound = SOUND_BRICK;
+    }
+    else
+    {
+      // solid block collision 발생 시, shake effect 활성화 및 지속시간 reset (이미 진행 중이면 만료 timer 를 다시 설정)
+      if (!this->Timers.Reschedule(this->Effects.ShakeTimer, SHAKE_DURATION))
+      {
+        this->Effects.ShakeTimer = this->Timers.Schedule(SHAKE_DURATION, GAME_TIMER_SHAKE, 0);
+      }
+      this->Effects.Shake = true;
+      sound = SOUND_SOLID;
+    }
   }
-  else
+
+  // 충돌 종류에 따른 효과음 재생
+  if (!soundPlayed[sound])
   {
-    return std::make_tuple(false, UP, glm::vec2(0.0f, 0.0f));
+    soundPlayed[sound] = true;
+    this->playSound(sound);
   }
 };
 
-// Circle - AABB 충돌 방향 계산 함수 전방선언
-Direction VectorDirection(glm::vec2 target)
+void Game::bounceOffPaddle(const TransformComponent &transform, glm::vec2 &velocity, TagComponent &tag, float radius) const
 {
-  // 충돌 방향벡터 정의
-  glm::vec2 compass[] = {
-      glm::vec2(0.0f, 1.0f),  // up
-      glm::vec2(1.0f, 0.0f),  // right
-      glm::vec2(0.0f, -1.0f), // down
-      glm::vec2(-1.0f, 0.0f)  // left
-  };
+  /** Ball - Paddle 충돌 처리 */
+  // Ball 충돌 지점이 Paddle 중심에서 떨어진 거리의 비율값(percentage) 계산 -> Paddle 끝부분에 가까울수록 1, 중심에 가까울수록 0
+  const TransformComponent &player = this->Entities.Transforms.Get(this->Player);
+  float centerBoard = player.Position.x + player.Size.x / 2.0f;
+  float distance = (transform.Position.x + radius) - centerBoard;
+  float percentage = distance / (player.Size.x / 2.0f);
 
-  float max = 0.0f;
-  unsigned int best_match = -1;
+  // 원래 속도 벡터를 복사해 둠.
+  glm::vec2 oldVelocity = velocity;
 
-  /**
-   * 충돌 방향벡터를 순회하며 target 벡터와의 내적값이 가장 큰(= 가장 1에 가까운) 벡터
-   * (= 가장 방향이 비슷한 충돌 방향벡터)를 선택하여 best_match 에 갱신
-   *
-   * -> best_match 에 저장된 index 에 대응되는 Direction 타입으로 casting 후 반환
-   */
-  for (unsigned int i = 0; i < 4; i++)
-  {
-    float dot_product = glm::dot(glm::normalize(target), compass[i]);
-    if (dot_product > max)
-    {
-      max = dot_product;
-      best_match = i;
-    }
-  }
-  return (Direction)best_match;
+  // Ball 충돌 지점이 Paddle 중심에서 멀수록 x축 속도를 증가시킴
+  float strength = 2.0f;
+  velocity.x = INITIAL_BALL_VELOCITY.x * percentage * strength;
+
+  // Paddle 과 충돌할 경우, 수직 이동방향이 항상 위쪽을 향하도록 계산 (수직 이동방향을 뒤집지 않는 이유 하단 필기)
+  velocity.y = -1.0f * std::abs(velocity.y);
+
+  // 속'력'은 일정하게 유지하도록 속도 벡터의 길이를 원래 속도 벡터와 동일하게 맞춤. -> Ball 충돌 지점에 따라 속도 벡터의 방향만 변경되겠군!
+  velocity = glm::normalize(velocity) * glm::length(oldVelocity);
+
+  // Ball - Paddle 충돌 시, Sticky 아이템 활성화되어 있다면 paddle 에 붙게 됨.
+  tag.Set(ENTITY_STUCK, tag.Has(ENTITY_STICKY));
 };
 
 /**
  * Ball - Player Paddle 충돌 시, 수직 이동방향은 뒤집지 않고 UP 방향으로 고정하는 이유
  *
  *
- * //Ball->Velocity.y = -Ball->Velocity.y;
- * Ball->Velocity.y = -1.0f * abs(Ball->Velocity.y);
+ * //this->Ball.Velocity.y = -this->Ball.Velocity.y;
+ * this->Ball.Velocity.y = -1.0f * abs(this->Ball.Velocity.y);
  *
  * Ball - Player Paddle 충돌 시 수직 이동방향 변경을 위와 같이 처리한 것을 볼 수 있음.
  * 이는 LearnOpenGL 본문에서 'sticky paddle' 이라고 불리는 issue 를 해결하기 위한 목적임.
@@ -780,35 +918,20 @@ Direction VectorDirection(glm::vec2 target)
  */
 
 /**
- * PowerUp effect rollback 시, isOtherPowerUpActive() 검사 이유
+ * PowerUp effect rollback 시, 타입별 활성화 개수(ActivePowerUps)를 검사하는 이유
  *
  *
  * 어떤 powerup 의 지속시간이 5초일 때, 이 powerup 이 활성화 상태에서 동일한 타입의 powerup(= 지속시간 5초)이
- * player paddle 과 충돌해서 this→PowerUps 컨테이너에 동일한 타입의 powerup 이 중복 추가되었다면?
+ * player paddle 과 충돌해서 동일한 타입의 powerup 이 중복 활성화되었다면?
  *
  * 이런 상황에서 첫 번째 powerup 활성화 시점에 변경된 상태를
  * 두 번째 동일한 타입의 powerup 의 지속시간만큼 연장시키면 좋을 것임.
  * -> why? 동일한 powerup 습득 시 effect 지속시간을 그만큼 연장해야 자연스러우니까!
  *
  * 따라서, 첫 번째 powerup 의 지속시간이 0초가 되었더라도 변경된 상태를 곧바로 rollback 시키는 게 아니라,
- * isOtherPowerUpActive() 함수로 this→PowerUps 컨테이너에 아직 지속시간이 남은 동일한 타입의 powerup 이 남아있는지 검사함.
+ * ActivePowerUps[type] 로 아직 지속시간이 남은 동일한 타입의 powerup entity 가 남아있는지 검사함.
+ * -> 습득 / 만료 시점에 개수를 갱신해 두므로, 만료될 때마다 모든 powerup 을 다시 순회하지 않고 바로 알 수 있음.
  *
  * 남아있는 동일한 타입의 powerup 들이 모두 비활성화될 때까지 기다림으로써
  * 마지막에 습득한 powerup 의 지속시간만큼 powerup effect 를 연장시킬 수 있게 됨!
  */
-
-/**
- * std::vector::erase() 와 std::remove_if() 조합
- *
- *
- * std::remove_if()
- * -> 특정 조건을 만족하는 powerup 아이템을 컨테이너 뒤로 몰아넣은 후,
- * 옮겨진 요소들의 첫 번째 반복자를 반환함.
- *
- * std::vector::erase(시작 반복자, 끝 반복자)
- * -> 현재 std::vector 컨테이너 상에서 제거할 부분의
- * 시작 반복자와 끝 반복자를 전달하면, 해당 부분이 컨테이너로부터 제거됨.
- *
- * 위 두 문법의 조합으로 this->PowerUps 컨테이너에 남아있는
- * PowerUp 인스턴스 제거
- */
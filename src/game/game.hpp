@@ -1,12 +1,20 @@
 #ifndef GAME_HPP
 #define GAME_HPP
 
-#include <tuple>
-#include <glad/glad.h>
-#include <GLFW/glfw3.h>
+#include <vector>
 
 #include "../level/game_level.hpp"
-#include "../game_object/power_up.hpp"
+#include "camera.hpp"
+#include "../entity/entity_registry.hpp"
+#include "../physics/collision.hpp"
+#include "game_audio.hpp"
+#include "power_up_table.hpp"
+#include "../utils/random.hpp"
+#include "../utils/worker_pool.hpp"
+#include "../utils/timer_queue.hpp"
+
+// 게임 level 목록 파일 (작업 디렉토리 기준 경로, 형식은 level/level_file.hpp 참고)
+const char *const LEVEL_MANIFEST = "resources/levels/manifest.txt";
 
 // 현재 게임 상태를 enum 으로 정의
 enum GameState
@@ -16,17 +24,35 @@ enum GameState
   GAME_WIN
 };
 
-// Circle - AABB 충돌 방향을 enum 으로 정의
-enum Direction
+// 게임에서 사용하는 키 코드 (GLFW 키 코드와 같은 값 -> GLFW 키 콜백함수에서 전달받은 키 코드를 그대로 Keys[] index 로 사용)
+enum GameKey
+{
+  GAME_KEY_SPACE = 32,
+  GAME_KEY_A = 65,
+  GAME_KEY_D = 68,
+  GAME_KEY_S = 83,
+  GAME_KEY_W = 87,
+  GAME_KEY_ENTER = 257
+};
+
+// PowerUp 습득 및 solid brick 충돌로 활성화되는 화면 효과 상태 (GameRenderer 가 매 프레임 PostProcessor 에 반영함)
+struct GameEffects
+{
+  bool Shake, Confuse, Chaos;
+  TimerHandle ShakeTimer; // solid brick 충돌 시 재설정되는 shake 효과 만료 timer
+
+  GameEffects() : Shake(false), Confuse(false), Chaos(false), ShakeTimer(NULL_TIMER) {};
+};
+
+// Game::Timers 에 예약하는 timer 종류
+enum GameTimer
 {
-  UP,
-  RIGHT,
-  DOWN,
-  LEFT
+  GAME_TIMER_SHAKE,  // shake 효과 만료
+  GAME_TIMER_POWERUP // powerup 효과 지속시간 만료 (payload: powerup entity)
 };
 
-// 충돌 정보를 std::tuple(n개의 데이터쌍) 컨테이너 사용자 정의 타입으로 정의
-typedef std::tuple<bool, Direction, glm::vec2> Collision; // <충돌 여부, 충돌 방향, circle 중점 ~ 가장 가까운 점 P 사이의 거리>
+// solid brick 충돌 시 shake 효과 지속시간
+const float SHAKE_DURATION = 0.05f;
 
 // player paddle 크기 및 속도를 전역변수로 정의
 const glm::vec2 PLAYER_SIZE(100.0f, 20.0f);
@@ -36,13 +62,63 @@ const float PLAYER_VELOCITY(500.0f);
 const glm::vec2 INITIAL_BALL_VELOCITY(100.0f, -350.0f);
 const float BALL_RADIUS = 12.5f;
 
+// PowerUp 아이템 크기 및 낙하 속도를 전역변수로 정의
+const glm::vec2 POWERUP_SIZE(60.0f, 20.0f);
+const glm::vec2 POWERUP_VELOCITY(0.0f, 150.0f);
+
+// 한 tick 동안 ball 이 처리할 수 있는 최대 접촉 횟수 (모서리, 틈새에 끼어 같은 시점에 접촉이 반복되는 경우 무한 반복 방지)
+const unsigned int MAX_BALL_CONTACTS = 8;
+
+// multi-ball powerup 습득 시 추가되는 ball 개수
+const unsigned int MULTI_BALL_COUNT = 2;
+
+// 동시에 존재할 수 있는 최대 powerup 개수 (낙하 중 + 효과 적용 중) -> 가득 차면 brick 을 파괴해도 더 이상 생성하지 않음
+const unsigned int MAX_POWERUPS = 64;
+
+// Init() 에서 미리 확보하는 entity 및 timer pool 크기 (paddle, ball, multi-ball 로 추가된 ball, powerup / shake 효과, powerup 지속시간)
+// -> 일반적인 게임 진행 중에는 pool 안에서 생성, 파괴를 반복하므로 heap 할당이 일어나지 않음.
+// -> entity 개수를 제한하지는 않으므로, 부하 테스트처럼 ball 을 더 많이 추가할 때는 ReserveBalls() 로 그만큼 더 확보해야 함. (그렇지 않으면 배열이 재할당되며 늘어남)
+const unsigned int ENTITY_POOL_CAPACITY = 256;
+const unsigned int TIMER_POOL_CAPACITY = MAX_POWERUPS + 1;
+
+// ball 이동을 병렬로 처리할 때 구간 하나가 맡는 최소 ball 개수 (이보다 적으면 worker 를 깨우는 비용이 이동 처리 비용보다 큼)
+const unsigned int MIN_BALLS_PER_CHUNK = 256;
+
+// ball 이동 중 발생한 접촉 기록 (brick 파괴, 효과음 등 공유 상태 변경을 미뤄 두었다가 ball 번호 순서대로 반영하기 위한 conflict buffer 항목)
+struct BallContact
+{
+  unsigned int Ball; // ball 번호 (Entities.Colliders 의 dense 위치 -> 0 은 항상 Ball)
+  int Brick;         // 접촉한 brick 의 brick index (-1 이면 player paddle)
+};
+
+// ball 이동 구간마다 하나씩 두고 매 tick 재사용하는 작업 버퍼
+struct BallSweepScratch
+{
+  std::vector<unsigned int> Candidates; // 충돌 검사 broadphase 결과
+  std::vector<unsigned int> Passed;     // 현재 ball 이 이번 tick 에 부순 brick (같은 tick 에 다시 부딪히지 않도록 제외)
+  std::vector<BallContact> Contacts;    // 이번 tick 의 접촉 기록
+};
+
+// 미리 확보한 pool 의 크기(Capacity, Reserved) 및 지금까지 동시에 사용한 최대 개수(HighWater) -> pool 크기 조정 목적
+// -> powerup, timer 는 Capacity 개를 넘어서 생성하지 않지만, entity 는 제한이 없으므로 HighWater 가 Reserved 보다 크면 확보한 공간이 모자랐던 것
+struct GamePoolUsage
+{
+  unsigned int EntityHighWater, EntityReserved;
+  unsigned int PowerUpHighWater, PowerUpCapacity;
+  unsigned int TimerHighWater, TimerCapacity;
+  unsigned int ContactHighWater; // 한 tick 동안 기록된 최대 접촉 개수 (conflict buffer 는 필요한 만큼 늘어난 뒤 재사용)
+};
+
 /**
  * Game 클래스
  *
- * 게임/그래픽 로직을 추상화하여 windowing library 로직과 de-coupling 한 클래스.
+ * 게임 규칙(입력 처리, ball/paddle 이동, 충돌, powerup, level 진행)을 담당하는 게임 시뮬레이션 클래스.
  * 게임의 전반적인 구성 요소를 한데 모아 관리하는 uber class
  *
  * (참고로, 'uber' 는 독일어로 '모든 것을 아우르는, 포괄적인, 최상위' 라는 의미를 가짐.)
+ *
+ * 렌더링은 GameRenderer 가 Game 의 상태를 읽어서 수행하고, 효과음은 GameAudio 인터페이스로 요청하므로
+ * Game 은 GL, GLFW, 오디오 라이브러리에 의존하지 않음. -> 창이나 GPU 없이도 시뮬레이션만 실행할 수 있음 (breakout_sim 라이브러리).
  */
 class Game
 {
@@ -53,27 +129,104 @@ public:
   unsigned int Width, Height; // 게임 창 resolution
 
   std::vector<GameLevel> Levels; // 각 단계별 GameLevel 인스턴스 저장 컨테이너
-  std::vector<PowerUp> PowerUps; // 일정 확률로 생성된 PowerUp 아이템 인스턴스 저장 컨테이너
   unsigned int Level;            // 현재 게임 level
   unsigned int Lives;            // 현재 플레이어 수명
 
+  /**
+   * player paddle, ball, powerup entity 들
+   *
+   * -> ball: Collider component 를 가진 entity. Ball 외의 ball 은 multi-ball 로 추가된 ball 로, Ball 과 같이 이동하고 충돌하지만 화면 밖으로 떨어져도 수명은 줄지 않음.
+   * -> powerup: Lifetime component 를 가진 entity. 일정 확률로 brick 자리에 생성됨.
+   */
+  EntityRegistry Entities;
+  Entity Player; // player paddle
+  Entity Ball;   // 수명과 powerup 효과가 연결된 ball (떨어지면 수명 감소)
+
+  // 타입별 효과가 적용 중인 powerup 개수 -> 같은 타입을 중복 습득한 경우, 마지막 powerup 이 만료될 때만 rollback 함
+  unsigned int ActivePowerUps[POWERUP_TYPE_COUNT];
+
+  GameEffects Effects; // 화면 효과 상태
+  TimerQueue Timers;   // 시간제한이 있는 게임 상태(shake 효과, powerup 지속시간)의 만료 timer
+  GameAudio *Audio;    // 효과음 재생 인터페이스 (nullptr 이면 효과음 없이 진행)
+  WorkerPool *Workers; // ball 이 많을 때 이동 및 충돌 검사를 나누어 맡길 스레드 pool (nullptr 이면 호출한 스레드에서 모두 처리)
+
+  Camera View; // 화면에 보이는 world 영역 -> 매 tick Ball 을 따라 세로로 이동 (brick 영역이 화면 안에 들어오는 일반 레벨에서는 움직이지 않음)
+
+  Random Rng; // PowerUp 생성 확률 계산에 사용할 gameplay 난수열 (게임 인스턴스마다 독립적 -> 여러 게임을 병렬로 진행해도 서로 영향을 주지 않음)
+
   Game(unsigned int width, unsigned int height);
-  ~Game();
 
   /** 게임 라이프사이클 함수 정의 */
-  void Init();                 // 초기화 라이프사이클 (shader/texture/levels 등의 resource loading)
+  void Init(const char *manifest = LEVEL_MANIFEST); // 초기화 라이프사이클 (manifest 에 나열된 levels 로딩 및 player, ball 초기화)
   void ProcessInput(float dt); // 사용자 입력 처리 라이프사이클 -> delta time 전달받음.
   void Update(float dt);       // 업데이트 라이프사이클 (플레이어, 공 이동 업데이트 등) -> delta time 전달받음.
-  void Render();               // 렌더링 라이프사이클
-  void DoCollisions();         // 충돌 감지 함수 -> 업데이트 라이프사이클에서 호출
+  void DoCollisions(float dt); // ball 이동 및 충돌 처리 함수 -> 업데이트 라이프사이클에서 호출
+
+  // 게임 RNG seed 초기화 (같은 seed 와 같은 입력이면 같은 게임이 재현됨)
+  void Seed(unsigned int seed);
+
+  // 키 입력 플래그 변경 (GLFW 키 콜백함수 및 입력 기록 재생 시 호출)
+  void SetKey(int key, bool pressed);
+
+  // 게임 시뮬레이션 상태(게임 상태, level, 수명, 화면 효과, paddle, ball, brick, powerup)의 64bit hash -> 입력 기록 재생 결과 검증 목적
+  unsigned long long StateHash() const;
 
   /** 게임 리셋 함수 정의 */
   void ResetLevel();
   void ResetPlayer();
 
   /** PowerUp 아이템 생성 및 업데이트 함수 정의 */
-  void SpawnPowerUps(GameObejct &block);
+  void SpawnPowerUps(glm::vec2 position);
   void UpdatePowerUps(float dt);
+
+  // Ball 위치에서 이동방향을 부채꼴로 나누어 count 개의 ball 추가 (multi-ball powerup 및 부하 테스트)
+  void SpawnBalls(unsigned int count);
+
+  // extra ball count 개를 추가로 유지해도 entity 배열이 재할당되지 않도록 ENTITY_POOL_CAPACITY + count 개 확보 (부하 테스트용, Init() 이후 호출)
+  void ReserveBalls(unsigned int count);
+
+  // Ball 을 포함한 ball 개수
+  unsigned int BallCount() const { return static_cast<unsigned int>(this->Entities.Colliders.Size()); };
+
+  // entity, powerup, timer pool 및 접촉 기록 버퍼 사용량
+  GamePoolUsage PoolUsage() const;
+
+private:
+  std::vector<BallSweepScratch> sweepScratch; // ball 이동 구간별 작업 버퍼
+  std::vector<TimerEvent> firedTimers;        // 이번 tick 에 만료된 timer (매 tick 재사용)
+  unsigned int contactHighWater;              // 한 tick 동안 기록된 최대 접촉 개수
+
+  // ball entity 생성 (position: 좌상단 좌표, flags: 초기 상태 flag)
+  Entity spawnBall(glm::vec2 position, float radius, glm::vec2 velocity, unsigned int flags);
+
+  // powerup entity 생성 (색상, 지속시간은 정의 표의 값 사용)
+  void spawnPowerUp(PowerUpType type, glm::vec2 position);
+
+  // 모든 powerup entity 제거 및 효과 timer 취소, 타입별 활성화 개수 초기화 (변경된 게임 상태의 rollback 은 ResetPlayer() 에서 처리)
+  void clearPowerUps();
+
+  // index 번 ball 을 dt 동안 이동시키면서 경로상의 가장 이른 접촉(벽, brick, paddle)부터 순서대로 반사 (swept collision)
+  // -> brick 파괴 등 공유 상태는 바꾸지 않고 scratch.Contacts 에 기록만 하므로, 서로 다른 ball 은 동시에 이동시킬 수 있음
+  void sweepBall(TransformComponent &transform, glm::vec2 &velocity, TagComponent &tag, float radius, unsigned int index, float dt, BallSweepScratch &scratch) const;
+
+  // Ball - Player Paddle 접촉 시 접촉 지점에 따라 반사 방향 결정
+  void bounceOffPaddle(const TransformComponent &transform, glm::vec2 &velocity, TagComponent &tag, float radius) const;
+
+  // 접촉 기록 하나를 게임 상태에 반영 (brick 파괴, PowerUp 생성, 화면 효과, 효과음)
+  void applyContact(const BallContact &contact, bool soundPlayed[]);
+
+  // PowerUp 아이템 습득 시 타입에 따른 게임 상태 변경 및 만료 시 rollback (정의 표의 함수 호출 및 타입별 활성화 개수 갱신)
+  void activatePowerUp(PowerUpType type);
+  void deactivatePowerUp(PowerUpType type);
+
+  // 만료된 timer 하나를 종류에 따라 처리
+  void onTimer(const TimerEvent &event);
+
+  // Ball 을 따라 카메라 이동 및 현재 level 의 streaming window 갱신 (매 tick 마지막에 호출)
+  void updateView();
+
+  // 효과음 재생 요청 (GameAudio 가 연결된 경우에만)
+  void playSound(GameSound sound);
 };
 
 #endif /* GAME_HPP */
@@ -0,0 +1,30 @@
+#ifndef GAME_AUDIO_HPP
+#define GAME_AUDIO_HPP
+
+// 게임 시뮬레이션에서 발생하는 효과음 종류
+enum GameSound
+{
+  SOUND_BRICK,   // non-solid brick 파괴
+  SOUND_SOLID,   // solid brick 충돌
+  SOUND_POWERUP, // powerup 습득
+  SOUND_PADDLE,  // ball - player paddle 충돌
+  SOUND_COUNT
+};
+
+/**
+ * GameAudio 인터페이스
+ *
+ * 게임 시뮬레이션(Game)이 효과음 재생을 요청하는 인터페이스.
+ * -> Game 은 오디오 라이브러리에 의존하지 않고 이 인터페이스만 호출하므로, 오디오 장치가 없는 환경에서도 시뮬레이션을 실행할 수 있음.
+ * -> 실제 재생은 IrrklangAudio 등 구현 클래스가 담당하고, 연결하지 않으면(nullptr) 효과음 없이 진행됨.
+ */
+class GameAudio
+{
+public:
+  virtual ~GameAudio() {};
+
+  // 효과음 재생 요청
+  virtual void Play(GameSound sound) = 0;
+};
+
+#endif /* GAME_AUDIO_HPP */
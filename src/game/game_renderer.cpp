@@ -0,0 +1,261 @@
+#include <sstream>
+#include <GLFW/glfw3.h>
+#include "game_renderer.hpp"
+#include "../manager/resource_manager.hpp"
+#include "../profiler/gpu_profiler.hpp"
+#include "../profiler/cpu_profiler.hpp"
+#include "../renderer/render_stats.hpp"
+
+GameRenderer::GameRenderer(unsigned int width, unsigned int height)
+    : ShowOverlay(false), width(width), height(height), projection(1.0f), camera(nullptr), sprites(nullptr), particles(nullptr), effects(nullptr), text(nullptr), overlayBatch(nullptr), overlay(nullptr)
+{
+}
+
+GameRenderer::~GameRenderer()
+{
+  // 아직 반납되지 않은 renderer 객체들 메모리 반납
+  this->Release();
+}
+
+void GameRenderer::Release()
+{
+  // renderer 객체들은 소멸 시점에 소유한 GL 객체를 반납하므로, GL 컨텍스트가 유효한 동안(= glfwTerminate() 이전)에 호출되어야 함.
+  delete this->camera;
+  delete this->sprites;
+  delete this->particles;
+  delete this->effects;
+  delete this->text;
+  delete this->overlayBatch;
+  delete this->overlay;
+  this->camera = nullptr;
+  this->sprites = nullptr;
+  this->particles = nullptr;
+  this->effects = nullptr;
+  this->text = nullptr;
+  this->overlayBatch = nullptr;
+  this->overlay = nullptr;
+}
+
+void GameRenderer::Init()
+{
+  // 2D Sprite 쉐이더 객체 생성
+  ShaderHandle spriteShader = ResourceManager::LoadShader("resources/shaders/sprite.vs", "resources/shaders/sprite.fs", nullptr, "sprite");
+  ShaderHandle particleShader = ResourceManager::LoadShader("resources/shaders/particle.vs", "resources/shaders/particle.fs", nullptr, "particle");
+  ShaderHandle postProcessingShader = ResourceManager::LoadShader("resources/shaders/post_processing.vs", "resources/shaders/post_processing.fs", nullptr, "postprocessing");
+  ShaderHandle quadBatchShader = ResourceManager::LoadShader("resources/shaders/quad_batch.vs", "resources/shaders/quad_batch.fs", nullptr, "quad_batch");
+
+  // 2D Sprite 에 적용할 orthogonal projection 행렬 계산
+  // 2D Quad 정점 데이터 및 위치를 직관적인 screen space 좌표계로 다루기 위해, screen size 해상도로 left, right, top, bottom 정의
+  // 아래와 같이 orthogonal 투영행렬을 정의하면 world space 좌표를 screen space 와 동일하게 다루어도 알아서 [-1, 1] 범위의 NDC 좌표계로 변환해 줌.
+  // https://github.com/jooo0922/opengl-text-rendering/blob/main/src/main.cpp 참고
+  this->projection = glm::ortho(0.0f, static_cast<float>(this->width), static_cast<float>(this->height), 0.0f, -1.0f, 1.0f);
+
+  // 2D Sprite, particle 쉐이더는 projection, view 행렬을 'Camera' uniform block 으로 공유함 (매 프레임 Render() 에서 카메라 위치로 갱신)
+  // -> 성능 overlay 를 그리는 quad_batch 쉐이더는 카메라와 무관한 screen space 이므로 projection 행렬만 따로 전송
+  this->camera = new CameraUniforms();
+  this->camera->Update(this->projection, glm::mat4(1.0f));
+  CameraUniforms::Bind(ResourceManager::GetShader(spriteShader));
+  CameraUniforms::Bind(ResourceManager::GetShader(particleShader));
+  ResourceManager::GetShader(spriteShader).Use().SetInt("image", 0);
+  ResourceManager::GetShader(particleShader).Use().SetInt("sprite", 0);
+  ResourceManager::GetShader(quadBatchShader).Use().SetMat4("projection", this->projection);
+
+  // 2D Sprite 에 적용할 텍스쳐 객체 생성
+  // -> 축소되어 그려지는 sprite 는 기본 옵션(mip chain 생성)으로 로드하고, 투명한 테두리가 있는 sprite 는 alpha 를 미리 곱해 둠.
+  TextureImportOptions spriteOptions;
+  spriteOptions.PremultiplyAlpha = true;
+
+  // 배경은 항상 화면 해상도 그대로 그려지므로, 화면보다 큰 원본은 화면 크기로 축소하고 mip chain 도 생성하지 않음.
+  TextureImportOptions backgroundOptions;
+  backgroundOptions.GenerateMipmaps = false;
+  backgroundOptions.MaxWidth = static_cast<int>(this->width);
+  backgroundOptions.MaxHeight = static_cast<int>(this->height);
+
+  // particle 은 additive blending(GL_SRC_ALPHA, GL_ONE)으로 그리므로 premultiply 하지 않음.
+  TextureImportOptions particleOptions;
+
+  this->faceTexture = ResourceManager::LoadTexture("resources/textures/awesomeface.png", "face", spriteOptions);
+  this->backgroundTexture = ResourceManager::LoadTexture("resources/textures/background.jpg", "background", backgroundOptions);
+  this->blockTexture = ResourceManager::LoadTexture("resources/textures/block.png", "block");
+  this->blockSolidTexture = ResourceManager::LoadTexture("resources/textures/block_solid.png", "block_solid");
+  this->paddleTexture = ResourceManager::LoadTexture("resources/textures/paddle.png", "paddle", spriteOptions);
+  TextureHandle particleTexture = ResourceManager::LoadTexture("resources/textures/particle.png", "particle", particleOptions);
+  for (unsigned int type = 0; type < POWERUP_TYPE_COUNT; type++)
+  {
+    const PowerUpDefinition &definition = POWERUP_DEFINITIONS[type];
+    this->powerUpTextures[type] = ResourceManager::LoadTexture(definition.TextureFile, definition.TextureName, spriteOptions);
+  }
+
+  // 생성된 2D Sprite 쉐이더 객체를 넘겨줘서 SpriteRenderer 인스턴스 동적 할당 생성
+  this->sprites = new SpriteRenderer(ResourceManager::GetShader(spriteShader));
+
+  // 생성된 Particle 쉐이더 객체를 넘겨줘서 ParticleGenerator 인스턴스 동적 할당 생성
+  this->particles = new ParticleGenerator(ResourceManager::GetShader(particleShader), particleTexture, 500);
+
+  // 생성된 post processing 쉐이더 객체를 넘겨줘서 PostProcessor 인스턴스 동적 할당 생성
+  this->effects = new PostProcessor(ResourceManager::GetShader(postProcessingShader), this->width, this->height);
+
+  // TextRenderer 인스턴스 동적 할당 생성 및 .ttf 파일 로드
+  this->text = new TextRenderer();
+  this->text->Load("resources/fonts/OCRAEXT.TTF", 24);
+
+  // 성능 overlay 및 overlay 배경/그래프를 그릴 QuadBatch 인스턴스 동적 할당 생성
+  this->overlayBatch = new QuadBatch(ResourceManager::GetShader(quadBatchShader));
+  this->overlay = new PerformanceOverlay();
+}
+
+void GameRenderer::Update(float dt, const Game &game)
+{
+  PROFILE_SCOPE("GameRenderer::Update");
+
+  // 매 프레임마다 ball 을 따라다니는 particle 재생성 및 업데이트
+  const EntityRegistry &entities = game.Entities;
+  float radius = entities.Colliders.Get(game.Ball).Radius;
+  this->particles->Update(dt, entities.Transforms.Get(game.Ball).Position, entities.Velocities.Get(game.Ball), 2, glm::vec2(radius / 2.0f));
+
+  // Game 의 화면 효과 상태를 post processing effect 에 반영
+  this->effects->Shake = game.Effects.Shake;
+  this->effects->Confuse = game.Effects.Confuse;
+  this->effects->Chaos = game.Effects.Chaos;
+}
+
+void GameRenderer::RecordFrameTiming(float frameMs, float simulationMs, float renderMs)
+{
+  if (this->overlay != nullptr)
+  {
+    this->overlay->RecordFrame(frameMs, simulationMs, renderMs);
+  }
+}
+
+void GameRenderer::drawEntity(const EntityRegistry &entities, const Camera &view, Entity entity, TextureHandle texture)
+{
+  const TransformComponent &transform = entities.Transforms.Get(entity);
+  if (!view.IsVisible(transform.Position, transform.Size))
+  {
+    RenderStats::CountCulled(1);
+    return;
+  }
+  RenderStats::CountSubmitted(1);
+  const SpriteComponent &sprite = entities.Sprites.Get(entity);
+  this->sprites->DrawSprite(texture, transform.Position, transform.Size, sprite.Rotation, sprite.Color);
+}
+
+void GameRenderer::Render(const Game &game)
+{
+  PROFILE_SCOPE("GameRenderer::Render");
+
+  // 모든 게임 상태에서 항상 처리해야 할 렌더링 로직
+  if (game.State == GAME_ACTIVE || game.State == GAME_MENU || game.State == GAME_WIN)
+  {
+    // 카메라 위치를 공유 uniform block 에 반영 (카메라가 움직이지 않았다면 업로드 생략)
+    this->camera->Update(this->projection, game.View.ViewMatrix());
+
+    // multisampled 프레임버퍼에 scene 요소 렌더링 직전 처리
+    GpuProfiler::BeginPass("background");
+    this->effects->BeginRender();
+
+    // 배경을 2D Sprite 로 렌더링 (카메라를 따라 움직이며 항상 화면 전체를 덮음)
+    this->sprites->DrawSprite(this->backgroundTexture, game.View.ViewMin(), game.View.ViewSize(), 0.0f);
+
+    // 현재 게임 level 의 아직 파괴되지 않은 Brick 중 view 와 겹치는 brick 만 렌더링 (solid 여부에 따라 텍스쳐 선택)
+    // -> 충돌 검사와 같은 grid 조회(QueryBricks)로 view 가 걸쳐있는 행, 열의 cell 만 검사하므로, 비용은 레벨 크기가 아닌 화면에 보이는 cell 개수에 비례함
+    // -> brick 위치, 색상은 cell index 와 tile code 로부터 계산 (GameLevel 참고)
+    // -> streaming 레벨은 메모리에 올라와 있는 resident window 의 brick 만 조회됨
+    GpuProfiler::BeginPass("bricks");
+    const Camera &view = game.View;
+    const GameLevel &level = game.Levels[game.Level];
+    this->visibleBricks.clear();
+    level.QueryBricks(view.ViewMin(), view.ViewMax(), this->visibleBricks);
+    for (unsigned int brick : this->visibleBricks)
+    {
+      this->sprites->DrawSprite(level.IsSolid(brick) ? this->blockSolidTexture : this->blockTexture, level.BrickPosition(brick), level.BrickSize(), 0.0f, level.BrickColor(brick));
+    }
+    RenderStats::CountSubmitted(static_cast<unsigned int>(this->visibleBricks.size()));
+    RenderStats::CountCulled(level.LiveBrickCount() - static_cast<unsigned int>(this->visibleBricks.size()));
+
+    // playder paddle draw call 호출
+    GpuProfiler::BeginPass("sprites");
+    const EntityRegistry &entities = game.Entities;
+    this->drawEntity(entities, view, game.Player, this->paddleTexture);
+
+    // powerup draw call 호출 (아직 파괴되지 않은 PowerUp 들만 렌더링)
+    for (std::size_t i = 0; i < entities.Lifetimes.Size(); i++)
+    {
+      Entity powerUp = entities.Lifetimes.Entities()[i];
+      if (!entities.Tags.Get(powerUp).Has(ENTITY_DESTROYED))
+      {
+        this->drawEntity(entities, view, powerUp, this->powerUpTextures[entities.PowerUpTypes.Get(powerUp)]);
+      }
+    }
+
+    // particle draw call 호출 -> particle 은 ball 을 따라다니는 잔상 효과이므로, 다른 오브젝트들보다는 위에 그리지만, ball 을 가리지 않도록 그보다는 먼저 그림
+    GpuProfiler::BeginPass("particles");
+    this->particles->Draw(view.ViewMin(), view.ViewMax());
+
+    // ball draw call 호출
+    GpuProfiler::BeginPass("ball");
+    for (std::size_t i = 0; i < entities.Colliders.Size(); i++)
+    {
+      this->drawEntity(entities, view, entities.Colliders.Entities()[i], this->faceTexture);
+    }
+
+    // multisampled 프레임버퍼에 렌더링된 결과를 intermediate 프레임버퍼에 blit 으로 복사
+    GpuProfiler::BeginPass("msaa_resolve");
+    this->effects->EndRender();
+
+    // intermediate 프레임버퍼 렌더링 결과에 post processing 적용 후 2D Quad 렌더링
+    GpuProfiler::BeginPass("postprocess");
+    this->effects->Render(glfwGetTime());
+    GpuProfiler::EndPass();
+  }
+
+  // text 렌더링은 게임 상태와 관계없이 하나의 pass 로 측정 (GL_TIME_ELAPSED query 는 같은 pass 를 한 프레임에 한 번만 측정하므로)
+  GpuProfiler::BeginPass("text");
+  if (game.State == GAME_ACTIVE || game.State == GAME_MENU || game.State == GAME_WIN)
+  {
+    // std::stringstream 의 메모리 기반 버퍼에 현재 남은 수명값을 복사
+    std::stringstream ss;
+    ss << game.Lives;
+    // 버퍼에 저장된 남은 수명값을 std::string 에 복사 후 반환하여 text rendering
+    this->text->RenderText("Lives:" + ss.str(), 5.0f, 5.0f, 1.0f);
+  }
+
+  // GAME_MENU 상태일 때에만 추가로 처리해야 할 렌더링 로직
+  if (game.State == GAME_MENU)
+  {
+    this->text->RenderText("Press ENTER to start", 250.0f, this->height / 2.0f, 1.0f);
+    this->text->RenderText("Press W or S to select level", 245.0f, this->height / 2.0f + 20.0f, 0.75f);
+  }
+
+  // GAME_WIN 상태일 때에만 추가로 처리해야 할 렌더링 로직
+  if (game.State == GAME_WIN)
+  {
+    this->text->RenderText("You WON!!", 320.0f, this->height / 2.0f - 20.0f, 1.0f, glm::vec3(0.0f, 1.0f, 0.0f));
+    this->text->RenderText("Press ENTER to retry or ESC to quit", 130.0f, this->height / 2.0f, 1.0f, glm::vec3(1.0f, 1.0f, 0.0f));
+  }
+
+  // post processing 이 적용되지 않도록 마지막에 "Lives:" 텍스트 옆에 성능 overlay 렌더링
+  if (this->ShowOverlay)
+  {
+    GpuProfiler::BeginPass("overlay");
+
+    OverlayContent content;
+    content.LiveParticles = this->particles->LiveCount();
+    content.LiveBricks = game.Levels[game.Level].LiveBrickCount();
+    for (unsigned int type = 0; type < POWERUP_TYPE_COUNT; type++)
+    {
+      // 같은 타입이 중복 활성화된 경우 개수 표시 (ex> sticky x2)
+      unsigned int active = game.ActivePowerUps[type];
+      if (active > 0)
+      {
+        content.ActivePowerUps += (content.ActivePowerUps.empty() ? "" : " ") + std::string(POWERUP_DEFINITIONS[type].Name);
+        if (active > 1)
+        {
+          content.ActivePowerUps += " x" + std::to_string(active);
+        }
+      }
+    }
+    this->overlay->Draw(*this->text, *this->overlayBatch, glm::vec2(150.0f, 5.0f), content);
+  }
+  GpuProfiler::EndPass();
+}
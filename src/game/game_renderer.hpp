@@ -0,0 +1,75 @@
+#ifndef GAME_RENDERER_HPP
+#define GAME_RENDERER_HPP
+
+#include <string>
+#include <vector>
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+#include "game.hpp"
+#include "../manager/resource_handle.hpp"
+#include "../renderer/sprite_renderer.hpp"
+#include "../particle/particle_generator.hpp"
+#include "../postprocess/post_processor.hpp"
+#include "../renderer/text_renderer.hpp"
+#include "../renderer/quad_batch.hpp"
+#include "../renderer/camera_uniforms.hpp"
+#include "../profiler/performance_overlay.hpp"
+
+/**
+ * GameRenderer 클래스
+ *
+ * Game 의 시뮬레이션 상태를 읽어서 화면에 그리는 클래스.
+ * -> 쉐이더, 텍스쳐, SpriteRenderer, particle, post processing, text, 성능 overlay 등 GL 리소스는 모두 여기서 소유하고,
+ * Game 은 렌더링에 대해 전혀 알지 못함. (각 object 를 어떤 텍스쳐로 그릴지도 GameRenderer 가 결정함)
+ *
+ * 생성자에서는 GL 을 호출하지 않으므로 전역으로 선언할 수 있고, GL 컨텍스트 생성 이후 Init() 을 호출해야 함.
+ */
+class GameRenderer
+{
+public:
+  bool ShowOverlay; // 성능 overlay 표시 여부
+
+  GameRenderer(unsigned int width, unsigned int height);
+  ~GameRenderer();
+
+  // 쉐이더, 텍스쳐 로드 및 renderer 객체 생성 (GL 컨텍스트 생성 이후 호출)
+  void Init();
+
+  // 화면 효과 업데이트 (ball 을 따라다니는 particle, Game 의 화면 효과 상태를 PostProcessor 에 반영)
+  void Update(float dt, const Game &game);
+
+  // 현재 게임 상태 렌더링
+  void Render(const Game &game);
+
+  // 성능 overlay 에 프레임 시간 기록 (ms 단위)
+  void RecordFrameTiming(float frameMs, float simulationMs, float renderMs);
+
+  // 동적 할당된 renderer 객체 메모리 반납 (GL 컨텍스트가 유효한 동안 호출되어야 함)
+  void Release();
+
+private:
+  unsigned int width, height;
+  glm::mat4 projection; // 화면 해상도 기준 orthogonal 투영행렬 (Init() 에서 계산)
+
+  CameraUniforms *camera; // sprite, particle, text 쉐이더가 공유하는 'Camera' uniform block
+  SpriteRenderer *sprites;
+  ParticleGenerator *particles;
+  PostProcessor *effects;
+  TextRenderer *text;
+  QuadBatch *overlayBatch;
+  PerformanceOverlay *overlay;
+
+  // 매 프레임마다 이름으로 검색하지 않도록, Init() 에서 미리 조회해 둔 텍스쳐 handle
+  TextureHandle backgroundTexture, faceTexture, paddleTexture;
+  TextureHandle blockTexture, blockSolidTexture;
+  TextureHandle powerUpTextures[POWERUP_TYPE_COUNT]; // PowerUpType 별 텍스쳐 (정의 표의 텍스쳐 파일로 로드)
+
+  std::vector<unsigned int> visibleBricks; // 매 프레임 view 와 겹치는 brick index 를 담는 버퍼 (프레임마다 재할당하지 않도록 멤버로 유지)
+
+  // entity 의 Transform, Sprite component 로 2D Sprite 렌더링 (view 와 겹치지 않으면 그리지 않음)
+  void drawEntity(const EntityRegistry &entities, const Camera &view, Entity entity, TextureHandle texture);
+};
+
+#endif /* GAME_RENDERER_HPP */
@@ -0,0 +1,87 @@
+#include "power_up_table.hpp"
+
+#include "game.hpp"
+
+/** 타입별 효과 적용 / rollback 함수 */
+
+static void activateSpeed(Game &game)
+{
+  game.Entities.Velocities.Get(game.Ball) *= 1.2f;
+}
+
+static void activateSticky(Game &game)
+{
+  game.Entities.Tags.Get(game.Ball).Set(ENTITY_STICKY, true);                 // uber 클래스 내에서 Ball 관련 게임 로직 변경을 위해 상태 변경
+  game.Entities.Sprites.Get(game.Player).Color = glm::vec3(1.0f, 0.5f, 1.0f); // 현재 활성화된 effect 를 강조하기 위해 player paddle 색상 변경
+}
+
+static void deactivateSticky(Game &game)
+{
+  game.Entities.Tags.Get(game.Ball).Set(ENTITY_STICKY, false);
+  game.Entities.Sprites.Get(game.Player).Color = glm::vec3(1.0f);
+}
+
+static void activatePassThrough(Game &game)
+{
+  game.Entities.Tags.Get(game.Ball).Set(ENTITY_PASS_THROUGH, true);         // uber 클래스 내에서 Ball 관련 게임 로직 변경을 위해 상태 변경
+  game.Entities.Sprites.Get(game.Ball).Color = glm::vec3(1.0f, 0.5f, 0.5f); // 현재 활성화된 effect 를 강조하기 위해 ball 색상 변경
+}
+
+static void deactivatePassThrough(Game &game)
+{
+  game.Entities.Tags.Get(game.Ball).Set(ENTITY_PASS_THROUGH, false);
+  game.Entities.Sprites.Get(game.Ball).Color = glm::vec3(1.0f);
+}
+
+static void activatePadSizeIncrease(Game &game)
+{
+  game.Entities.Transforms.Get(game.Player).Size.x += 50;
+}
+
+static void activateMultiBall(Game &game)
+{
+  game.SpawnBalls(MULTI_BALL_COUNT);
+}
+
+static void activateConfuse(Game &game)
+{
+  /**
+   * post_processing.vs 쉐이더에서 분기문에 의해 chaos 와 confuse 효과는 동시 적용 불가
+   * -> 두 효과의 uv 좌표 계산 방법이 서로 충돌하기 때문!
+   *
+   * 따라서, 상대변 effect 가 비활성화되어 있는지 먼저 검사
+   */
+  if (!game.Effects.Chaos)
+  {
+    game.Effects.Confuse = true;
+  }
+}
+
+static void deactivateConfuse(Game &game)
+{
+  game.Effects.Confuse = false;
+}
+
+static void activateChaos(Game &game)
+{
+  if (!game.Effects.Confuse)
+  {
+    game.Effects.Chaos = true;
+  }
+}
+
+static void deactivateChaos(Game &game)
+{
+  game.Effects.Chaos = false;
+}
+
+// positive powerups 는 1/75 확률, negative powerups 는 1/15 확률로 생성 -> negative powerups 가 더 자주 생성
+const PowerUpDefinition POWERUP_DEFINITIONS[POWERUP_TYPE_COUNT] = {
+    {POWERUP_SPEED, "speed", "powerup_speed", "resources/textures/powerup_speed.png", glm::vec3(0.5f, 0.5f, 1.0f), 0.0f, 75, activateSpeed, nullptr},
+    {POWERUP_STICKY, "sticky", "powerup_sticky", "resources/textures/powerup_sticky.png", glm::vec3(1.0f, 0.5f, 1.0f), 20.0f, 75, activateSticky, deactivateSticky},
+    {POWERUP_PASS_THROUGH, "pass-through", "powerup_passthrough", "resources/textures/powerup_passthrough.png", glm::vec3(0.5f, 1.0f, 0.5f), 10.0f, 75, activatePassThrough, deactivatePassThrough},
+    {POWERUP_PAD_SIZE_INCREASE, "pad-size-increase", "powerup_increase", "resources/textures/powerup_increase.png", glm::vec3(1.0f, 0.6f, 0.4f), 0.0f, 75, activatePadSizeIncrease, nullptr},
+    {POWERUP_MULTI_BALL, "multi-ball", "powerup_multiball", "resources/textures/powerup_multiball.png", glm::vec3(0.4f, 0.9f, 1.0f), 0.0f, 75, activateMultiBall, nullptr},
+    {POWERUP_CONFUSE, "confuse", "powerup_confuse", "resources/textures/powerup_confuse.png", glm::vec3(1.0f, 0.3f, 0.3f), 15.0f, 15, activateConfuse, deactivateConfuse},
+    {POWERUP_CHAOS, "chaos", "powerup_chaos", "resources/textures/powerup_chaos.png", glm::vec3(0.9f, 0.25f, 0.25f), 15.0f, 15, activateChaos, deactivateChaos},
+};
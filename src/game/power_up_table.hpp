@@ -0,0 +1,35 @@
+#ifndef POWER_UP_TABLE_HPP
+#define POWER_UP_TABLE_HPP
+
+#include <glm/glm.hpp>
+
+#include "../entity/components.hpp"
+
+class Game;
+
+/**
+ * PowerUp 정의
+ *
+ * powerup 타입 하나의 생성 확률, 외형, 지속시간 및 효과 적용 / rollback 함수.
+ * -> 타입별 분기(문자열 비교)를 이 표 한 곳에 모아두고, Game 은 PowerUpType 값으로 표를 조회해서 함수를 호출하기만 함.
+ */
+struct PowerUpDefinition
+{
+  PowerUpType Type;
+  const char *Name;         // 타입 이름 (성능 overlay 표시 및 state hash 용)
+  const char *TextureName;  // ResourceManager 에 등록할 텍스쳐 이름
+  const char *TextureFile;  // 텍스쳐 이미지 파일 경로
+  glm::vec3 Color;          // powerup sprite 색상
+  float Duration;           // 효과 지속시간 (0.0f 는 효과 영구 적용)
+  unsigned int SpawnChance; // brick 파괴 시 1 / SpawnChance 확률로 생성
+
+  void (*Activate)(Game &game);   // 습득 시 게임 상태 변경
+  void (*Deactivate)(Game &game); // 같은 타입의 활성화된 powerup 이 모두 만료되었을 때 rollback (영구 적용 powerup 은 nullptr)
+};
+
+// PowerUpType 순서대로 정렬된 정의 표 (SpawnPowerUps() 는 이 순서대로 생성 확률을 계산함)
+extern const PowerUpDefinition POWERUP_DEFINITIONS[POWERUP_TYPE_COUNT];
+
+inline const PowerUpDefinition &GetPowerUpDefinition(PowerUpType type) { return POWERUP_DEFINITIONS[type]; }
+
+#endif /* POWER_UP_TABLE_HPP */
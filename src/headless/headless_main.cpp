@@ -0,0 +1,189 @@
+#include "../game/game.hpp"
+#include "../level/level_stream.hpp"
+#include "../replay/replay.hpp"
+#include "../profiler/cpu_profiler.hpp"
+#include "../utils/worker_pool.hpp"
+
+#include <iostream>
+#include <iomanip>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+/**
+ * breakout_headless
+ *
+ * 창, GL 컨텍스트, 오디오 장치 없이 게임 시뮬레이션(breakout_sim)만 실행하는 실행 파일.
+ * -> --replay 지정 시 입력 기록 파일을 최대 속도로 재생하고, 최종 게임 상태 hash 를 기록 시점의 hash 와 비교함.
+ * -> 그 외에는 ball 을 따라 paddle 을 움직이는 간단한 자동 입력으로 고정 delta time tick 을 N 번 진행하고 처리 속도를 출력함.
+ * -> --balls 지정 시 매 tick 마다 extra ball 개수를 그만큼 유지하는 multi-ball 부하 테스트 (--threads 개 스레드로 ball 이동 및 충돌 처리, 0 이면 하드웨어 스레드 개수)
+ * -> --manifest 지정 시 기본 level 목록 대신 해당 manifest 의 레벨로 진행 (streaming 레벨 테스트 등, 입력 기록 재생 시에도 기록할 때와 같은 manifest 여야 함)
+ *
+ * 사용법: breakout_headless [--replay FILE] [--manifest FILE] [--ticks N] [--seed S] [--dt SECONDS] [--balls N] [--threads T]
+ */
+
+/** 스크린 해상도 선언 (입력 기록 파일과 해상도가 같아야 같은 게임이 재현됨) */
+const unsigned int SCREEN_WIDTH = 800;
+const unsigned int SCREEN_HEIGHT = 600;
+
+// 자동 입력 -> 게임 상태에 따라 게임을 계속 진행시키는 키 입력을 결정함.
+static void autopilot(Game &game)
+{
+  // 메뉴 또는 승리 화면에서는 ENTER 키를 눌렀다 떼서 게임 재시작
+  bool menu = game.State != GAME_ACTIVE;
+  game.SetKey(GAME_KEY_ENTER, menu && !game.Keys[GAME_KEY_ENTER]);
+
+  // paddle 에 붙어있는 ball 은 발사
+  game.SetKey(GAME_KEY_SPACE, game.State == GAME_ACTIVE && game.Entities.Tags.Get(game.Ball).Has(ENTITY_STUCK));
+
+  // paddle 중심이 ball 중심을 따라가도록 좌우 이동
+  const TransformComponent &player = game.Entities.Transforms.Get(game.Player);
+  float paddleCenter = player.Position.x + player.Size.x / 2.0f;
+  float ballCenter = game.Entities.Transforms.Get(game.Ball).Position.x + game.Entities.Colliders.Get(game.Ball).Radius;
+  float deadZone = player.Size.x / 4.0f;
+  game.SetKey(GAME_KEY_A, ballCenter < paddleCenter - deadZone);
+  game.SetKey(GAME_KEY_D, ballCenter > paddleCenter + deadZone);
+}
+
+static const char *stateName(GameState state)
+{
+  switch (state)
+  {
+  case GAME_ACTIVE:
+    return "active";
+  case GAME_MENU:
+    return "menu";
+  case GAME_WIN:
+    return "win";
+  }
+  return "unknown";
+}
+
+int main(int argc, char *argv[])
+{
+  /** 커맨드라인 옵션 파싱 */
+  std::string replayPath;
+  std::string manifest = LEVEL_MANIFEST;
+  unsigned int ticks = 100000;
+  unsigned int seed = 1;
+  float dt = 1.0f / 60.0f;
+  unsigned int balls = 0;
+  unsigned int threads = 0;
+  for (int i = 1; i < argc; i++)
+  {
+    if (std::strcmp(argv[i], "--replay") == 0 && i + 1 < argc)
+    {
+      replayPath = argv[++i];
+    }
+    else if (std::strcmp(argv[i], "--manifest") == 0 && i + 1 < argc)
+    {
+      manifest = argv[++i];
+    }
+    else if (std::strcmp(argv[i], "--ticks") == 0 && i + 1 < argc)
+    {
+      ticks = static_cast<unsigned int>(std::strtoul(argv[++i], nullptr, 10));
+    }
+    else if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc)
+    {
+      seed = static_cast<unsigned int>(std::strtoul(argv[++i], nullptr, 10));
+    }
+    else if (std::strcmp(argv[i], "--dt") == 0 && i + 1 < argc)
+    {
+      dt = static_cast<float>(std::atof(argv[++i]));
+    }
+    else if (std::strcmp(argv[i], "--balls") == 0 && i + 1 < argc)
+    {
+      balls = static_cast<unsigned int>(std::strtoul(argv[++i], nullptr, 10));
+    }
+    else if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc)
+    {
+      threads = static_cast<unsigned int>(std::strtoul(argv[++i], nullptr, 10));
+    }
+    else
+    {
+      std::cout << "WARNING::HEADLESS: Unknown option '" << argv[i] << "'" << std::endl;
+    }
+  }
+
+  CpuProfiler::SetThreadName("main");
+
+  // 입력 기록 재생 (main.cpp 의 --replay 와 같은 순서로 seed 초기화 및 tick 진행)
+  if (!replayPath.empty())
+  {
+    ReplayPlayer replay;
+    if (!replay.Load(replayPath))
+    {
+      return 1;
+    }
+    if (replay.Width() != SCREEN_WIDTH || replay.Height() != SCREEN_HEIGHT)
+    {
+      std::cout << "ERROR::HEADLESS: Replay was recorded at " << replay.Width() << "x" << replay.Height() << ", expected " << SCREEN_WIDTH << "x" << SCREEN_HEIGHT << std::endl;
+      return 1;
+    }
+
+    Game game(SCREEN_WIDTH, SCREEN_HEIGHT);
+    game.Init(manifest.c_str());
+    game.Seed(replay.Seed());
+
+    std::vector<ReplayKeyEvent> events;
+    float tickDt = 0.0f;
+    while (replay.NextTick(tickDt, events))
+    {
+      unsigned long long tickStart = CpuProfiler::Now();
+      for (const ReplayKeyEvent &event : events)
+      {
+        game.SetKey(event.Key, event.Pressed);
+      }
+      game.ProcessInput(tickDt);
+      game.Update(tickDt);
+      replay.RecordTickTime((CpuProfiler::Now() - tickStart) / 1.0e6f);
+    }
+    return replay.Report(std::cout, game.StateHash()) ? 0 : 2;
+  }
+
+  // 자동 입력으로 고정 delta time tick 진행
+  Game game(SCREEN_WIDTH, SCREEN_HEIGHT);
+  game.Init(manifest.c_str());
+  game.ReserveBalls(balls);
+  game.Seed(seed);
+
+  // multi-ball 부하 테스트에서만 worker 스레드 생성 (스레드 개수와 무관하게 같은 결과가 나와야 함)
+  WorkerPool workers(balls > 0 ? threads : 1);
+  game.Workers = &workers;
+
+  unsigned long long start = CpuProfiler::Now();
+  for (unsigned int tick = 0; tick < ticks; tick++)
+  {
+    // 화면 밖으로 떨어진 만큼 extra ball 보충
+    if (game.State == GAME_ACTIVE && game.BallCount() - 1 < balls)
+    {
+      game.SpawnBalls(balls - (game.BallCount() - 1));
+    }
+    autopilot(game);
+    game.ProcessInput(dt);
+    game.Update(dt);
+  }
+  float totalMs = (CpuProfiler::Now() - start) / 1.0e6f;
+
+  std::cout << "HEADLESS: " << ticks << " ticks in " << std::fixed << std::setprecision(3) << totalMs << "ms ("
+            << (totalMs > 0.0f ? ticks * 1000.0f / totalMs : 0.0f) << " ticks/s)" << std::defaultfloat << std::endl;
+  std::cout << "HEADLESS: state " << stateName(game.State) << " | level " << game.Level + 1 << " | lives " << game.Lives
+            << " | live bricks " << game.Levels[game.Level].LiveBrickCount() << " | extra balls " << game.BallCount() - 1
+            << " | threads " << workers.ThreadCount() << std::endl;
+  GamePoolUsage pools = game.PoolUsage();
+  std::cout << "HEADLESS: pool high-water | entities " << pools.EntityHighWater << "/" << pools.EntityReserved << " reserved | powerups "
+            << pools.PowerUpHighWater << "/" << pools.PowerUpCapacity << " | timers " << pools.TimerHighWater << "/"
+            << pools.TimerCapacity << " | contacts/tick " << pools.ContactHighWater << std::endl;
+  const GameLevel &level = game.Levels[game.Level];
+  if (level.IsStreaming())
+  {
+    LevelStreamStats stream = level.StreamStats();
+    std::cout << "HEADLESS: level stream | bricks " << level.BrickCount() << " | resident cells " << level.FirstCell() << "-" << level.EndCell()
+              << " | camera y " << game.View.Position.y << " | chunk loads " << stream.Loads << " | prefetch hits " << stream.Hits
+              << " | stalls " << stream.Stalls << std::endl;
+  }
+  std::cout << "HEADLESS: final state hash 0x" << std::hex << std::setw(16) << std::setfill('0') << game.StateHash()
+            << std::dec << std::setfill(' ') << std::endl;
+  return 0;
+}
@@ -1,136 +1,448 @@
 #include "game_level.hpp"
 
-#include <fstream>
-#include <sstream>
+#include "level_file.hpp"
+#include "level_stream.hpp"
 
-void GameLevel::Load(const char *file, unsigned int levelWidth, unsigned int levelHeight)
-{
-  // 이전 Bricks 데이터 제거
-  this->Bricks.clear();
+#include <iostream>
+#include <algorithm>
+#include <cstring>
 
-  // std::ifstream 생성자 함수를 호출하여 .lvl 파일 열기
-  unsigned int tileCode;
-  std::string line;
-  std::ifstream fstream(file);
+GameLevel::GameLevel()
+    : columns(0), rows(0), cellSize(0.0f), top(0.0f), firstRow(0), endRow(0), firstCell(0), firstChunk(0), residentChunks(0), liveCount(0), remaining(0), destroyedCount(0) {};
 
-  // .lvl 파일에서 읽은 레벨 데이터를 파싱하여 저장할 tileData 컨테이너 선언
-  std::vector<std::vector<unsigned int>> tileData;
+bool GameLevel::Load(const char *file, unsigned int levelWidth, unsigned int levelHeight)
+{
+  // 이전 template, streamer, brick 데이터 및 grid 제거
+  this->layout.reset();
+  this->streamer.reset();
+  this->columns = 0;
+  this->rows = 0;
+  this->top = 0.0f;
+  this->Reset();
 
-  if (fstream)
+  // .lvl(text) 또는 .blvl(binary) 파일을 flat tile 버퍼로 파싱 (형식은 level_file.hpp 참고)
+  // (binary 파일은 mapping 된 tile byte 를 그대로 읽으므로 init() 이 끝날 때까지 mapping 유지)
+  MappedFile mapping;
+  LevelData level;
+  LevelError error;
+  if (!ReadLevelFile(file, mapping, level, error))
   {
-    // .lvl 파일을 한 줄씩 읽으면서 파싱
-    while (std::getline(fstream, line))
+    std::cout << "ERROR::LEVEL: Failed to load " << file;
+    if (error.Line > 0)
     {
-      // .lvl 파일의 각 줄을 '문자열 입력 스트림'으로 초기화 -> 각 문자열의 내용을 순차적으로 읽거나 분석하기 위해!
-      std::istringstream sstream(line);
+      std::cout << " (line " << error.Line << ", column " << error.Column << ")";
+    }
+    std::cout << ": " << error.Message << std::endl;
+    return false;
+  }
 
-      // .lvl 파일에서 각 줄의 level 값을 읽어서 저장할 컨테이너 선언
-      std::vector<unsigned int> row;
+  // 로드 직후 상태를 template 으로 만들어 두고, 플레이 상태는 template 을 복사해서 시작
+  std::shared_ptr<LevelTemplate> layout(new LevelTemplate());
+  this->init(level, levelWidth, levelHeight, *layout);
+  this->layout = layout;
+  this->Reset();
+  return true;
+};
 
-      // 더 이상 읽을 데이터가 없을 때까지 공백을 기준으로 문자열 스트림 버퍼에 저장된 level 값을 하나씩 읽어서 tileCode 에 복사함.
-      // 참고로, std::istringstream >> std::string (= 스트림 추출 연산)을 할 경우, 한 번 읽은 데이터는 스트림 버퍼에서 제거됨.
-      while (sstream >> tileCode)
-      {
-        row.push_back(tileCode);
-      }
+bool GameLevel::Stream(const char *file, unsigned int levelWidth, unsigned int levelHeight)
+{
+  // 이전 template, streamer, brick 데이터 및 grid 제거
+  this->layout.reset();
+  this->streamer.reset();
+  this->columns = 0;
+  this->rows = 0;
+  this->top = 0.0f;
+  this->Reset();
 
-      // 각 줄을 순회하며 스트림 추출 연산을 완료했다면, 각 줄의 level 값이 저장된 컨테이너를 tileData 컨테이너에 동적으로 추가
-      tileData.push_back(row);
-    }
+  // header 및 tile code 검사 후 background 스레드 시작 (tile byte 는 chunk 단위로 필요할 때만 읽음)
+  std::shared_ptr<LevelStreamer> streamer(new LevelStreamer());
+  LevelError error;
+  if (!streamer->Open(file, error))
+  {
+    std::cout << "ERROR::LEVEL: Failed to stream " << file << ": " << error.Message << std::endl;
+    return false;
+  }
 
-    // .lvl 파일이 파싱된 tileData 컨테이너를 init 함수의 파라미터로 전달하여 실행
-    if (tileData.size() > 0)
-    {
-      this->init(tileData, levelWidth, levelHeight);
-    }
+  // brick 크기는 일반 레벨과 비슷하게 맞추고, 맨 아래 행이 levelHeight 에 오도록 위쪽으로 쌓아 올림
+  this->columns = streamer->Columns();
+  this->rows = streamer->Rows();
+  this->cellSize = glm::vec2(levelWidth / static_cast<float>(this->columns), levelHeight / static_cast<float>(LEVEL_STREAM_SCREEN_ROWS));
+  this->top = levelHeight - this->rows * this->cellSize.y;
+  if (-this->top > LEVEL_STREAM_PRECISE_HEIGHT)
+  {
+    std::cout << "WARNING::LEVEL: " << file << " is " << this->rows << " rows tall, positions near the top lose sub-pixel precision" << std::endl;
   }
+  this->residentChunks = std::min(LEVEL_STREAM_RESIDENT_CHUNKS, streamer->ChunkCount());
+  this->streamer = streamer;
+
+  // 파괴 기록 bitset 은 여기서 한 번만 할당 (chunk 의 cell 개수가 64 의 배수이므로 chunk 마다 word 단위로 나뉨)
+  this->destroyed.assign(static_cast<std::size_t>(streamer->ChunkCount()) * LEVEL_CHUNK_ROWS * this->columns / 64, 0ull);
+  this->Reset();
+  return true;
+};
+
+unsigned int GameLevel::BrickCount() const
+{
+  if (this->streamer)
+  {
+    return static_cast<unsigned int>(this->streamer->BrickCount());
+  }
+  return this->layout ? this->layout->BrickCount : 0;
 };
 
-void GameLevel::Draw(SpriteRenderer &renderer)
+unsigned int GameLevel::SolidBrickCount() const
 {
-  // 전달받은 SpriteRenderer 를 통해 Bricks 컨테이너를 순회하며 렌더링
-  for (GameObejct &tile : this->Bricks)
+  if (this->streamer)
   {
-    // 아직 파괴되지 않은 Brick 만 렌더링
-    if (!tile.Destroyed)
+    return static_cast<unsigned int>(this->streamer->SolidCount());
+  }
+  return this->layout ? this->layout->SolidCount : 0;
+};
+
+bool GameLevel::IsCompleted() const
+{
+  // streaming 레벨의 remaining 은 resident window 안의 개수뿐이므로, 레벨 전체의 non-solid brick 개수와 파괴된 개수를 비교함
+  if (this->streamer)
+  {
+    return this->streamer->BrickCount() - this->streamer->SolidCount() == this->destroyedCount;
+  }
+  return this->remaining == 0;
+};
+
+LevelStreamStats GameLevel::StreamStats() const
+{
+  return this->streamer ? this->streamer->Stats() : LevelStreamStats();
+};
+
+void GameLevel::Reset()
+{
+  this->firstRow = 0;
+  this->firstCell = 0;
+  this->endRow = this->rows;
+  this->destroyedCount = 0;
+
+  // streaming 레벨은 파괴 기록을 지우고 맨 아래 chunk 들로 window 를 다시 채움 (window 크기가 같으므로 resize() 는 아무것도 하지 않음)
+  if (this->streamer)
+  {
+    std::size_t cells = static_cast<std::size_t>(this->residentChunks) * LEVEL_CHUNK_ROWS * this->columns;
+    this->tiles.resize(cells);
+    this->alive.resize(cells / 64);
+    std::fill(this->destroyed.begin(), this->destroyed.end(), 0ull);
+    this->loadWindow(this->streamer->ChunkCount() - this->residentChunks);
+    return;
+  }
+
+  if (!this->layout)
+  {
+    this->tiles.clear();
+    this->alive.clear();
+    this->destroyed.clear();
+    this->liveCount = 0;
+    this->remaining = 0;
+    return;
+  }
+
+  // 같은 레벨이면 크기가 같으므로 resize() 는 아무것도 하지 않음 -> memcpy 두 번으로 복원 (파일 입출력, 파싱, heap 할당 없음)
+  this->tiles.resize(this->layout->Tiles.size());
+  this->alive.resize(this->layout->Alive.size());
+  std::memcpy(this->tiles.data(), this->layout->Tiles.data(), this->tiles.size());
+  std::memcpy(this->alive.data(), this->layout->Alive.data(), this->alive.size() * sizeof(unsigned long long));
+  this->liveCount = this->layout->BrickCount;
+  this->remaining = this->layout->BrickCount - this->layout->SolidCount;
+};
+
+glm::vec3 GameLevel::TileColor(unsigned int tileCode)
+{
+  // tile 값에 따라 서로 다른 색상으로 렌더링되도록 색상값 계산 (solid brick 은 1)
+  switch (tileCode)
+  {
+  case 1:
+    return glm::vec3(0.8f, 0.8f, 0.7f);
+  case 2:
+    return glm::vec3(0.2f, 0.6f, 1.0f);
+  case 3:
+    return glm::vec3(0.0f, 0.7f, 0.0f);
+  case 4:
+    return glm::vec3(0.8f, 0.8f, 0.4f);
+  case 5:
+    return glm::vec3(1.0f, 0.5f, 0.0f);
+  default:
+    return glm::vec3(1.0f);
+  }
+};
+
+bool GameLevel::HitBrick(unsigned int brick)
+{
+  if (!this->IsAlive(brick) || this->IsSolid(brick))
+  {
+    return false;
+  }
+
+  // hit point 1 감소 (상위 4bit)
+  unsigned int hitPoints = this->HitPoints(brick) - 1;
+  this->tiles[brick - this->firstCell] = static_cast<unsigned char>((hitPoints << BRICK_HIT_POINT_SHIFT) | this->TileCode(brick));
+  if (hitPoints > 0)
+  {
+    return false;
+  }
+
+  // 파괴 -> bitset 및 남은 brick 개수 갱신 (streaming 레벨은 window 밖으로 나갔다 돌아와도 유지되도록 파괴 기록도 남김)
+  unsigned int cell = brick - this->firstCell;
+  this->alive[cell >> 6] &= ~(1ull << (cell & 63));
+  if (!this->destroyed.empty())
+  {
+    this->destroyed[brick >> 6] |= 1ull << (brick & 63);
+  }
+  this->liveCount--;
+  this->remaining--;
+  this->destroyedCount++;
+  return true;
+};
+
+void GameLevel::QueryBricks(glm::vec2 min, glm::vec2 max, std::vector<unsigned int> &out) const
+{
+  // brick 영역(0 ~ columns * cellSize.x, Top() ~ Bottom()) 밖이라면 검사할 cell 이 없음
+  if (this->tiles.empty() || max.x < 0.0f || max.y < this->top || min.x >= this->columns * this->cellSize.x || min.y >= this->Bottom())
+  {
+    return;
+  }
+
+  // AABB 가 걸쳐있는 cell 범위 계산 (경계에 정확히 닿는 경우도 충돌로 판정하므로 경계 cell 까지 포함)
+  // -> streaming 레벨은 resident window 의 행만 검사함 (window 밖의 행은 빈 칸으로 취급)
+  float minY = min.y - this->top, maxY = max.y - this->top;
+  unsigned int x0 = min.x <= 0.0f ? 0 : static_cast<unsigned int>(min.x / this->cellSize.x);
+  unsigned int y0 = minY <= 0.0f ? 0 : static_cast<unsigned int>(minY / this->cellSize.y);
+  unsigned int x1 = std::min(this->columns - 1, static_cast<unsigned int>(max.x / this->cellSize.x));
+  unsigned int y1 = std::min(this->rows - 1, static_cast<unsigned int>(maxY / this->cellSize.y));
+  y0 = std::max(y0, this->firstRow);
+  y1 = std::min(y1, this->endRow - 1);
+
+  for (unsigned int y = y0; y <= y1; y++)
+  {
+    for (unsigned int x = x0; x <= x1; x++)
     {
-      tile.Draw(renderer);
+      unsigned int brick = y * this->columns + x;
+      if (this->IsAlive(brick))
+      {
+        out.push_back(brick);
+      }
     }
   }
 };
 
-bool GameLevel::IsCompleted()
+// 행 우선 순서의 tile code 를 tile byte 로 변환하고 bitset 에 brick 위치 기록 (alive 는 0 으로 초기화된 상태, cell 0 이 word 의 0 번 bit) 및 개수 누적
+static void initTiles(const unsigned char *codes, std::size_t count, unsigned char *tiles, unsigned long long *alive, unsigned long long &bricks, unsigned long long &solid)
+{
+  /**
+   * 행 우선 순서의 tile code 를 8 cell 씩 하나의 64bit 정수로 묶어서 tile byte, bitset, 개수를 한 번에 계산 (SWAR, tile code 는 파싱 시 4bit 로 제한됨)
+   * -> byte 마다 (tile code + 0x7F) 의 최상위 bit 는 tile code 가 0 이 아닐 때만 1 이 됨. (tile code 가 15 이하이므로 옆 byte 로 올림이 넘어가지 않음)
+   * -> 8 byte 의 최상위 bit 를 곱셈 한 번으로 bitset 의 연속된 8 bit 로 모음. (byte 순서는 little-endian 기준 -> x86, ARM, level_file.hpp 의 guard 로 확인)
+   * -> 개수는 지역 변수에 누적함. (unsigned char 버퍼에 쓰면 compiler 가 참조로 받은 개수도 바뀔 수 있다고 보고 매번 다시 읽고 쓰기 때문)
+   * -> 각 word 를 읽은 뒤 같은 위치에 쓰므로 codes 와 tiles 가 같은 버퍼여도 됨. (streaming 레벨은 chunk 를 tiles 에 복사한 뒤 제자리에서 변환)
+   */
+  const unsigned long long BYTE_ONES = 0x0101010101010101ull;
+  const unsigned long long BYTE_HIGH_BITS = 0x8080808080808080ull;
+  const unsigned long long NON_ZERO_CARRY = 0x7F7F7F7F7F7F7F7Full;
+  const unsigned long long GATHER_BITS = 0x0102040810204080ull;
+
+  unsigned long long brickCount = 0, solidCount = 0;
+  std::size_t cell = 0;
+  for (; cell + 8 <= count; cell += 8)
+  {
+    unsigned long long word;
+    std::memcpy(&word, codes + cell, sizeof(word));
+
+    // byte 별 1: 빈 칸이 아닌 cell / tile code 가 2 이상인 non-solid brick (하위 1bit 를 지우고 0 이 아닌 지 검사)
+    unsigned long long occupied = ((word + NON_ZERO_CARRY) & BYTE_HIGH_BITS) >> 7;
+    unsigned long long breakable = (((word & ~BYTE_ONES) + NON_ZERO_CARRY) & BYTE_HIGH_BITS) >> 7;
+
+    // non-solid brick 은 한 번 충돌하면 파괴됨 (solid brick 및 빈 칸은 hit point 를 사용하지 않음)
+    word |= breakable << BRICK_HIT_POINT_SHIFT;
+    std::memcpy(tiles + cell, &word, sizeof(word));
+
+    alive[cell >> 6] |= ((occupied * GATHER_BITS) >> 56) << (cell & 63);
+    brickCount += (occupied * BYTE_ONES) >> 56;
+    solidCount += ((occupied & ~breakable) * BYTE_ONES) >> 56;
+  }
+  for (; cell < count; ++cell)
+  {
+    unsigned int tileCode = codes[cell];
+    unsigned int hitPoints = tileCode > BRICK_SOLID_TILE ? 1 : 0;
+    tiles[cell] = static_cast<unsigned char>((hitPoints << BRICK_HIT_POINT_SHIFT) | tileCode);
+    alive[cell >> 6] |= static_cast<unsigned long long>(tileCode != 0) << (cell & 63);
+    brickCount += tileCode != 0;
+    solidCount += tileCode == BRICK_SOLID_TILE;
+  }
+  bricks += brickCount;
+  solid += solidCount;
+}
+
+void GameLevel::init(const LevelData &level, unsigned int levelWidth, unsigned int levelHeight, LevelTemplate &layout)
+{
+  // 각 block 의 pixel 단위 크기 계산
+  float unit_width = levelWidth / static_cast<float>(level.Columns);
+  float unit_height = levelHeight / static_cast<float>(level.Rows);
+
+  // brick 배치 grid 초기화 (tile 하나가 cell 하나)
+  this->columns = level.Columns;
+  this->rows = level.Rows;
+  this->cellSize = glm::vec2(unit_width, unit_height);
+  std::size_t cellCount = level.CellCount();
+  layout.Tiles.resize(cellCount);
+  layout.Alive.assign((cellCount + 63) / 64, 0ull);
+
+  unsigned long long brickCount = 0, solidCount = 0;
+  initTiles(level.Tiles, cellCount, layout.Tiles.data(), layout.Alive.data(), brickCount, solidCount);
+  layout.BrickCount = static_cast<unsigned int>(brickCount);
+  layout.SolidCount = static_cast<unsigned int>(solidCount);
+};
+
+void GameLevel::UpdateStreaming(float viewTop, float viewBottom)
 {
-  for (GameObejct &tile : this->Bricks)
+  if (!this->streamer)
   {
-    // non-solid brick 들 중에서 아직 파괴되지 않고 남아있는 Brick 이 하나라도 있다면 false 를 반환
-    if (!tile.IsSolid && !tile.Destroyed)
+    return;
+  }
+
+  // 카메라 중심이 있는 chunk 가 window 가운데에 오도록 window 의 첫 chunk 결정 (레벨 끝에서는 window 가 레벨 밖으로 나가지 않도록 고정)
+  float center = 0.5f * (viewTop + viewBottom) - this->top;
+  unsigned int row = center <= 0.0f ? 0 : std::min(this->rows - 1, static_cast<unsigned int>(center / this->cellSize.y));
+  unsigned int centerChunk = row / LEVEL_CHUNK_ROWS;
+  unsigned int first = centerChunk > this->residentChunks / 2 ? centerChunk - this->residentChunks / 2 : 0;
+  first = std::min(first, this->streamer->ChunkCount() - this->residentChunks);
+  if (first == this->firstChunk)
+  {
+    return;
+  }
+
+  // 겹치는 chunk 가 없을 만큼 멀리 이동했다면 window 전체를 다시 채움
+  if (first + this->residentChunks <= this->firstChunk || first >= this->firstChunk + this->residentChunks)
+  {
+    for (unsigned int slot = 0; slot < this->residentChunks; slot++)
     {
-      return false;
+      this->evictChunk(slot);
     }
+    this->loadWindow(first);
+    return;
   }
 
-  // 파괴될 수 있는 모든 brick 들이 파괴되었다면 true 를 반환
-  return true;
+  /**
+   * window 를 chunk 하나씩 이동
+   * -> 밀려나는 chunk 를 버리고 남은 chunk 들의 tile byte, bitset 을 memmove 로 한 chunk 만큼 당긴 뒤, 빈 자리에 새 chunk 를 복사함.
+   * -> chunk 의 cell 개수가 64 의 배수이므로 bitset 도 word 단위로 그대로 옮기면 됨.
+   */
+  std::size_t chunkCells = static_cast<std::size_t>(LEVEL_CHUNK_ROWS) * this->columns;
+  std::size_t chunkWords = chunkCells / 64;
+  std::size_t keptCells = chunkCells * (this->residentChunks - 1);
+  while (this->firstChunk > first)
+  {
+    // 위로 이동: 맨 아래 chunk 를 버리고 나머지를 한 칸 아래 slot 으로
+    this->evictChunk(this->residentChunks - 1);
+    std::memmove(this->tiles.data() + chunkCells, this->tiles.data(), keptCells);
+    std::memmove(this->alive.data() + chunkWords, this->alive.data(), keptCells / 64 * sizeof(unsigned long long));
+    this->setWindow(this->firstChunk - 1);
+    this->loadChunk(0);
+  }
+  while (this->firstChunk < first)
+  {
+    // 아래로 이동: 맨 위 chunk 를 버리고 나머지를 한 칸 위 slot 으로
+    this->evictChunk(0);
+    std::memmove(this->tiles.data(), this->tiles.data() + chunkCells, keptCells);
+    std::memmove(this->alive.data(), this->alive.data() + chunkWords, keptCells / 64 * sizeof(unsigned long long));
+    this->setWindow(this->firstChunk + 1);
+    this->loadChunk(this->residentChunks - 1);
+  }
+  this->prefetchAround();
 };
 
-void GameLevel::init(std::vector<std::vector<unsigned int>> tileData, unsigned int levelWidth, unsigned int levelHeight)
+void GameLevel::setWindow(unsigned int first)
 {
-  // tileData 의 행과 열 수를 계산
-  unsigned int rows = tileData.size();
-  unsigned int columns = tileData[0].size();
+  this->firstChunk = first;
+  this->firstRow = first * LEVEL_CHUNK_ROWS;
+  this->endRow = std::min(this->rows, this->firstRow + this->residentChunks * LEVEL_CHUNK_ROWS);
+  this->firstCell = this->firstRow * this->columns;
+};
 
-  // 각 block 의 pixel 단위 크기 계산
-  float unit_width = levelWidth / static_cast<float>(columns);
-  float unit_height = levelHeight / static_cast<float>(rows);
+void GameLevel::loadWindow(unsigned int first)
+{
+  this->setWindow(first);
+  this->liveCount = 0;
+  this->remaining = 0;
+  // window 전체를 먼저 요청해서, 앞쪽 chunk 를 복사하는 동안 뒤쪽 chunk 를 background 스레드가 읽도록 함
+  for (unsigned int slot = 0; slot < this->residentChunks; slot++)
+  {
+    this->streamer->Prefetch(this->firstChunk + slot);
+  }
+  for (unsigned int slot = 0; slot < this->residentChunks; slot++)
+  {
+    this->loadChunk(slot);
+  }
+  this->prefetchAround();
+};
+
+void GameLevel::prefetchAround()
+{
+  // 카메라가 이어서 움직일 방향의 chunk 를 background 스레드가 미리 읽어두도록 요청
+  if (this->firstChunk > 0)
+  {
+    this->streamer->Prefetch(this->firstChunk - 1);
+  }
+  this->streamer->Prefetch(this->firstChunk + this->residentChunks);
+};
+
+void GameLevel::loadChunk(unsigned int slot)
+{
+  unsigned int chunk = this->firstChunk + slot;
+  std::size_t chunkCells = static_cast<std::size_t>(LEVEL_CHUNK_ROWS) * this->columns;
+  unsigned char *tiles = this->tiles.data() + slot * chunkCells;
+  unsigned long long *alive = this->alive.data() + slot * chunkCells / 64;
 
-  // tileData 를 순회하며 각 Brick 에 대응되는 GameObject 인스턴스 생성
-  for (unsigned int y = 0; y < rows; ++y)
+  // 행이 모자란 마지막 chunk 의 나머지 cell 및 읽기에 실패한 chunk 는 빈 칸으로 남음
+  std::memset(tiles, 0, chunkCells);
+  std::memset(alive, 0, chunkCells / 64 * sizeof(unsigned long long));
+  if (!this->streamer->Read(chunk, tiles))
   {
-    for (unsigned int x = 0; x < columns; ++x)
+    return;
+  }
+  unsigned long long brickCount = 0, solidCount = 0;
+  initTiles(tiles, chunkCells, tiles, alive, brickCount, solidCount);
+
+  // 이전에 window 밖으로 나가기 전 파괴된 brick 반영 (파괴된 brick 은 항상 non-solid brick 이고, hit point 가 0)
+  const unsigned long long *saved = this->destroyed.data() + chunk * chunkCells / 64;
+  for (std::size_t word = 0; word < chunkCells / 64; word++)
+  {
+    unsigned long long destroyed = alive[word] & saved[word];
+    alive[word] &= ~destroyed;
+    for (; destroyed != 0; destroyed &= destroyed - 1)
     {
-      if (tileData[y][x] == 1)
+      unsigned int bit = 0;
+      while (((destroyed >> bit) & 1ull) == 0)
       {
-        /** Brick 타입이 solid 인 경우 */
-        // 현재 tile 의 행과 열을 기반으로 Brick 의 위치(= 2D Sprite 의 좌상단 좌표값) 및 크기 계산
-        glm::vec2 pos(unit_width * x, unit_height * y);
-        glm::vec2 size(unit_width, unit_height);
-
-        // 현재 Brick 에 대응되는 GameObject 인스턴스 생성 및 컨테이너에 추가
-        GameObejct obj(pos, size, ResourceManager::GetTexture("block_solid"), glm::vec3(0.8f, 0.8f, 0.7f));
-        obj.IsSolid = true;
-        this->Bricks.push_back(obj);
-      }
-      else if (tileData[y][x] > 1)
-      {
-        /** Brick 타입이 solid 가 아닌 경우 */
-        // 현재 tile 값에 따라 서로 다른 색상으로 렌더링되도록 색상값 계산
-        glm::vec3 color = glm::vec3(1.0f);
-        if (tileData[y][x] == 2)
-        {
-          color = glm::vec3(0.2f, 0.6f, 1.0f);
-        }
-        else if (tileData[y][x] == 3)
-        {
-          color = glm::vec3(0.0f, 0.7f, 0.0f);
-        }
-        else if (tileData[y][x] == 4)
-        {
-          color = glm::vec3(0.8f, 0.8f, 0.4f);
-        }
-        else if (tileData[y][x] == 5)
-        {
-          color = glm::vec3(1.0f, 0.5f, 0.0f);
-        }
-
-        // 현재 tile 의 행과 열을 기반으로 Brick 의 위치(= 2D Sprite 의 좌상단 좌표값) 및 크기 계산
-        glm::vec2 pos(unit_width * x, unit_height * y);
-        glm::vec2 size(unit_width, unit_height);
-
-        // 현재 Brick 에 대응되는 GameObject 인스턴스 생성 및 컨테이너에 추가
-        this->Bricks.push_back(
-            GameObejct(pos, size, ResourceManager::GetTexture("block"), color));
+        bit++;
       }
+      tiles[word * 64 + bit] &= BRICK_TILE_MASK;
+      brickCount--;
     }
   }
+  this->liveCount += static_cast<unsigned int>(brickCount);
+  this->remaining += static_cast<unsigned int>(brickCount - solidCount);
+};
+
+void GameLevel::evictChunk(unsigned int slot)
+{
+  std::size_t chunkCells = static_cast<std::size_t>(LEVEL_CHUNK_ROWS) * this->columns;
+  const unsigned char *tiles = this->tiles.data() + slot * chunkCells;
+  const unsigned long long *alive = this->alive.data() + slot * chunkCells / 64;
+
+  // chunk 의 남은 brick 을 개수에서 뺌 (파괴된 brick 은 HitBrick() 에서 이미 destroyed 에 기록했으므로 따로 보관할 것이 없음)
+  unsigned int live = 0, solid = 0;
+  for (std::size_t cell = 0; cell < chunkCells; cell++)
+  {
+    unsigned int tileCode = tiles[cell] & BRICK_TILE_MASK;
+    bool isAlive = (alive[cell >> 6] >> (cell & 63)) & 1ull;
+    live += isAlive;
+    solid += isAlive && tileCode == BRICK_SOLID_TILE;
+  }
+  this->liveCount -= live;
+  this->remaining -= live - solid;
 };
@@ -2,35 +2,163 @@
 #define GAME_LEVEL_HPP
 
 #include <vector>
+#include <memory>
 
-#include <glad/glad.h>
 #include <glm/glm.hpp>
 
-#include "../game_object/game_object.hpp"
-#include "../renderer/sprite_renderer.hpp"
-#include "../manager/resource_manager.hpp"
+struct LevelData;
+struct LevelStreamStats;
+class LevelStreamer;
 
+// tile byte 구성 -> 하위 4bit: tile code (0: 빈 칸, 1: solid brick, 2 ~ 15: 색상별 non-solid brick), 상위 4bit: 남은 hit point
+const unsigned int BRICK_TILE_MASK = 0x0F;
+const unsigned int BRICK_HIT_POINT_SHIFT = 4;
+const unsigned int BRICK_SOLID_TILE = 1;
+
+// streaming 레벨에서 메모리에 올려두는 chunk 개수 (카메라가 있는 chunk 와 그 위아래 chunk, chunk 크기는 level_stream.hpp 참고)
+const unsigned int LEVEL_STREAM_RESIDENT_CHUNKS = 3;
+
+// streaming 레벨에서 levelHeight 영역에 들어가는 행 개수 -> 레벨 전체 높이와 무관하게 brick 크기를 일반 레벨과 비슷하게 맞춤
+const unsigned int LEVEL_STREAM_SCREEN_ROWS = 8;
+
+// float 좌표가 1/4 pixel 이하의 정밀도를 유지하는 레벨 높이 (streaming 레벨이 이보다 높으면 로드 시 경고)
+const float LEVEL_STREAM_PRECISE_HEIGHT = 4194304.0f;
+
+// 로드 직후의 레벨 상태 (cell 별 tile byte, 파괴 여부 bitset, brick 개수)
+// -> 생성 후에는 바뀌지 않으므로, 같은 레벨을 복사한 GameLevel 들(BatchEnv 의 게임 인스턴스 등)이 하나를 함께 참조함
+struct LevelTemplate
+{
+  std::vector<unsigned char> Tiles;
+  std::vector<unsigned long long> Alive;
+  unsigned int BrickCount, SolidCount;
+
+  LevelTemplate() : BrickCount(0), SolidCount(0) {};
+};
+
+/**
+ * GameLevel 클래스
+ *
+ * 레벨 파일의 tile 배치를 cell 하나 당 1 byte (tile code + hit point) 와 파괴 여부 bitset 으로 보관하는 클래스.
+ * -> brick 의 위치, 크기, 색상은 cell index 와 tile code 로부터 계산하므로 따로 저장하지 않음.
+ * -> 'brick index' 는 행 우선 순서의 cell index (y * columns + x) 이며, 빈 칸의 cell index 는 brick 으로 사용되지 않음.
+ * -> 남은 non-solid brick 개수를 파괴 시점마다 갱신하므로, 레벨 클리어 여부는 brick 들을 순회하지 않고 바로 알 수 있음.
+ *
+ * 레벨 파일은 Load() 에서 한 번만 파싱하여 변하지 않는 LevelTemplate 으로 만들고, 플레이 중 바뀌는 상태(hit point, 파괴 여부)는 별도의 배열에 둠.
+ * -> Reset() 은 template 을 memcpy 로 복사할 뿐이므로, 레벨 크기와 무관하게 파일 입출력 없이 즉시 처음 상태로 되돌아감.
+ *
+ * Stream() 으로 로드한 streaming 레벨은 카메라 주변의 LEVEL_STREAM_RESIDENT_CHUNKS 개 chunk 만 tile byte 및 bitset 으로 보관함. (resident window)
+ * -> 레벨의 맨 아래 행이 levelHeight 에 오도록 배치하고 위쪽(음수 y)으로 쌓아 올리므로, 아래에서 시작해서 위로 올라가며 진행함.
+ * -> UpdateStreaming() 이 카메라 위치에 맞춰 window 를 chunk 단위로 옮기고, 새로 들어온 chunk 는 LevelStreamer 가 background 스레드에서 미리 읽어둔 것을 복사함.
+ * -> brick index 는 레벨 전체 기준의 cell index 그대로이며, window 밖의 brick 은 IsAlive() 등으로 조회할 수 없음. (FirstCell() ~ EndCell() 범위만 유효)
+ * -> window 밖으로 나간 chunk 는 버리고, 파괴 기록은 Stream() 에서 미리 할당한 레벨 전체의 bitset(cell 당 1 bit)에만 남김.
+ *    -> 메모리 사용량은 window 크기에 비례하는 tile byte 및 bitset 에 cell 개수 / 8 byte 를 더한 만큼이며, window 이동 중에는 heap 할당이 없음.
+ */
 class GameLevel
 {
 public:
-  // game level 을 구성하는 각 Brick 들을 GameObject 클래스 인스턴스로 생성해서 저장할 std::vector 컨테이너
-  // (참고로, 가급적 std::vector 컨테이너에는 인스턴스 자체를 복사하여 추가하는 방식보다는, 스마트 포인터로 주소값을 추가하는 방식이 더 나을 것임.)
-  std::vector<GameObejct> Bricks;
+  GameLevel();
+
+  // .lvl(text) 또는 .blvl(binary) 레벨 파일을 로드하는 함수 -> 실패 시 오류 위치를 출력하고 빈 레벨로 남음
+  bool Load(const char *file, unsigned int levelWidth, unsigned int levelHeight);
+
+  // binary 레벨 파일(.blvl)을 streaming 레벨로 로드 (파일 전체를 메모리에 올리지 않음) -> 실패 시 원인을 출력하고 빈 레벨로 남음
+  bool Stream(const char *file, unsigned int levelWidth, unsigned int levelHeight);
+
+  // 모든 brick 을 로드 직후 상태로 복원 (로드한 template 복사, streaming 레벨은 맨 아래 chunk 들을 다시 읽고 파괴 기록 삭제)
+  void Reset();
+
+  // streaming 레벨의 resident window 를 카메라 영역 [viewTop, viewBottom] (world y 좌표) 주변으로 이동 (일반 레벨은 아무것도 하지 않음)
+  // -> 필요한 chunk 가 아직 읽히지 않았다면 읽힐 때까지 대기하므로, 결과는 파일 읽기 속도와 무관함
+  void UpdateStreaming(float viewTop, float viewBottom);
+
+  bool IsStreaming() const { return this->streamer != nullptr; };
+
+  // streaming 레벨의 chunk 읽기 통계 (같은 레벨을 복사한 GameLevel 들의 합계, 일반 레벨은 모두 0)
+  LevelStreamStats StreamStats() const;
 
-  GameLevel() {};
+  // non-solid bricks 파괴 완료 여부 (= 게임 클리어를 뜻함.) -> streaming 레벨은 window 밖의 brick 까지 포함하여 레벨 전체의 non-solid brick 을 모두 파괴한 경우
+  bool IsCompleted() const;
 
-  // .lvl 파일을 로드하여 tileData 로 파싱하는 함수
-  void Load(const char *file, unsigned int levelWidth, unsigned int levelHeight);
+  // 아직 파괴되지 않은 brick 개수 (solid brick 포함, streaming 레벨은 resident window 안의 개수)
+  unsigned int LiveBrickCount() const { return this->liveCount; };
 
-  // draw call 호출 함수
-  void Draw(SpriteRenderer &renderer);
+  // 로드한 레벨 파일의 brick 개수 (빈 칸 제외, 파괴 여부와 무관) 및 그 중 solid brick 개수
+  unsigned int BrickCount() const;
+  unsigned int SolidBrickCount() const;
 
-  // non-solid bricks 파괴 완료 여부 (= 게임 클리어를 뜻함.)
-  bool IsCompleted();
+  // cell 개수 (brick index 범위는 0 ~ CellCount() - 1)
+  unsigned int CellCount() const { return this->columns * this->rows; };
+
+  // 상태를 조회할 수 있는 brick index 범위 [FirstCell(), EndCell()) -> 일반 레벨은 0 ~ CellCount(), streaming 레벨은 resident window
+  unsigned int FirstCell() const { return this->firstCell; };
+  unsigned int EndCell() const { return this->endRow * this->columns; };
+
+  /** brick 하나의 상태 조회 (brick 은 빈 칸이 아닌 cell index) */
+  bool IsAlive(unsigned int brick) const
+  {
+    unsigned int cell = brick - this->firstCell;
+    return (this->alive[cell >> 6] >> (cell & 63)) & 1ull;
+  };
+  bool IsSolid(unsigned int brick) const { return this->TileCode(brick) == BRICK_SOLID_TILE; };
+  unsigned int TileCode(unsigned int brick) const { return this->tiles[brick - this->firstCell] & BRICK_TILE_MASK; };
+  unsigned int HitPoints(unsigned int brick) const { return this->tiles[brick - this->firstCell] >> BRICK_HIT_POINT_SHIFT; };
+
+  // brick 의 위치(= 2D Sprite 의 좌상단 좌표값) 및 크기, 색상
+  glm::vec2 BrickPosition(unsigned int brick) const
+  {
+    return glm::vec2(this->cellSize.x * static_cast<float>(brick % this->columns), this->top + this->cellSize.y * static_cast<float>(brick / this->columns));
+  };
+  glm::vec2 BrickSize() const { return this->cellSize; };
+  glm::vec3 BrickColor(unsigned int brick) const { return TileColor(this->TileCode(brick)); };
+
+  // tile code 에 대응되는 brick 색상
+  static glm::vec3 TileColor(unsigned int tileCode);
+
+  // 살아있는 non-solid brick 의 hit point 를 1 감소 -> 0 이 되면 파괴하고 true 반환 (solid brick 은 아무것도 하지 않고 false 반환)
+  bool HitBrick(unsigned int brick);
+
+  // [min, max] 영역(screen space AABB)과 겹치는 grid cell 중 아직 파괴되지 않은 brick index 를 out 에 추가 (행 우선 순서)
+  // -> ball 이 지나가는 영역 근처의 brick 만 충돌 검사하기 위한 broadphase. (영역이 brick 영역을 벗어나면 아무것도 추가하지 않음)
+  // -> GameRenderer 도 카메라 view 영역으로 조회하여 화면에 보이는 brick 만 그림 (view culling)
+  void QueryBricks(glm::vec2 min, glm::vec2 max, std::vector<unsigned int> &out) const;
+
+  // brick 이 배치된 영역의 위쪽, 아래쪽 경계 y 좌표 (아래쪽 경계보다 아래에 있는 object 는 brick 과 충돌할 수 없음)
+  // -> 일반 레벨의 위쪽 경계는 항상 0, streaming 레벨은 levelHeight 위로 쌓아 올린 높이만큼 음수
+  float Top() const { return this->top; };
+  float Bottom() const { return this->top + this->rows * this->cellSize.y; };
 
 private:
-  // 파싱된 tileData 를 전달받아 각 Brick 들을 GameObject 클래스 인스턴스로 생성하여 컨테이너에 저장하는 함수 -> GameLevel::Load() 함수 내부에서 호출
-  void init(std::vector<std::vector<unsigned int>> tileData, unsigned int levelWidth, unsigned int levelHeight);
+  // brick 배치 grid -> tileData 의 행, 열과 같은 크기 (tile 하나가 cell 하나)
+  unsigned int columns, rows;
+  glm::vec2 cellSize;
+  float top; // 0 번 행의 y 좌표
+
+  std::shared_ptr<const LevelTemplate> layout; // 로드 직후 상태 (로드 전이거나 로드에 실패했다면 nullptr, streaming 레벨도 nullptr)
+  std::shared_ptr<LevelStreamer> streamer;     // streaming 레벨의 chunk 읽기 담당 (일반 레벨이면 nullptr)
+
+  // tiles, alive 에 들어있는 행 범위 [firstRow, endRow) 및 첫 cell 의 brick index (일반 레벨은 모든 행)
+  unsigned int firstRow, endRow, firstCell;
+  unsigned int firstChunk, residentChunks; // streaming 레벨의 resident window (chunk 단위)
+
+  std::vector<unsigned char> tiles;       // cell 별 tile code + 남은 hit point
+  std::vector<unsigned long long> alive;  // cell 별 파괴되지 않은 brick 여부 (64 cell 당 1 word)
+
+  // streaming 레벨의 cell 별 파괴된 brick 여부 (레벨 전체 기준 brick index, 마지막 chunk 까지 채운 크기) -> chunk 가 다시 window 로 들어올 때 반영 (일반 레벨은 비어있음)
+  std::vector<unsigned long long> destroyed;
+
+  unsigned int liveCount; // 파괴되지 않은 brick 개수 (solid brick 포함)
+  unsigned int remaining; // 파괴되지 않은 non-solid brick 개수
+  unsigned int destroyedCount; // 파괴된 non-solid brick 개수 (streaming 레벨은 window 밖으로 나간 chunk 포함, 레벨 전체 기준)
+
+  // 파싱된 레벨을 전달받아 grid 크기를 정하고, layout 에 cell 별 tile byte 및 bitset 을 기록하는 함수 -> GameLevel::Load() 함수 내부에서 호출
+  void init(const LevelData &level, unsigned int levelWidth, unsigned int levelHeight, LevelTemplate &layout);
+
+  /** streaming 레벨의 resident window 관리 (slot: window 안에서 chunk 의 순서) */
+  void loadWindow(unsigned int first);        // window 를 first 번 chunk 부터 다시 채움
+  void loadChunk(unsigned int slot);          // (firstChunk + slot) 번 chunk 를 streamer 에서 복사하여 slot 에 기록
+  void evictChunk(unsigned int slot);         // slot 의 chunk 를 brick 개수에서 뺌 (파괴 기록은 HitBrick() 에서 이미 destroyed 에 남김)
+  void setWindow(unsigned int first);         // firstChunk 및 행 범위 갱신
+  void prefetchAround();                      // window 바로 위아래 chunk 를 미리 읽도록 요청
 };
 
 #endif /* GAME_LEVEL_HPP */
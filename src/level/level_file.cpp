@@ -0,0 +1,403 @@
+#include "level_file.hpp"
+
+#include <fstream>
+#include <sstream>
+#include <cstring>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// binary 레벨 파일 형식 상수
+static const char LEVEL_MAGIC[4] = {'B', 'L', 'V', 'L'};
+static const unsigned short LEVEL_VERSION = 1;
+
+// tile code 최대값 (tile byte 의 하위 4bit)
+static const unsigned int MAX_TILE_CODE = 15;
+
+MappedFile::MappedFile()
+    : data(nullptr), size(0),
+#ifdef _WIN32
+      file(INVALID_HANDLE_VALUE), mapping(nullptr)
+#else
+      file(-1)
+#endif
+{
+}
+
+MappedFile::~MappedFile()
+{
+  this->Close();
+}
+
+bool MappedFile::Open(const char *path)
+{
+  this->Close();
+#ifdef _WIN32
+  this->file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+  LARGE_INTEGER fileSize;
+  if (this->file == INVALID_HANDLE_VALUE || !GetFileSizeEx(this->file, &fileSize))
+  {
+    this->Close();
+    return false;
+  }
+  this->size = static_cast<std::size_t>(fileSize.QuadPart);
+  if (this->size == 0)
+  {
+    return true;
+  }
+  this->mapping = CreateFileMappingA(this->file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  this->data = this->mapping != nullptr ? static_cast<const unsigned char *>(MapViewOfFile(this->mapping, FILE_MAP_READ, 0, 0, 0)) : nullptr;
+#else
+  this->file = open(path, O_RDONLY);
+  struct stat info;
+  if (this->file < 0 || fstat(this->file, &info) != 0)
+  {
+    this->Close();
+    return false;
+  }
+  this->size = static_cast<std::size_t>(info.st_size);
+  if (this->size == 0)
+  {
+    return true;
+  }
+  void *view = mmap(nullptr, this->size, PROT_READ, MAP_PRIVATE, this->file, 0);
+  this->data = view != MAP_FAILED ? static_cast<const unsigned char *>(view) : nullptr;
+  if (this->data != nullptr)
+  {
+    // 처음부터 끝까지 한 번만 읽으므로 커널이 미리 읽어오도록 요청
+    madvise(view, this->size, MADV_SEQUENTIAL);
+  }
+#endif
+  if (this->data == nullptr)
+  {
+    this->Close();
+    return false;
+  }
+  return true;
+}
+
+void MappedFile::Close()
+{
+#ifdef _WIN32
+  if (this->data != nullptr)
+  {
+    UnmapViewOfFile(this->data);
+  }
+  if (this->mapping != nullptr)
+  {
+    CloseHandle(this->mapping);
+  }
+  if (this->file != INVALID_HANDLE_VALUE)
+  {
+    CloseHandle(this->file);
+  }
+  this->file = INVALID_HANDLE_VALUE;
+  this->mapping = nullptr;
+#else
+  if (this->data != nullptr)
+  {
+    munmap(const_cast<unsigned char *>(this->data), this->size);
+  }
+  if (this->file >= 0)
+  {
+    close(this->file);
+  }
+  this->file = -1;
+#endif
+  this->data = nullptr;
+  this->size = 0;
+}
+
+// 파싱 실패 처리 -> 반쯤 채워진 레벨이 남지 않도록 out 을 비움
+static bool fail(LevelData &out, LevelError &error, unsigned int line, unsigned int column, const std::string &message)
+{
+  out.Columns = 0;
+  out.Rows = 0;
+  out.Tiles = nullptr;
+  out.Storage.clear();
+  error.Line = line;
+  error.Column = column;
+  error.Message = message;
+  return false;
+}
+
+bool ParseLevelText(const char *text, std::size_t size, LevelData &out, LevelError &error)
+{
+  // tile 하나는 최소 2 byte (숫자 + 구분 문자) 이므로 size / 2 + 1 개면 항상 충분함 -> 버퍼를 한 번만 할당하고 push_back 없이 기록
+  out.Storage.resize(size / 2 + 1);
+  unsigned char *tiles = out.Storage.data();
+  std::size_t count = 0;
+
+  // 행, 열 개수는 지역 변수에 누적 (unsigned char 버퍼에 쓰면 compiler 가 out 의 멤버도 바뀔 수 있다고 보고 매번 다시 읽고 쓰기 때문)
+  unsigned int columns = 0, rows = 0;
+  unsigned int rowTiles = 0; // 현재 줄의 tile 개수
+
+  const char *p = text;
+  const char *end = text + size;
+  const char *lineStart = p;
+  unsigned int line = 1;
+
+  for (;;)
+  {
+    // 줄 끝(또는 파일 끝) -> 행 하나 완성 (빈 줄은 무시)
+    if (p == end || *p == '\n')
+    {
+      if (rowTiles > 0)
+      {
+        if (rows == 0)
+        {
+          columns = rowTiles;
+        }
+        else if (rowTiles != columns)
+        {
+          std::ostringstream message;
+          message << "row has " << rowTiles << " tiles, expected " << columns;
+          return fail(out, error, line, static_cast<unsigned int>(p - lineStart) + 1, message.str());
+        }
+        rows++;
+        rowTiles = 0;
+      }
+      if (p == end)
+      {
+        break;
+      }
+      lineStart = ++p;
+      line++;
+      continue;
+    }
+
+    char c = *p;
+    if (c == ' ' || c == '\t' || c == '\r')
+    {
+      p++;
+      continue;
+    }
+    if (c < '0' || c > '9')
+    {
+      std::ostringstream message;
+      message << "unexpected character '" << c << "'";
+      return fail(out, error, line, static_cast<unsigned int>(p - lineStart) + 1, message.str());
+    }
+
+    // 한 자리 tile code 와 공백 하나가 반복되는 일반적인 행은 8 byte ("d d d d ") 를 64bit 정수 하나로 검사하여 tile 4 개씩 기록 (little-endian 기준, level_file.hpp 의 guard 로 확인)
+    // -> 짝수 byte 는 '0' ~ '9', 홀수 byte 는 ' ' 인 경우에만 적용하고, 그 외(여러 자리 숫자, 탭, 줄 끝 등)는 아래에서 한 글자씩 처리함
+    if (end - p >= 8 && (rows == 0 || columns - rowTiles >= 4))
+    {
+      unsigned long long word;
+      std::memcpy(&word, p, sizeof(word));
+      word ^= 0x2030203020302030ull; // 짝수 byte: 숫자 값, 홀수 byte: 공백이면 0
+      if ((word & 0xFFF0FFF0FFF0FFF0ull) == 0 && ((word + 0x0006000600060006ull) & 0x0010001000100010ull) == 0)
+      {
+        unsigned int packed = static_cast<unsigned int>((word & 0xFF) | ((word >> 8) & 0xFF00) | ((word >> 16) & 0xFF0000) | ((word >> 24) & 0xFF000000));
+        std::memcpy(tiles + count, &packed, sizeof(packed));
+        count += 4;
+        rowTiles += 4;
+        p += 8;
+        continue;
+      }
+    }
+
+    // 첫 행보다 tile 이 많은 행은 넘치는 tile 위치에서 바로 오류 처리
+    if (rows > 0 && rowTiles == columns)
+    {
+      std::ostringstream message;
+      message << "row has more than " << columns << " tiles";
+      return fail(out, error, line, static_cast<unsigned int>(p - lineStart) + 1, message.str());
+    }
+
+    // 10진수 scan (자릿수가 많아도 overflow 되지 않도록 최대값을 넘으면 더 이상 누적하지 않음)
+    unsigned int value = static_cast<unsigned int>(c - '0');
+    while (++p != end && *p >= '0' && *p <= '9')
+    {
+      if (value <= MAX_TILE_CODE)
+      {
+        value = value * 10 + static_cast<unsigned int>(*p - '0');
+      }
+    }
+    tiles[count++] = static_cast<unsigned char>(value < MAX_TILE_CODE ? value : MAX_TILE_CODE);
+    rowTiles++;
+  }
+
+  if (rows == 0)
+  {
+    return fail(out, error, 1, 1, "level has no tiles");
+  }
+  out.Storage.resize(count);
+  out.Columns = columns;
+  out.Rows = rows;
+  out.Tiles = out.Storage.data();
+  return true;
+}
+
+static unsigned long long readUint(const unsigned char *data, std::size_t offset, unsigned int bytes)
+{
+  unsigned long long value = 0;
+  for (unsigned int i = 0; i < bytes; i++)
+  {
+    value |= static_cast<unsigned long long>(data[offset + i]) << (i * 8);
+  }
+  return value;
+}
+
+bool ParseLevelBinaryHeader(const unsigned char *header, std::size_t size, unsigned int &columns, unsigned int &rows, LevelError &error)
+{
+  LevelData unused;
+  if (size < LEVEL_BINARY_HEADER_SIZE || std::memcmp(header, LEVEL_MAGIC, sizeof(LEVEL_MAGIC)) != 0)
+  {
+    return fail(unused, error, 0, 0, "invalid binary level header");
+  }
+  unsigned long long version = readUint(header, 4, 2);
+  if (version != LEVEL_VERSION)
+  {
+    std::ostringstream message;
+    message << "unsupported binary level version " << version;
+    return fail(unused, error, 0, 0, message.str());
+  }
+  columns = static_cast<unsigned int>(readUint(header, 6, 4));
+  rows = static_cast<unsigned int>(readUint(header, 10, 4));
+  if (columns == 0 || rows == 0)
+  {
+    return fail(unused, error, 0, 0, "binary level has no tiles");
+  }
+  return true;
+}
+
+bool ParseLevelBinary(const unsigned char *data, std::size_t size, LevelData &out, LevelError &error)
+{
+  unsigned int columns = 0, rows = 0;
+  if (!ParseLevelBinaryHeader(data, size, columns, rows, error))
+  {
+    return fail(out, error, 0, 0, error.Message);
+  }
+  if (size - LEVEL_BINARY_HEADER_SIZE != static_cast<unsigned long long>(columns) * rows)
+  {
+    std::ostringstream message;
+    message << "binary level size does not match " << columns << "x" << rows << " tiles";
+    return fail(out, error, 0, 0, message.str());
+  }
+
+  // 4bit 를 넘는 tile code 가 있는 지 8 byte 씩 묶어서 한 번에 검사 (tile byte 는 복사하지 않고 mapping 을 그대로 가리킴)
+  const unsigned char *tiles = data + LEVEL_BINARY_HEADER_SIZE;
+  std::size_t count = static_cast<std::size_t>(columns) * rows;
+  unsigned long long invalid = 0;
+  std::size_t i = 0;
+  for (; i + 8 <= count; i += 8)
+  {
+    unsigned long long word;
+    std::memcpy(&word, tiles + i, sizeof(word));
+    invalid |= word;
+  }
+  for (; i < count; i++)
+  {
+    invalid |= tiles[i];
+  }
+  if ((invalid & 0xF0F0F0F0F0F0F0F0ull) != 0)
+  {
+    return fail(out, error, 0, 0, "binary level contains tile codes greater than 15");
+  }
+
+  out.Storage.clear();
+  out.Columns = columns;
+  out.Rows = rows;
+  out.Tiles = tiles;
+  return true;
+}
+
+bool ReadLevelFile(const char *path, MappedFile &file, LevelData &out, LevelError &error)
+{
+  if (!file.Open(path))
+  {
+    return fail(out, error, 0, 0, "failed to open file");
+  }
+  if (file.Size() >= sizeof(LEVEL_MAGIC) && std::memcmp(file.Data(), LEVEL_MAGIC, sizeof(LEVEL_MAGIC)) == 0)
+  {
+    return ParseLevelBinary(file.Data(), file.Size(), out, error);
+  }
+  return ParseLevelText(reinterpret_cast<const char *>(file.Data()), file.Size(), out, error);
+}
+
+static void writeUint(std::ostream &out, unsigned long long value, unsigned int bytes)
+{
+  for (unsigned int i = 0; i < bytes; i++)
+  {
+    out.put(static_cast<char>((value >> (i * 8)) & 0xFF));
+  }
+}
+
+void WriteLevelBinaryHeader(std::ostream &out, unsigned int columns, unsigned int rows)
+{
+  out.write(LEVEL_MAGIC, sizeof(LEVEL_MAGIC));
+  writeUint(out, LEVEL_VERSION, 2);
+  writeUint(out, columns, 4);
+  writeUint(out, rows, 4);
+}
+
+bool WriteLevelBinary(const char *path, const LevelData &level)
+{
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  if (!file)
+  {
+    return false;
+  }
+  WriteLevelBinaryHeader(file, level.Columns, level.Rows);
+  file.write(reinterpret_cast<const char *>(level.Tiles), static_cast<std::streamsize>(level.CellCount()));
+  return static_cast<bool>(file);
+}
+
+bool ReadLevelManifest(const char *path, std::vector<LevelManifestEntry> &levels, LevelError &error)
+{
+  LevelData unused;
+  std::ifstream file(path);
+  if (!file)
+  {
+    return fail(unused, error, 0, 0, "failed to open file");
+  }
+
+  // manifest 가 있는 디렉토리 (구분자 포함, 현재 디렉토리라면 빈 문자열)
+  std::string manifest(path);
+  std::string::size_type slash = manifest.find_last_of("/\\");
+  std::string directory = slash == std::string::npos ? std::string() : manifest.substr(0, slash + 1);
+
+  std::size_t first = levels.size();
+  std::string line;
+  unsigned int lineNumber = 0;
+  while (std::getline(file, line))
+  {
+    lineNumber++;
+    // 앞뒤 공백(및 CRLF 줄바꿈의 '\r') 제거
+    std::string::size_type begin = line.find_first_not_of(" \t\r");
+    if (begin == std::string::npos || line[begin] == '#')
+    {
+      continue;
+    }
+    std::string::size_type end = line.find_last_not_of(" \t\r");
+
+    // 'stream PATH' -> streaming 레벨
+    LevelManifestEntry entry;
+    if (line.compare(begin, 7, "stream ") == 0 || line.compare(begin, 7, "stream\t") == 0)
+    {
+      entry.Stream = true;
+      begin = line.find_first_not_of(" \t", begin + 7);
+      if (begin > end)
+      {
+        return fail(unused, error, lineNumber, static_cast<unsigned int>(end) + 2, "missing level file after 'stream'");
+      }
+    }
+    entry.File = directory + line.substr(begin, end - begin + 1);
+    levels.push_back(entry);
+  }
+
+  if (levels.size() == first)
+  {
+    return fail(unused, error, 0, 0, "manifest lists no levels");
+  }
+  return true;
+}
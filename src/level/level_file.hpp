@@ -0,0 +1,123 @@
+#ifndef LEVEL_FILE_HPP
+#define LEVEL_FILE_HPP
+
+#include <string>
+#include <vector>
+#include <ostream>
+#include <cstddef>
+
+/**
+ * 레벨 파일 형식
+ *
+ * text (.lvl)    : 한 줄이 brick 한 행, 공백으로 구분한 tile code (0: 빈 칸, 1: solid brick, 2 ~ 15: non-solid brick)
+ *                  -> 15 보다 큰 tile code 는 15 로 취급하고, 빈 줄은 무시함. 모든 행의 tile 개수가 같아야 함.
+ * binary (.blvl) : "BLVL" magic(4) | version(u16) | columns(u32) | rows(u32) | tile code(u8) x (columns * rows) (행 우선, 모든 정수는 little-endian)
+ *                  -> 파싱 없이 tile byte 를 그대로 사용하므로, 큰 레벨은 text 보다 훨씬 빨리 로드됨. (breakout_level_compiler 로 생성)
+ *
+ * manifest       : 한 줄에 레벨 파일 경로 하나 (manifest 파일이 있는 디렉토리 기준 상대 경로). 위에서부터 level 1, 2, ... 순서
+ *                  -> '#' 로 시작하는 줄과 빈 줄은 무시함.
+ *                  -> 'stream PATH' 형식의 줄은 파일 전체를 로드하지 않고 카메라 주변의 행만 읽어오는 streaming 레벨 (binary 레벨만 가능, level_stream.hpp 참고)
+ *
+ * 두 레벨 형식 모두 파일 전체를 memory mapping 한 뒤 mapping 된 내용을 직접 읽음.
+ * -> text 는 한 번의 pass 로 flat tile 버퍼에 기록하고 (줄 단위 문자열, 행 단위 컨테이너를 만들지 않음), binary 는 복사 없이 mapping 을 그대로 가리킴.
+ */
+
+// text 파서의 8 byte 단위 검사와 GameLevel 의 tile 변환(SWAR)은 64bit 정수의 하위 byte 가 메모리상 앞쪽 byte 라고 가정함
+// -> big-endian target 에서는 tile 순서와 brick bitset 이 조용히 어긋나므로, 두 곳이 함께 쓰는 이 header 에서 빌드를 중단함
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+#error "level parsing and tile initialization require a little-endian target"
+#endif
+
+// 파싱된 레벨 -> 행 우선 순서의 tile code (cell index = y * Columns + x)
+struct LevelData
+{
+  unsigned int Columns, Rows;
+  const unsigned char *Tiles;         // Storage 또는 mapping 된 binary 파일의 tile byte 를 가리킴
+  std::vector<unsigned char> Storage; // text 파일의 파싱 결과 (binary 파일이면 비어있음)
+
+  LevelData() : Columns(0), Rows(0), Tiles(nullptr) {};
+
+  std::size_t CellCount() const { return static_cast<std::size_t>(this->Columns) * this->Rows; };
+
+private:
+  // Tiles 가 자기 자신의 Storage 를 가리킬 수 있으므로 복사 금지
+  LevelData(const LevelData &);
+  LevelData &operator=(const LevelData &);
+};
+
+// binary 레벨 파일 header 크기 (tile byte 는 header 바로 뒤부터 행 우선 순서로 저장됨)
+const std::size_t LEVEL_BINARY_HEADER_SIZE = 4 + 2 + 4 + 4;
+
+// manifest 에 나열된 레벨 하나
+struct LevelManifestEntry
+{
+  std::string File; // 현재 작업 디렉토리 기준 경로
+  bool Stream;      // streaming 레벨 여부 ('stream PATH' 형식의 줄)
+
+  LevelManifestEntry() : Stream(false) {};
+};
+
+// 레벨 파일 로드 실패 원인 (Line, Column 은 1 부터 시작, text 파일의 파싱 오류가 아니면 0)
+struct LevelError
+{
+  unsigned int Line, Column;
+  std::string Message;
+
+  LevelError() : Line(0), Column(0) {};
+};
+
+/**
+ * MappedFile 클래스
+ *
+ * 파일 전체를 읽기 전용으로 memory mapping 하는 클래스. (POSIX mmap / Win32 MapViewOfFile)
+ * -> 파일 내용을 별도의 버퍼로 복사하지 않으므로, 파서가 page cache 를 직접 읽음.
+ */
+class MappedFile
+{
+public:
+  MappedFile();
+  ~MappedFile();
+
+  // 파일 mapping (이미 열려있던 파일은 닫음) -> 빈 파일도 성공하며 Size() 는 0
+  bool Open(const char *path);
+  void Close();
+
+  const unsigned char *Data() const { return this->data; };
+  std::size_t Size() const { return this->size; };
+
+private:
+  const unsigned char *data;
+  std::size_t size;
+#ifdef _WIN32
+  void *file, *mapping;
+#else
+  int file;
+#endif
+
+  // mapping 은 소유권을 하나만 가지므로 복사 금지
+  MappedFile(const MappedFile &);
+  MappedFile &operator=(const MappedFile &);
+};
+
+// 메모리에 올라온 text / binary 레벨 파싱 (실패 시 out 은 비어있고 error 에 원인 기록)
+// -> binary 레벨의 out.Tiles 는 data 를 그대로 가리키므로 data 가 유효한 동안에만 사용할 수 있음
+bool ParseLevelText(const char *text, std::size_t size, LevelData &out, LevelError &error);
+bool ParseLevelBinary(const unsigned char *data, std::size_t size, LevelData &out, LevelError &error);
+
+// binary 레벨 파일 header(LEVEL_BINARY_HEADER_SIZE byte) 검사 및 크기 읽기 -> tile byte 는 검사하지 않음 (파일 일부만 읽는 streaming 용)
+bool ParseLevelBinaryHeader(const unsigned char *header, std::size_t size, unsigned int &columns, unsigned int &rows, LevelError &error);
+
+// 레벨 파일을 file 로 mapping 하여 파싱 -> 파일 앞의 magic 으로 binary 여부를 판단하므로 확장자와 무관함
+// -> binary 레벨의 out.Tiles 는 file 의 mapping 을 가리키므로 file 을 닫기 전까지만 유효함
+bool ReadLevelFile(const char *path, MappedFile &file, LevelData &out, LevelError &error);
+
+// binary 레벨 파일 생성
+bool WriteLevelBinary(const char *path, const LevelData &level);
+
+// binary 레벨 파일 header 기록 -> 뒤이어 columns * rows 개의 tile code 를 행 우선 순서로 기록하면 됨 (레벨 전체를 메모리에 두지 않고 행 단위로 생성하는 경우)
+void WriteLevelBinaryHeader(std::ostream &out, unsigned int columns, unsigned int rows);
+
+// manifest 파일에 나열된 레벨 읽기 (manifest 기준 상대 경로를 현재 작업 디렉토리 기준 경로로 변환하여 levels 에 추가)
+bool ReadLevelManifest(const char *path, std::vector<LevelManifestEntry> &levels, LevelError &error);
+
+#endif /* LEVEL_FILE_HPP */
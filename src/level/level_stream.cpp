@@ -0,0 +1,250 @@
+#include "level_stream.hpp"
+
+#include "../profiler/cpu_profiler.hpp"
+
+#include <iostream>
+#include <sstream>
+#include <cstring>
+
+LevelStreamer::LevelStreamer()
+    : columns(0), rows(0), brickCount(0), solidCount(0), useClock(0), stopping(false) {};
+
+LevelStreamer::~LevelStreamer()
+{
+  {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->stopping = true;
+  }
+  this->requested.notify_all();
+  if (this->worker.joinable())
+  {
+    this->worker.join();
+  }
+}
+
+bool LevelStreamer::Open(const char *path, LevelError &error)
+{
+  if (this->worker.joinable())
+  {
+    error.Message = "level streamer is already open";
+    return false;
+  }
+
+  std::ifstream file(path, std::ios::binary);
+  if (!file)
+  {
+    error.Message = "failed to open file";
+    return false;
+  }
+
+  // header 검사 및 파일 크기 확인 (tile byte 는 header 바로 뒤부터 행 우선 순서)
+  unsigned char header[LEVEL_BINARY_HEADER_SIZE] = {};
+  file.read(reinterpret_cast<char *>(header), sizeof(header));
+  unsigned int columns = 0, rows = 0;
+  if (!ParseLevelBinaryHeader(header, static_cast<std::size_t>(file.gcount()), columns, rows, error))
+  {
+    if (file.gcount() >= 4 && std::memcmp(header, "BLVL", 4) != 0)
+    {
+      error.Message = "streaming levels must be binary (.blvl) files";
+    }
+    return false;
+  }
+  unsigned long long cellCount = static_cast<unsigned long long>(columns) * rows;
+  if (cellCount > 0xFFFFFFFFull)
+  {
+    error.Message = "level has more than 2^32 cells";
+    return false;
+  }
+  file.seekg(0, std::ios::end);
+  if (static_cast<unsigned long long>(file.tellg()) != LEVEL_BINARY_HEADER_SIZE + cellCount)
+  {
+    std::ostringstream message;
+    message << "binary level size does not match " << columns << "x" << rows << " tiles";
+    error.Message = message.str();
+    return false;
+  }
+
+  this->path = path;
+  this->columns = columns;
+  this->rows = rows;
+  this->slots.resize(LEVEL_STREAM_CACHE_CHUNKS);
+  for (Slot &slot : this->slots)
+  {
+    slot.Chunk = 0;
+    slot.State = SLOT_EMPTY;
+    slot.LastUse = 0;
+    slot.Tiles.resize(static_cast<std::size_t>(LEVEL_CHUNK_ROWS) * columns);
+  }
+
+  // 파일 전체를 chunk 하나 크기의 버퍼로 한 번 훑어서 tile code 검사 및 brick 개수 계산 (첫 번째 slot 을 버퍼로 사용)
+  file.clear();
+  file.seekg(static_cast<std::streamoff>(LEVEL_BINARY_HEADER_SIZE));
+  unsigned char *buffer = this->slots[0].Tiles.data();
+  unsigned long long invalid = 0, bricks = 0, solid = 0;
+  for (unsigned int chunk = 0; chunk < this->ChunkCount(); chunk++)
+  {
+    std::size_t bytes = static_cast<std::size_t>(this->ChunkRows(chunk)) * columns;
+    file.read(reinterpret_cast<char *>(buffer), static_cast<std::streamsize>(bytes));
+    if (static_cast<std::size_t>(file.gcount()) != bytes)
+    {
+      error.Message = "failed to read file";
+      return false;
+    }
+    for (std::size_t i = 0; i < bytes; i++)
+    {
+      invalid |= buffer[i];
+      bricks += buffer[i] != 0;
+      solid += buffer[i] == 1;
+    }
+  }
+  if ((invalid & 0xF0) != 0)
+  {
+    error.Message = "binary level contains tile codes greater than 15";
+    return false;
+  }
+  this->brickCount = bricks;
+  this->solidCount = solid;
+
+  this->worker = std::thread(&LevelStreamer::workerLoop, this);
+  return true;
+}
+
+unsigned int LevelStreamer::ChunkRows(unsigned int chunk) const
+{
+  unsigned int first = chunk * LEVEL_CHUNK_ROWS;
+  return first + LEVEL_CHUNK_ROWS <= this->rows ? LEVEL_CHUNK_ROWS : this->rows - first;
+}
+
+void LevelStreamer::Prefetch(unsigned int chunk)
+{
+  std::lock_guard<std::mutex> lock(this->mutex);
+  if (chunk < this->ChunkCount() && this->findSlot(chunk) < 0)
+  {
+    this->requestSlot(chunk);
+  }
+}
+
+bool LevelStreamer::Read(unsigned int chunk, unsigned char *out)
+{
+  std::unique_lock<std::mutex> lock(this->mutex);
+  bool waited = false;
+  for (;;)
+  {
+    // 보관 중이 아니면 요청 (모든 slot 이 읽는 중이라면 하나가 끝날 때까지 기다렸다가 다시 시도)
+    int index = this->findSlot(chunk);
+    if (index < 0)
+    {
+      index = this->requestSlot(chunk);
+    }
+    if (index >= 0)
+    {
+      Slot &slot = this->slots[index];
+      if (slot.State == SLOT_READY)
+      {
+        std::memcpy(out, slot.Tiles.data(), static_cast<std::size_t>(this->ChunkRows(chunk)) * this->columns);
+        slot.LastUse = ++this->useClock;
+        waited ? this->stats.Stalls++ : this->stats.Hits++;
+        return true;
+      }
+      if (slot.State == SLOT_FAILED)
+      {
+        // 다음 요청 시 다시 읽도록 slot 을 비움
+        slot.State = SLOT_EMPTY;
+        std::cout << "ERROR::LEVEL_STREAM: Failed to read chunk " << chunk << " of " << this->path << std::endl;
+        return false;
+      }
+    }
+    waited = true;
+    this->loaded.wait(lock);
+  }
+}
+
+LevelStreamStats LevelStreamer::Stats()
+{
+  std::lock_guard<std::mutex> lock(this->mutex);
+  return this->stats;
+}
+
+int LevelStreamer::findSlot(unsigned int chunk) const
+{
+  for (std::size_t i = 0; i < this->slots.size(); i++)
+  {
+    if (this->slots[i].State != SLOT_EMPTY && this->slots[i].Chunk == chunk)
+    {
+      return static_cast<int>(i);
+    }
+  }
+  return -1;
+}
+
+int LevelStreamer::requestSlot(unsigned int chunk)
+{
+  // 비어있는 slot, 없으면 가장 오래 전에 사용한 chunk 의 slot 을 재사용 (읽는 중인 slot 은 background 스레드가 쓰고 있으므로 제외)
+  int victim = -1;
+  for (std::size_t i = 0; i < this->slots.size(); i++)
+  {
+    const Slot &slot = this->slots[i];
+    if (slot.State == SLOT_EMPTY)
+    {
+      victim = static_cast<int>(i);
+      break;
+    }
+    if (slot.State != SLOT_LOADING && (victim < 0 || slot.LastUse < this->slots[victim].LastUse))
+    {
+      victim = static_cast<int>(i);
+    }
+  }
+  if (victim < 0)
+  {
+    return -1;
+  }
+
+  Slot &slot = this->slots[victim];
+  slot.Chunk = chunk;
+  slot.State = SLOT_LOADING;
+  slot.LastUse = ++this->useClock;
+  this->queue.push_back(static_cast<unsigned int>(victim));
+  this->requested.notify_one();
+  return victim;
+}
+
+void LevelStreamer::workerLoop()
+{
+  CpuProfiler::SetThreadName("level_stream");
+
+  // background 스레드 전용 파일 stream (chunk 마다 필요한 위치로 이동해서 읽음)
+  std::ifstream file(this->path.c_str(), std::ios::binary);
+
+  std::unique_lock<std::mutex> lock(this->mutex);
+  for (;;)
+  {
+    this->requested.wait(lock, [this]
+                         { return this->stopping || !this->queue.empty(); });
+    if (this->stopping)
+    {
+      return;
+    }
+    unsigned int index = this->queue.front();
+    this->queue.pop_front();
+
+    // 읽는 중(SLOT_LOADING)인 slot 은 다른 chunk 에 재할당되지 않으므로, mutex 를 풀고 slot 버퍼에 직접 읽음
+    unsigned int chunk = this->slots[index].Chunk;
+    unsigned char *tiles = this->slots[index].Tiles.data();
+    std::size_t bytes = static_cast<std::size_t>(this->ChunkRows(chunk)) * this->columns;
+    lock.unlock();
+    bool ok;
+    {
+      PROFILE_SCOPE("LevelStreamer::load");
+      std::streamoff offset = static_cast<std::streamoff>(LEVEL_BINARY_HEADER_SIZE) + static_cast<std::streamoff>(chunk) * LEVEL_CHUNK_ROWS * this->columns;
+      file.clear();
+      file.seekg(offset);
+      file.read(reinterpret_cast<char *>(tiles), static_cast<std::streamsize>(bytes));
+      ok = static_cast<std::size_t>(file.gcount()) == bytes;
+    }
+    lock.lock();
+
+    this->slots[index].State = ok ? SLOT_READY : SLOT_FAILED;
+    this->stats.Loads++;
+    this->loaded.notify_all();
+  }
+}
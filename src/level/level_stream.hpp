@@ -0,0 +1,113 @@
+#ifndef LEVEL_STREAM_HPP
+#define LEVEL_STREAM_HPP
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <fstream>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#include "level_file.hpp"
+
+// chunk 하나의 행 개수 -> chunk 의 cell 개수가 항상 64 의 배수이므로, chunk 경계가 파괴 여부 bitset 의 word 경계와 일치함
+const unsigned int LEVEL_CHUNK_ROWS = 64;
+
+// LevelStreamer 가 메모리에 보관하는 최대 chunk 개수 (GameLevel 의 resident chunk + 위아래로 미리 읽어둔 chunk)
+const unsigned int LEVEL_STREAM_CACHE_CHUNKS = 8;
+
+// LevelStreamer 의 파일 읽기 통계
+struct LevelStreamStats
+{
+  unsigned long long Loads;  // background 스레드가 파일에서 읽은 chunk 개수
+  unsigned long long Hits;   // Read() 시점에 이미 읽혀 있던 chunk 개수
+  unsigned long long Stalls; // Read() 가 파일 읽기를 기다린 횟수 (prefetch 가 늦은 경우)
+
+  LevelStreamStats() : Loads(0), Hits(0), Stalls(0) {};
+};
+
+/**
+ * LevelStreamer 클래스
+ *
+ * binary 레벨 파일(.blvl)을 LEVEL_CHUNK_ROWS 행 단위의 chunk 로 나누어, 요청받은 chunk 만 background 스레드에서 읽어오는 클래스.
+ * -> 읽어온 chunk 는 고정 개수(LEVEL_STREAM_CACHE_CHUNKS)의 slot 에 보관하고, slot 이 모자라면 가장 오래 전에 사용한 chunk 를 버림 (LRU).
+ * -> 파일 크기와 무관하게 메모리 사용량은 (slot 개수 x chunk 크기) 로 일정함. (파일을 mapping 하지 않고 chunk 단위로 읽으므로 page cache 도 점유하지 않음)
+ *
+ * GameLevel 은 카메라 주변의 chunk 를 Prefetch() 로 미리 요청해 두고, resident window 로 옮길 때 Read() 로 복사해 감.
+ * -> Read() 는 아직 읽히지 않은 chunk 라면 읽힐 때까지 기다리므로, 시뮬레이션 결과는 읽기 속도와 무관하게 항상 같음.
+ * -> 모든 public 함수는 mutex 로 보호되므로, 같은 레벨을 복사한 여러 GameLevel(BatchEnv 의 게임 인스턴스 등)이 하나를 함께 사용할 수 있음.
+ */
+class LevelStreamer
+{
+public:
+  LevelStreamer();
+  ~LevelStreamer();
+
+  // binary 레벨 파일 header 및 tile code 검사 후 background 스레드 시작 (파일 전체를 한 번 chunk 단위로 훑어서 brick 개수를 셈)
+  bool Open(const char *path, LevelError &error);
+
+  unsigned int Columns() const { return this->columns; };
+  unsigned int Rows() const { return this->rows; };
+  unsigned int ChunkCount() const { return (this->rows + LEVEL_CHUNK_ROWS - 1) / LEVEL_CHUNK_ROWS; };
+
+  // chunk 의 행 개수 (마지막 chunk 는 LEVEL_CHUNK_ROWS 보다 적을 수 있음)
+  unsigned int ChunkRows(unsigned int chunk) const;
+
+  // 레벨 파일 전체의 brick 개수 (빈 칸 제외) 및 그 중 solid brick 개수
+  unsigned long long BrickCount() const { return this->brickCount; };
+  unsigned long long SolidCount() const { return this->solidCount; };
+
+  // chunk 를 background 스레드에서 미리 읽도록 요청 (이미 보관 중이거나 읽는 중이면 무시, 비어있는 slot 이 없으면 요청을 버림)
+  void Prefetch(unsigned int chunk);
+
+  // chunk 의 tile code 를 out 에 복사 (ChunkRows(chunk) * Columns() byte) -> 아직 읽히지 않았다면 읽힐 때까지 대기, 파일 읽기 실패 시 false
+  bool Read(unsigned int chunk, unsigned char *out);
+
+  LevelStreamStats Stats();
+
+private:
+  enum SlotState
+  {
+    SLOT_EMPTY,
+    SLOT_LOADING,
+    SLOT_READY,
+    SLOT_FAILED
+  };
+
+  // chunk 하나를 보관하는 cache slot
+  struct Slot
+  {
+    unsigned int Chunk;
+    SlotState State;
+    unsigned long long LastUse; // 마지막으로 요청되거나 복사된 시점 (LRU)
+    std::vector<unsigned char> Tiles;
+  };
+
+  std::string path;
+  unsigned int columns, rows;
+  unsigned long long brickCount, solidCount;
+
+  std::vector<Slot> slots;
+  std::deque<unsigned int> queue; // 읽어야 할 slot 번호 (요청 순서)
+  unsigned long long useClock;
+  LevelStreamStats stats;
+
+  std::mutex mutex;
+  std::condition_variable requested, loaded;
+  std::thread worker;
+  bool stopping;
+
+  // background 스레드 본문 (queue 의 slot 을 차례로 파일에서 읽음)
+  void workerLoop();
+
+  // chunk 를 보관 중인 slot 번호 (없으면 -1) / chunk 를 읽을 slot 을 할당하고 queue 에 추가 (할당할 slot 이 없으면 -1) -> mutex 를 잠근 상태에서 호출
+  int findSlot(unsigned int chunk) const;
+  int requestSlot(unsigned int chunk);
+
+  // background 스레드가 this 를 참조하므로 복사 금지
+  LevelStreamer(const LevelStreamer &);
+  LevelStreamer &operator=(const LevelStreamer &);
+};
+
+#endif /* LEVEL_STREAM_HPP */
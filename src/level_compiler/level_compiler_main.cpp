@@ -0,0 +1,139 @@
+#include "../level/level_file.hpp"
+#include "../utils/random.hpp"
+
+#include <iostream>
+#include <fstream>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+/**
+ * breakout_level_compiler
+ *
+ * text 레벨 파일(.lvl)을 검사하고 binary 레벨 파일(.blvl)로 변환하는 실행 파일. (형식은 level/level_file.hpp 참고)
+ * -> 오류가 있으면 'FILE:LINE:COLUMN: 원인' 형식으로 출력하므로, 편집기에서 바로 오류 위치로 이동할 수 있음.
+ * -> --check 지정 시 변환하지 않고 각 파일의 크기 및 brick 개수만 출력함. (binary 파일도 검사 가능)
+ * -> --generate 지정 시 seed 로 무작위 brick 을 배치한 binary 레벨을 생성함. (streaming 레벨 테스트용, 행 단위로 기록하므로 레벨 크기와 무관하게 메모리를 적게 사용함)
+ *
+ * 사용법: breakout_level_compiler INPUT.lvl OUTPUT.blvl
+ *         breakout_level_compiler --check FILE...
+ *         breakout_level_compiler --generate COLUMNS ROWS SEED OUTPUT.blvl
+ */
+
+// 레벨 파일 로드 및 오류 출력
+static bool readLevel(const char *path, MappedFile &file, LevelData &level)
+{
+  LevelError error;
+  if (ReadLevelFile(path, file, level, error))
+  {
+    return true;
+  }
+  std::cout << "ERROR::LEVEL_COMPILER: " << path;
+  if (error.Line > 0)
+  {
+    std::cout << ":" << error.Line << ":" << error.Column;
+  }
+  std::cout << ": " << error.Message << std::endl;
+  return false;
+}
+
+// 레벨 크기 및 brick 개수 출력
+static void printSummary(const char *path, const LevelData &level)
+{
+  std::size_t bricks = 0, solid = 0;
+  for (std::size_t i = 0; i < level.CellCount(); i++)
+  {
+    bricks += level.Tiles[i] != 0;
+    solid += level.Tiles[i] == 1;
+  }
+  std::cout << "LEVEL_COMPILER: " << path << " | " << level.Columns << "x" << level.Rows << " | bricks " << bricks
+            << " | solid " << solid << std::endl;
+}
+
+// 무작위 binary 레벨 생성 (빈 칸 1/4, solid brick 1/12, 나머지는 tile code 2 ~ 5 의 non-solid brick)
+static bool generateLevel(unsigned int columns, unsigned int rows, unsigned int seed, const char *path)
+{
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  if (!file)
+  {
+    return false;
+  }
+  WriteLevelBinaryHeader(file, columns, rows);
+
+  Random rng(seed, RANDOM_STREAM_COSMETIC);
+  std::vector<unsigned char> row(columns);
+  for (unsigned int y = 0; y < rows && file; y++)
+  {
+    for (unsigned int x = 0; x < columns; x++)
+    {
+      unsigned int roll = rng.NextBelow(12);
+      row[x] = static_cast<unsigned char>(roll < 3 ? 0 : roll == 3 ? 1 : 2 + rng.NextBelow(4));
+    }
+    file.write(reinterpret_cast<const char *>(row.data()), static_cast<std::streamsize>(columns));
+  }
+  return static_cast<bool>(file);
+}
+
+int main(int argc, char *argv[])
+{
+  if (argc == 6 && std::strcmp(argv[1], "--generate") == 0)
+  {
+    unsigned int columns = static_cast<unsigned int>(std::strtoul(argv[2], nullptr, 10));
+    unsigned int rows = static_cast<unsigned int>(std::strtoul(argv[3], nullptr, 10));
+    unsigned int seed = static_cast<unsigned int>(std::strtoul(argv[4], nullptr, 10));
+    if (columns == 0 || rows == 0)
+    {
+      std::cout << "ERROR::LEVEL_COMPILER: COLUMNS and ROWS must be greater than 0" << std::endl;
+      return 1;
+    }
+    if (!generateLevel(columns, rows, seed, argv[5]))
+    {
+      std::cout << "ERROR::LEVEL_COMPILER: Failed to write " << argv[5] << std::endl;
+      return 1;
+    }
+    std::cout << "LEVEL_COMPILER: " << argv[5] << " | " << columns << "x" << rows << " | generated" << std::endl;
+    return 0;
+  }
+
+  if (argc >= 3 && std::strcmp(argv[1], "--check") == 0)
+  {
+    bool ok = true;
+    for (int i = 2; i < argc; i++)
+    {
+      MappedFile file;
+      LevelData level;
+      if (readLevel(argv[i], file, level))
+      {
+        printSummary(argv[i], level);
+      }
+      else
+      {
+        ok = false;
+      }
+    }
+    return ok ? 0 : 1;
+  }
+
+  if (argc != 3 || argv[1][0] == '-')
+  {
+    std::cout << "usage: breakout_level_compiler INPUT.lvl OUTPUT.blvl" << std::endl;
+    std::cout << "       breakout_level_compiler --check FILE..." << std::endl;
+    std::cout << "       breakout_level_compiler --generate COLUMNS ROWS SEED OUTPUT.blvl" << std::endl;
+    return argc == 2 && std::strcmp(argv[1], "--help") == 0 ? 0 : 1;
+  }
+
+  MappedFile file;
+  LevelData level;
+  if (!readLevel(argv[1], file, level))
+  {
+    return 1;
+  }
+  if (!WriteLevelBinary(argv[2], level))
+  {
+    std::cout << "ERROR::LEVEL_COMPILER: Failed to write " << argv[2] << std::endl;
+    return 1;
+  }
+  printSummary(argv[2], level);
+  return 0;
+}
@@ -2,9 +2,21 @@
 #include <GLFW/glfw3.h>
 
 #include "game/game.hpp"
+#include "game/game_renderer.hpp"
+#include "audio/irrklang_audio.hpp"
 #include "manager/resource_manager.hpp"
+#include "utils/gl_object.hpp"
+#include "profiler/gpu_profiler.hpp"
+#include "profiler/cpu_profiler.hpp"
+#include "renderer/render_stats.hpp"
+#include "replay/replay.hpp"
 
 #include <iostream>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <string>
+#include <vector>
 
 /** 콜백함수 전방 선언 */
 
@@ -21,8 +33,114 @@ const unsigned int SCREEN_HEIGHT = 600;
 // Game 클래스 인스턴스 전역 스코프 생성 -> main 함수 외에 콜백함수 접근을 위해 전역 선언
 Game Breakout(SCREEN_WIDTH, SCREEN_HEIGHT);
 
-int main()
+// 게임 상태를 화면에 그리는 GameRenderer 인스턴스 전역 스코프 생성 (GL 리소스는 Init() 호출 시점에 생성됨)
+GameRenderer Renderer(SCREEN_WIDTH, SCREEN_HEIGHT);
+
+// CPU 프로파일러 trace 출력 경로 및 출력할 최근 프레임 수 (F2 키 입력 또는 --trace 옵션 지정 시 종료 시점에 출력)
+std::string TracePath = "breakout_trace.json";
+unsigned int TraceFrames = 300;
+bool TraceOnExit = false;
+
+// 입력 기록 (--record 옵션 지정 시 매 tick 의 키 입력 이벤트와 delta time 을 파일로 기록)
+ReplayRecorder Recorder;
+// 입력 기록 재생 중 여부 (재생 중에는 실제 키 입력을 게임에 전달하지 않음)
+bool Replaying = false;
+
+int main(int argc, char *argv[])
 {
+  /** 커맨드라인 옵션 파싱 */
+  unsigned int gpuProfileInterval = 0;
+  bool showOverlay = false;
+  std::string recordPath, replayPath;
+  bool renderFrames = true;
+  unsigned int seed = static_cast<unsigned int>(std::time(nullptr));
+  for (int i = 1; i < argc; i++)
+  {
+    if (std::strcmp(argv[i], "--gpu-budget-mb") == 0 && i + 1 < argc)
+    {
+      // GPU 메모리 예산 (MiB 단위) -> 저사양 기기에서 예산 초과 여부를 확인하거나 텍스쳐를 다운그레이드하기 위한 목적
+      std::size_t budget = static_cast<std::size_t>(std::atof(argv[++i]) * 1024.0 * 1024.0);
+      ResourceManager::SetMemoryBudget(budget, GpuMemoryTracker::Policy());
+    }
+    else if (std::strcmp(argv[i], "--gpu-budget-policy") == 0 && i + 1 < argc)
+    {
+      // 예산 초과 시 대응 정책 (warn: 경고만 출력, downgrade: 텍스쳐 포맷/해상도 다운그레이드)
+      GpuBudgetPolicy policy = std::strcmp(argv[++i], "downgrade") == 0 ? GPU_BUDGET_DOWNGRADE : GPU_BUDGET_WARN;
+      ResourceManager::SetMemoryBudget(GpuMemoryTracker::Budget(), policy);
+    }
+    else if (std::strcmp(argv[i], "--overlay") == 0)
+    {
+      // 시작 시점부터 성능 overlay 표시 (실행 중에는 F3 키로 토글)
+      showOverlay = true;
+    }
+    else if (std::strcmp(argv[i], "--trace") == 0 && i + 1 < argc)
+    {
+      // 종료 시점에 최근 프레임들의 CPU timing zone 을 Chrome trace JSON 파일로 출력
+      TracePath = argv[++i];
+      TraceOnExit = true;
+    }
+    else if (std::strcmp(argv[i], "--trace-frames") == 0 && i + 1 < argc)
+    {
+      // trace 로 출력할 최근 프레임 수
+      TraceFrames = static_cast<unsigned int>(std::atoi(argv[++i]));
+    }
+    else if (std::strcmp(argv[i], "--record") == 0 && i + 1 < argc)
+    {
+      // 매 tick 의 키 입력 이벤트, delta time, RNG seed 를 파일로 기록
+      recordPath = argv[++i];
+    }
+    else if (std::strcmp(argv[i], "--replay") == 0 && i + 1 < argc)
+    {
+      // 기록 파일을 실시간 대기 없이 최대 속도로 재생한 뒤, frame-time 통계 및 최종 게임 상태 hash 출력
+      replayPath = argv[++i];
+    }
+    else if (std::strcmp(argv[i], "--no-render") == 0)
+    {
+      // 재생 시 렌더링 생략 (창을 띄우지 않고 시뮬레이션만 수행)
+      renderFrames = false;
+    }
+    else if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc)
+    {
+      // 게임 RNG seed 지정 (기본값은 현재 시각)
+      seed = static_cast<unsigned int>(std::strtoul(argv[++i], nullptr, 10));
+    }
+    else if (std::strcmp(argv[i], "--gpu-profile") == 0 && i + 1 < argc)
+    {
+      // render pass 별 GPU 시간 측정 활성화 및 N 프레임마다 통계 로그 출력
+      gpuProfileInterval = static_cast<unsigned int>(std::atoi(argv[++i]));
+    }
+    else
+    {
+      std::cout << "WARNING::MAIN: Unknown option '" << argv[i] << "'" << std::endl;
+    }
+  }
+
+  // 재생할 기록 파일 로드 (기록 시점의 seed 로 게임 RNG 를 초기화해야 같은 게임이 재현됨)
+  ReplayPlayer replay;
+  if (!replayPath.empty())
+  {
+    if (!replay.Load(replayPath))
+    {
+      return 1;
+    }
+    if (replay.Width() != SCREEN_WIDTH || replay.Height() != SCREEN_HEIGHT)
+    {
+      std::cout << "ERROR::MAIN: Replay was recorded at " << replay.Width() << "x" << replay.Height() << ", expected " << SCREEN_WIDTH << "x" << SCREEN_HEIGHT << std::endl;
+      return 1;
+    }
+    Replaying = true;
+    seed = replay.Seed();
+    recordPath.clear();
+  }
+  else if (!renderFrames)
+  {
+    std::cout << "WARNING::MAIN: --no-render is only supported with --replay, ignoring" << std::endl;
+    renderFrames = true;
+  }
+
+  // trace 에 표시할 메인 스레드 이름 지정
+  CpuProfiler::SetThreadName("main");
+
   // GLFW 초기화 및 윈도우 설정 구성
   glfwInit();
   glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
@@ -37,6 +155,13 @@ int main()
   // GLFW 윈도우 크기 조정 비활성화
   glfwWindowHint(GLFW_RESIZABLE, false);
 
+  // 렌더링 없이 재생하는 경우 GL 리소스는 생성하지 않지만, delta time 및 이벤트 처리를 위해 창은 생성하되 화면에 표시하지 않음
+  // (창 없이 재생하려면 breakout_headless 사용)
+  if (!renderFrames)
+  {
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+  }
+
   // GLFW 윈도우 생성 및 현재 OpenGL 컨텍스트로 등록
   GLFWwindow *window = glfwCreateWindow(SCREEN_WIDTH, SCREEN_HEIGHT, "Breakout", nullptr, nullptr);
   glfwMakeContextCurrent(window);
@@ -59,9 +184,55 @@ int main()
   glEnable(GL_BLEND);
   glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
-  // Game 클래스 초기화 수행
+  // GPU timer query 지원 여부 확인 후, 옵션이 지정된 경우에만 측정 활성화
+  if (GpuProfiler::Init() && gpuProfileInterval > 0)
+  {
+    GpuProfiler::SetEnabled(true);
+    GpuProfiler::SetLogInterval(gpuProfileInterval);
+  }
+
+  // Game 클래스 초기화 수행 (게임 시뮬레이션 상태만 초기화하며 GL 리소스는 생성하지 않음)
   Breakout.Init();
 
+  // multi-ball powerup 이 쌓여 ball 이 많아지면 ball 이동 및 충돌 검사를 나누어 맡을 스레드 pool 연결
+  WorkerPool workers;
+  Breakout.Workers = &workers;
+
+  // 렌더링하는 경우에만 GL 리소스 생성 및 사운드 장치 연결 (렌더링 없이 재생하는 경우 효과음도 재생하지 않음)
+  IrrklangAudio *audio = nullptr;
+  if (renderFrames)
+  {
+    Renderer.Init();
+    audio = new IrrklangAudio();
+    Breakout.Audio = audio;
+  }
+
+  // 성능 overlay 는 GPU 시간도 함께 표시하므로 GPU 프로파일러 활성화
+  if (showOverlay)
+  {
+    Renderer.ShowOverlay = true;
+    GpuProfiler::SetEnabled(true);
+  }
+
+  // 초기화 단계에서 할당된 GPU 메모리 사용량 출력
+  ResourceManager::PrintMemoryReport(std::cout, true);
+
+  // 게임 RNG seed 초기화 (powerup 생성 확률이 이 seed 로 결정됨, particle 은 자체 난수를 사용하므로 게임 결과에 영향을 주지 않음)
+  Breakout.Seed(seed);
+
+  // 재생 시에는 vsync 대기 없이 최대 속도로 진행
+  if (Replaying)
+  {
+    glfwSwapInterval(0);
+  }
+
+  // 입력 기록 시작
+  if (!recordPath.empty() && Recorder.Open(recordPath, seed, SCREEN_WIDTH, SCREEN_HEIGHT))
+  {
+    std::cout << "Recording input to " << recordPath << " (seed " << seed << ")" << std::endl;
+  }
+  std::vector<ReplayKeyEvent> replayEvents;
+
   // delta time 계산을 위한 변수 초기화
   float deltaTime = 0.0f;
   float lastFrame = 0.0f;
@@ -69,6 +240,9 @@ int main()
   /** rendering loop */
   while (!glfwWindowShouldClose(window))
   {
+    // CPU 프로파일러에 프레임 경계 기록 (trace 출력 시 최근 N 프레임 범위 계산에 사용)
+    CpuProfiler::MarkFrame();
+
     // 현재 프레임의 delta time(시간 간격) 계산
     float currentFrame = glfwGetTime();
     deltaTime = currentFrame - lastFrame;
@@ -77,30 +251,102 @@ int main()
     // 키보드, 마우스 입력 이벤트 발생 검사 후 등록된 콜백함수 호출 + 이벤트 발생에 따른 GLFWwindow 상태 업데이트
     glfwPollEvents();
 
+    if (Replaying)
+    {
+      // 재생 중에는 실제 시간 대신 기록된 delta time 과 키 입력 이벤트로 tick 진행 (모든 tick 을 재생하면 종료)
+      if (!replay.NextTick(deltaTime, replayEvents))
+      {
+        break;
+      }
+      for (const ReplayKeyEvent &event : replayEvents)
+      {
+        Breakout.SetKey(event.Key, event.Pressed);
+      }
+    }
+    else
+    {
+      // 이번 tick 에 입력된 키 이벤트와 delta time 기록
+      Recorder.EndTick(deltaTime);
+    }
+
+    // 성능 overlay 에 표시할 simulation / render CPU 시간 측정 시작
+    unsigned long long simulationStart = CpuProfiler::Now();
+
     // Game 클래스 사용자 입력 처리 수행 (렌더링 이전 수행)
     Breakout.ProcessInput(deltaTime);
 
     // Game 클래스 업데이트 수행 (렌더링 이전 수행)
     Breakout.Update(deltaTime);
 
-    // 버퍼 초기화
-    glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
-    glClear(GL_COLOR_BUFFER_BIT);
+    if (renderFrames)
+    {
+      // particle 및 post processing 화면 효과 업데이트
+      Renderer.Update(deltaTime, Breakout);
+
+      // 직전 프레임 렌더링 통계(draw call, 텍스쳐 바인딩 횟수) 확정 후 현재 프레임 집계 시작
+      unsigned long long renderStart = CpuProfiler::Now();
+      RenderStats::NewFrame();
 
-    // Game 클래스 실제 렌더링 수행
-    Breakout.Render();
+      // 버퍼 초기화
+      glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+      glClear(GL_COLOR_BUFFER_BIT);
 
-    // Back 버퍼에 렌더링된 최종 이미지를 Front 버퍼에 교체 -> blinking 현상 방지
-    glfwSwapBuffers(window);
+      // 게임 상태 렌더링 수행 (render pass 별 GPU 시간 측정)
+      GpuProfiler::BeginFrame();
+      Renderer.Render(Breakout);
+      GpuProfiler::EndFrame();
+
+      // swap 은 vsync 대기 시간을 포함하므로 render CPU 시간에서 제외
+      unsigned long long renderEnd = CpuProfiler::Now();
+      Renderer.RecordFrameTiming(deltaTime * 1000.0f, (renderStart - simulationStart) / 1.0e6f, (renderEnd - renderStart) / 1.0e6f);
+
+      // Back 버퍼에 렌더링된 최종 이미지를 Front 버퍼에 교체 -> blinking 현상 방지
+      {
+        PROFILE_SCOPE("glfwSwapBuffers");
+        glfwSwapBuffers(window);
+      }
+    }
+
+    // 재생 중에는 tick 하나의 전체 처리 시간(입력 처리 + 업데이트 + 렌더링) 기록
+    if (Replaying)
+    {
+      replay.RecordTickTime((CpuProfiler::Now() - simulationStart) / 1.0e6f);
+    }
+  }
+
+  // 재생 결과(frame-time 통계, 최종 게임 상태 hash) 출력 또는 입력 기록 종료
+  int exitCode = 0;
+  if (Replaying)
+  {
+    exitCode = replay.Report(std::cout, Breakout.StateHash()) ? 0 : 2;
   }
+  Recorder.Close(Breakout.StateHash());
 
-  // 렌더링 루프 종료 시, ResourceManager 클래스에 저장된 리소스 메모리 반납
+  // --trace 옵션이 지정된 경우 종료 직전 최근 프레임들의 trace 출력
+  if (TraceOnExit)
+  {
+    CpuProfiler::WriteChromeTrace(TracePath, TraceFrames);
+  }
+
+  // 사운드 장치 연결 해제 및 반납
+  Breakout.Audio = nullptr;
+  delete audio;
+
+  // 지역 변수인 스레드 pool 연결 해제 (전역 Game 인스턴스가 main 종료 이후까지 참조하지 않도록)
+  Breakout.Workers = nullptr;
+
+  // 렌더링 루프 종료 시, GameRenderer 및 ResourceManager 클래스에 저장된 리소스 메모리 반납 (GL 컨텍스트 종료 이전에 반납해야 함)
+  Renderer.Release();
   ResourceManager::Clear();
+  GpuProfiler::Release();
+
+  // debug 빌드에서는 반납되지 않고 남아있는 GL 객체 개수를 출력하여 누수 여부 확인 (모두 0 이어야 함)
+  GLObjectStats::Report(std::cout);
 
   // GLFW 종료 및 메모리 반납
   glfwTerminate();
 
-  return 0;
+  return exitCode;
 }
 
 /** 콜백함수 구현부 */
@@ -120,20 +366,32 @@ void key_callback(GLFWwindow *window, int key, int scancode, int action, int mod
     glfwSetWindowShouldClose(window, true);
   }
 
-  // 나머지 키 입력 시, Game 클래스의 키 입력 플래그 변경
-  if (key >= 0 && key < 1024)
+  // F2 키 입력 시 최근 프레임들의 CPU timing zone 을 Chrome trace JSON 파일로 출력 (hitch 발생 직후 눌러서 확인)
+  if (key == GLFW_KEY_F2 && action == GLFW_PRESS)
   {
-    if (action == GLFW_PRESS)
-    {
-      // key press 시, 해당 키 입력 플래그 활성화
-      Breakout.Keys[key] = true;
-    }
-    else if (action == GLFW_RELEASE)
+    CpuProfiler::WriteChromeTrace(TracePath, TraceFrames);
+  }
+
+  // F3 키 입력 시 성능 overlay 토글 (overlay 에 GPU 시간도 표시할 수 있도록 GPU 프로파일러를 함께 활성화)
+  if (key == GLFW_KEY_F3 && action == GLFW_PRESS)
+  {
+    Renderer.ShowOverlay = !Renderer.ShowOverlay;
+    if (Renderer.ShowOverlay)
     {
-      // key release 시, 해당 키 입력 플래그 비활성화
-      Breakout.Keys[key] = false;
-      // key release 시, 해당 키 입력 처리 상태도 초기화
-      Breakout.KeysProcessed[key] = false;
+      GpuProfiler::SetEnabled(true);
     }
   }
+
+  // 입력 기록 재생 중에는 실제 키 입력을 게임에 전달하지 않음 (기록된 키 입력 이벤트만 사용)
+  if (Replaying)
+  {
+    return;
+  }
+
+  // 나머지 키 입력 시, Game 클래스의 키 입력 플래그 변경 (입력 기록 중이라면 키 입력 이벤트도 함께 기록)
+  if (action == GLFW_PRESS || action == GLFW_RELEASE)
+  {
+    Recorder.RecordKey(key, action == GLFW_PRESS);
+    Breakout.SetKey(key, action == GLFW_PRESS);
+  }
 }
@@ -0,0 +1,211 @@
+#include "gpu_memory_tracker.hpp"
+
+#include <iostream>
+#include <iomanip>
+
+#include <glad/glad.h>
+
+std::vector<GpuMemoryTracker::Allocation> GpuMemoryTracker::allocations;
+std::vector<unsigned int> GpuMemoryTracker::freeIds;
+std::size_t GpuMemoryTracker::categoryBytes[GPU_MEMORY_CATEGORY_COUNT] = {};
+unsigned int GpuMemoryTracker::categoryCounts[GPU_MEMORY_CATEGORY_COUNT] = {};
+std::size_t GpuMemoryTracker::totalBytes = 0;
+std::size_t GpuMemoryTracker::peakBytes = 0;
+std::size_t GpuMemoryTracker::budgetBytes = 0;
+GpuBudgetPolicy GpuMemoryTracker::policy = GPU_BUDGET_WARN;
+bool GpuMemoryTracker::overBudgetWarned = false;
+std::mutex GpuMemoryTracker::mutex;
+
+// 로그 출력 시 사용할 유형별 이름
+static const char *categoryNames[GPU_MEMORY_CATEGORY_COUNT] = {"texture", "renderbuffer", "vertex_buffer", "glyph", "uniform_buffer"};
+
+// byte 단위 크기를 KiB 단위 문자열로 출력하기 위한 헬퍼 함수
+static double toKiB(std::size_t bytes)
+{
+  return bytes / 1024.0;
+}
+
+unsigned int GpuMemoryTracker::Register(GpuMemoryCategory category, std::size_t bytes, const std::string &label)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+
+  // 등록 해제된 id 가 있으면 재사용하여 컨테이너가 계속 커지지 않도록 함.
+  unsigned int id;
+  if (!freeIds.empty())
+  {
+    id = freeIds.back();
+    freeIds.pop_back();
+  }
+  else
+  {
+    allocations.push_back(Allocation());
+    id = static_cast<unsigned int>(allocations.size());
+  }
+
+  Allocation &allocation = allocations[id - 1];
+  allocation.Category = category;
+  allocation.Bytes = bytes;
+  allocation.Label = label;
+  allocation.Alive = true;
+
+  categoryBytes[category] += bytes;
+  categoryCounts[category]++;
+  totalBytes += bytes;
+  if (totalBytes > peakBytes)
+  {
+    peakBytes = totalBytes;
+  }
+
+  // 예산을 처음 초과한 시점에 경고 로그 출력
+  if (budgetBytes > 0 && totalBytes > budgetBytes && !overBudgetWarned)
+  {
+    overBudgetWarned = true;
+    std::cout << "WARNING::GPU_MEMORY: Budget exceeded by '" << label << "' ("
+              << std::fixed << std::setprecision(1) << toKiB(totalBytes) << " KiB / " << toKiB(budgetBytes) << " KiB)" << std::endl;
+  }
+
+  return id;
+};
+
+void GpuMemoryTracker::Unregister(unsigned int id)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+
+  if (id == 0 || id > allocations.size() || !allocations[id - 1].Alive)
+  {
+    return;
+  }
+
+  Allocation &allocation = allocations[id - 1];
+  categoryBytes[allocation.Category] -= allocation.Bytes;
+  categoryCounts[allocation.Category]--;
+  totalBytes -= allocation.Bytes;
+  allocation.Alive = false;
+  allocation.Label.clear();
+  freeIds.push_back(id);
+
+  // 예산 이하로 내려오면 다음 초과 시점에 다시 경고하도록 플래그 초기화
+  if (totalBytes <= budgetBytes)
+  {
+    overBudgetWarned = false;
+  }
+};
+
+std::size_t GpuMemoryTracker::TotalBytes()
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  return totalBytes;
+};
+
+std::size_t GpuMemoryTracker::CategoryBytes(GpuMemoryCategory category)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  return categoryBytes[category];
+};
+
+unsigned int GpuMemoryTracker::CategoryCount(GpuMemoryCategory category)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  return categoryCounts[category];
+};
+
+std::size_t GpuMemoryTracker::PeakBytes()
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  return peakBytes;
+};
+
+void GpuMemoryTracker::SetBudget(std::size_t bytes, GpuBudgetPolicy budgetPolicy)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  budgetBytes = bytes;
+  policy = budgetPolicy;
+  overBudgetWarned = false;
+};
+
+std::size_t GpuMemoryTracker::Budget()
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  return budgetBytes;
+};
+
+GpuBudgetPolicy GpuMemoryTracker::Policy()
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  return policy;
+};
+
+bool GpuMemoryTracker::WouldExceedBudget(std::size_t bytes)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  return budgetBytes > 0 && totalBytes + bytes > budgetBytes;
+};
+
+void GpuMemoryTracker::Report(std::ostream &out, bool listAllocations)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+
+  out << std::fixed << std::setprecision(1);
+  out << "GPU memory: " << toKiB(totalBytes) << " KiB (peak " << toKiB(peakBytes) << " KiB";
+  if (budgetBytes > 0)
+  {
+    out << ", budget " << toKiB(budgetBytes) << " KiB, " << (policy == GPU_BUDGET_DOWNGRADE ? "downgrade" : "warn");
+  }
+  out << ")" << std::endl;
+
+  for (int i = 0; i < GPU_MEMORY_CATEGORY_COUNT; i++)
+  {
+    out << "  " << std::left << std::setw(14) << categoryNames[i] << std::right
+        << std::setw(10) << toKiB(categoryBytes[i]) << " KiB in " << categoryCounts[i] << " allocation(s)" << std::endl;
+  }
+
+  if (listAllocations)
+  {
+    for (const Allocation &allocation : allocations)
+    {
+      if (allocation.Alive)
+      {
+        out << "    [" << categoryNames[allocation.Category] << "] " << allocation.Label << ": " << toKiB(allocation.Bytes) << " KiB" << std::endl;
+      }
+    }
+  }
+  out << std::defaultfloat;
+};
+
+std::size_t GpuMemoryTracker::BytesPerPixel(unsigned int internalFormat)
+{
+  switch (internalFormat)
+  {
+  case GL_RED:
+  case GL_R8:
+    return 1;
+  case GL_RG:
+  case GL_RG8:
+  case GL_RGB565:
+  case GL_RGBA4:
+  case GL_RGB5_A1:
+    return 2;
+  case GL_RGB:
+  case GL_RGB8:
+    // 대부분의 드라이버는 3 byte RGB 포맷을 4 byte 로 padding 하여 저장하므로, 4 byte 로 추정
+  case GL_RGBA:
+  case GL_RGBA8:
+    return 4;
+  default:
+    return 4;
+  }
+};
+
+std::size_t GpuMemoryTracker::EstimateTextureBytes(unsigned int internalFormat, unsigned int width, unsigned int height, unsigned int mipLevels)
+{
+  // mip level 이 하나 내려갈 때마다 width, height 를 절반으로 줄여가며 누적 (최소 1px)
+  std::size_t bytes = 0;
+  std::size_t bpp = BytesPerPixel(internalFormat);
+  for (unsigned int level = 0; level < mipLevels; level++)
+  {
+    bytes += static_cast<std::size_t>(width) * height * bpp;
+    width = width > 1 ? width / 2 : 1;
+    height = height > 1 ? height / 2 : 1;
+  }
+  return bytes;
+};
@@ -0,0 +1,90 @@
+#ifndef GPU_MEMORY_TRACKER_HPP
+#define GPU_MEMORY_TRACKER_HPP
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+#include <mutex>
+
+// GPU 메모리 할당 유형을 enum 으로 정의
+enum GpuMemoryCategory
+{
+  GPU_MEMORY_TEXTURE,        // 이미지 파일에서 로드한 텍스쳐, 프레임버퍼 color attachment 텍스쳐
+  GPU_MEMORY_RENDERBUFFER,   // multisampled 프레임버퍼 등의 renderbuffer
+  GPU_MEMORY_VERTEX_BUFFER,  // VBO 등 정점 데이터 버퍼
+  GPU_MEMORY_GLYPH,          // TextRenderer 의 glyph 텍스쳐
+  GPU_MEMORY_UNIFORM_BUFFER, // 쉐이더들이 공유하는 uniform block 버퍼
+  GPU_MEMORY_CATEGORY_COUNT
+};
+
+// 메모리 예산 초과 시 대응 정책
+enum GpuBudgetPolicy
+{
+  GPU_BUDGET_WARN,     // 경고 로그만 출력
+  GPU_BUDGET_DOWNGRADE // 경고 로그 출력 + 이후 로드되는 텍스쳐를 더 작은 포맷/해상도로 다운그레이드
+};
+
+/**
+ * GpuMemoryTracker 클래스
+ *
+ * 모든 GPU 메모리 할당을 추정 byte 크기 및 유형(category)과 함께 등록하여 집계하는 singleton 클래스.
+ * -> 할당 주체(GLObject)가 소멸 시점에 등록을 해제하므로, 현재 사용 중인 GPU 메모리 추정치를 언제든 조회할 수 있음.
+ * -> 메모리 예산(budget)을 설정하면, 예산 초과 시 정책에 따라 경고하거나 리소스 로딩 단계에서 다운그레이드를 요청함.
+ *
+ * 참고로, 실제 드라이버 내부 할당량(alignment, padding 등)은 알 수 없으므로 모든 크기는 '추정치'임.
+ */
+class GpuMemoryTracker
+{
+public:
+  // GPU 메모리 할당 등록 -> 등록 해제 시 사용할 id 반환 (0 은 유효하지 않은 id)
+  static unsigned int Register(GpuMemoryCategory category, std::size_t bytes, const std::string &label);
+  // GPU 메모리 할당 등록 해제
+  static void Unregister(unsigned int id);
+
+  // 현재 등록된 GPU 메모리 총량, 유형별 총량/개수, 최대 사용량 조회
+  static std::size_t TotalBytes();
+  static std::size_t CategoryBytes(GpuMemoryCategory category);
+  static unsigned int CategoryCount(GpuMemoryCategory category);
+  static std::size_t PeakBytes();
+
+  // 메모리 예산 설정 (budgetBytes 가 0 이면 예산 제한 없음)
+  static void SetBudget(std::size_t budgetBytes, GpuBudgetPolicy policy);
+  static std::size_t Budget();
+  static GpuBudgetPolicy Policy();
+
+  // bytes 만큼 추가로 할당했을 때 예산을 초과하는지 여부 -> 리소스 로딩 단계에서 다운그레이드 여부 판단 시 사용
+  static bool WouldExceedBudget(std::size_t bytes);
+
+  // 유형별 합계 및 개별 할당 목록을 로그로 출력
+  static void Report(std::ostream &out, bool listAllocations = false);
+
+  // OpenGL internal format 의 pixel 당 추정 byte 크기 및 텍스쳐 전체 추정 크기 (mip chain 포함) 계산
+  static std::size_t BytesPerPixel(unsigned int internalFormat);
+  static std::size_t EstimateTextureBytes(unsigned int internalFormat, unsigned int width, unsigned int height, unsigned int mipLevels = 1);
+
+private:
+  // 개별 할당 정보
+  struct Allocation
+  {
+    GpuMemoryCategory Category;
+    std::size_t Bytes;
+    std::string Label;
+    bool Alive;
+  };
+
+  static std::vector<Allocation> allocations; // id - 1 을 index 로 사용하는 할당 정보 컨테이너
+  static std::vector<unsigned int> freeIds;   // 등록 해제되어 재사용 가능한 id 목록
+  static std::size_t categoryBytes[GPU_MEMORY_CATEGORY_COUNT];
+  static unsigned int categoryCounts[GPU_MEMORY_CATEGORY_COUNT];
+  static std::size_t totalBytes, peakBytes;
+  static std::size_t budgetBytes;
+  static GpuBudgetPolicy policy;
+  static bool overBudgetWarned; // 예산 초과 경고를 예산 이하로 내려올 때까지 한 번만 출력하기 위한 플래그
+  static std::mutex mutex;
+
+  // singleton 클래스는 인스턴스 생성이 불필요하므로, 생성자 함수 캡슐화
+  GpuMemoryTracker() {};
+};
+
+#endif /* GPU_MEMORY_TRACKER_HPP */
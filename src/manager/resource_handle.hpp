@@ -0,0 +1,47 @@
+#ifndef RESOURCE_HANDLE_HPP
+#define RESOURCE_HANDLE_HPP
+
+/**
+ * 리소스 이름을 컴파일 타임에 32bit 정수로 해싱하는 함수 (FNV-1a)
+ *
+ * -> C++11 constexpr 함수는 단일 return 문만 허용하므로, 재귀 호출로 구현함.
+ * -> 문자열 리터럴을 전달하면 컴파일 타임에 계산되므로, 런타임 문자열 비교 비용이 사라짐.
+ */
+constexpr unsigned int HashName(const char *str, unsigned int hash = 2166136261u)
+{
+  return *str == '\0' ? hash : HashName(str + 1, (hash ^ static_cast<unsigned char>(*str)) * 16777619u);
+}
+
+/**
+ * ResourceHandle 구조체
+ *
+ * ResourceManager 의 dense std::vector 컨테이너에 저장된 리소스를 가리키는 정수 index 를 감싼 타입.
+ * -> Tag 템플릿 인자로 리소스 종류를 구분하여, TextureHandle 자리에 ShaderHandle 을 전달하는 실수를 컴파일 타임에 방지함.
+ *
+ * 참고로, 이 헤더는 OpenGL 에 의존하지 않으므로, GL 컨텍스트 없이도 include 할 수 있음.
+ */
+template <typename Tag>
+struct ResourceHandle
+{
+  static const unsigned int INVALID = 0xFFFFFFFFu;
+
+  unsigned int Index; // 리소스 컨테이너 index
+
+  ResourceHandle() : Index(INVALID) {};
+  explicit ResourceHandle(unsigned int index) : Index(index) {};
+
+  // 리소스가 로드되어 유효한 index 를 가리키는지 여부
+  bool IsValid() const { return this->Index != INVALID; }
+
+  bool operator==(const ResourceHandle &other) const { return this->Index == other.Index; }
+  bool operator!=(const ResourceHandle &other) const { return this->Index != other.Index; }
+};
+
+// 리소스 종류를 구분하기 위한 tag 타입 (정의 불필요)
+struct TextureTag;
+struct ShaderTag;
+
+typedef ResourceHandle<TextureTag> TextureHandle;
+typedef ResourceHandle<ShaderTag> ShaderHandle;
+
+#endif /* RESOURCE_HANDLE_HPP */
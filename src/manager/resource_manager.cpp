@@ -3,56 +3,172 @@
 #include <iostream>
 #include <sstream>
 #include <fstream>
+#include <stdexcept>
+#include <utility>
 
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb_image.h>
 
 /**
  * singleton 클래스는 인스턴스를 별도로 초기화하지 않으므로,
- * std::map 컨테이너같은 정적 멤버변수들에 저장 공간을 할당하기 위해서는
+ * std::vector 컨테이너같은 정적 멤버변수들에 저장 공간을 할당하기 위해서는
  * .cpp 같은 구현부에서 이 컨테이너에 정적 메모리를 반드시 초기화해줘야 함.
  *
  * 그렇지 않으면 컴파일러가 해당 정적 멤버 변수의 공간을 할당하지 않아 링크 에러가 발생함.
  */
-std::map<std::string, Shader> ResourceManager::Shaders;
-std::map<std::string, Texture2D> ResourceManager::Textures;
+std::vector<Shader> ResourceManager::Shaders;
+std::vector<Texture2D> ResourceManager::Textures;
+std::vector<GLProgram> ResourceManager::programs;
+std::unordered_map<unsigned int, unsigned int> ResourceManager::shaderLookup;
+std::unordered_map<unsigned int, unsigned int> ResourceManager::textureLookup;
+std::vector<std::string> ResourceManager::shaderNames;
+std::vector<std::string> ResourceManager::textureNames;
 
-Shader ResourceManager::LoadShader(const char *vShaderFile, const char *fShaderFile, const char *gShaderFile, std::string name)
+/**
+ * name 해시값으로 검색 테이블에 등록된 handle index 를 찾거나, 새로운 index 를 할당하는 헬퍼 함수
+ *
+ * -> 서로 다른 name 이 같은 해시값을 갖는 경우(= 해시 충돌)에는 handle 이 뒤섞이지 않도록 예외를 던짐.
+ */
+static unsigned int acquireSlot(std::unordered_map<unsigned int, unsigned int> &lookup, std::vector<std::string> &names, const std::string &name)
+{
+  unsigned int hash = HashName(name.c_str());
+  std::unordered_map<unsigned int, unsigned int>::iterator iter = lookup.find(hash);
+  if (iter != lookup.end())
+  {
+    if (names[iter->second] != name)
+    {
+      std::cout << "ERROR::RESOURCE_MANAGER: Name hash collision between '" << names[iter->second] << "' and '" << name << "'" << std::endl;
+      throw std::runtime_error("ResourceManager: name hash collision");
+    }
+    return iter->second;
+  }
+
+  unsigned int index = static_cast<unsigned int>(names.size());
+  lookup[hash] = index;
+  names.push_back(name);
+  return index;
+}
+
+// name 해시값으로 handle index 를 검색하는 헬퍼 함수 (검색 실패 시 에러 로그 출력 후 예외를 던짐)
+static unsigned int findSlot(const std::unordered_map<unsigned int, unsigned int> &lookup, unsigned int nameHash, const char *kind, const std::string &name)
 {
-  // 로드 및 생성된 Shader 객체를 std:map 컨테이너에 저장
-  Shaders[name] = loadShaderFromFile(vShaderFile, fShaderFile, gShaderFile);
-  return Shaders[name];
+  std::unordered_map<unsigned int, unsigned int>::const_iterator iter = lookup.find(nameHash);
+  if (iter == lookup.end())
+  {
+    std::cout << "ERROR::RESOURCE_MANAGER: Unknown " << kind << " '" << name << "' (hash 0x" << std::hex << nameHash << std::dec << ")" << std::endl;
+    throw std::out_of_range("ResourceManager: unknown resource name");
+  }
+  return iter->second;
+}
+
+ShaderHandle ResourceManager::LoadShader(const char *vShaderFile, const char *fShaderFile, const char *gShaderFile, const std::string &name)
+{
+  unsigned int index = acquireSlot(shaderLookup, shaderNames, name);
+
+  // 로드 및 생성된 Shader 객체를 handle index 위치에 저장 (같은 name 으로 다시 로드한 경우 기존 쉐이더 프로그램은 GLProgram 이동 대입 시 반납됨)
+  Shader shader = loadShaderFromFile(vShaderFile, fShaderFile, gShaderFile);
+  if (index < Shaders.size())
+  {
+    Shaders[index] = shader;
+    programs[index] = GLProgram(shader.ID);
+  }
+  else
+  {
+    Shaders.push_back(shader);
+    programs.push_back(GLProgram(shader.ID));
+  }
+  return ShaderHandle(index);
 };
 
-Texture2D ResourceManager::LoadTexture(const char *file, bool alpha, std::string name)
+TextureHandle ResourceManager::LoadTexture(const char *file, const std::string &name, const TextureImportOptions &options)
 {
-  // 로드 및 생성된 Texture2D 객체를 std:map 컨테이너에 저장
-  Textures[name] = loadTextureFromFile(file, alpha);
-  return Textures[name];
+  unsigned int index = acquireSlot(textureLookup, textureNames, name);
+
+  // 로드 및 생성된 Texture2D 객체를 handle index 위치로 이동 (같은 name 으로 다시 로드한 경우 기존 텍스쳐 객체는 이동 대입 시 반납됨)
+  Texture2D texture = loadTextureFromFile(file, name, options);
+  if (index < Textures.size())
+  {
+    Textures[index] = std::move(texture);
+  }
+  else
+  {
+    Textures.push_back(std::move(texture));
+  }
+  return TextureHandle(index);
 };
 
-Shader ResourceManager::GetShader(std::string name)
+ShaderHandle ResourceManager::GetShaderHandle(const std::string &name)
 {
-  return Shaders[name];
+  return ShaderHandle(findSlot(shaderLookup, HashName(name.c_str()), "shader", name));
 };
 
-Texture2D ResourceManager::GetTexture(std::string name)
+ShaderHandle ResourceManager::GetShaderHandle(unsigned int nameHash)
 {
-  return Textures[name];
+  return ShaderHandle(findSlot(shaderLookup, nameHash, "shader", std::string()));
 };
 
-void ResourceManager::Clear()
+TextureHandle ResourceManager::GetTextureHandle(const std::string &name)
+{
+  return TextureHandle(findSlot(textureLookup, HashName(name.c_str()), "texture", name));
+};
+
+TextureHandle ResourceManager::GetTextureHandle(unsigned int nameHash)
 {
-  // 각 std::map 컨테이너를 for-each 문으로 순회하며 메모리 반납
-  // (참고로, std::map 컨테이너의 각 노드는 std::pair<first(key), second(value)> 타입으로 저장되어 있음.)
-  for (auto iter : Shaders)
+  return TextureHandle(findSlot(textureLookup, nameHash, "texture", std::string()));
+};
+
+Shader &ResourceManager::GetShader(ShaderHandle handle)
+{
+  // 유효하지 않은 handle 로 접근 시, 기본 리소스를 생성하지 않고 즉시 예외를 던짐.
+  if (handle.Index >= Shaders.size())
   {
-    glDeleteProgram(iter.second.ID);
+    std::cout << "ERROR::RESOURCE_MANAGER: Invalid shader handle " << handle.Index << std::endl;
+    throw std::out_of_range("ResourceManager: invalid shader handle");
   }
-  for (auto iter : Textures)
+  return Shaders[handle.Index];
+};
+
+Texture2D &ResourceManager::GetTexture(TextureHandle handle)
+{
+  if (handle.Index >= Textures.size())
   {
-    glDeleteTextures(1, &iter.second.ID);
+    std::cout << "ERROR::RESOURCE_MANAGER: Invalid texture handle " << handle.Index << std::endl;
+    throw std::out_of_range("ResourceManager: invalid texture handle");
   }
+  return Textures[handle.Index];
+};
+
+Shader &ResourceManager::GetShader(const std::string &name)
+{
+  return GetShader(GetShaderHandle(name));
+};
+
+Texture2D &ResourceManager::GetTexture(const std::string &name)
+{
+  return GetTexture(GetTextureHandle(name));
+};
+
+void ResourceManager::Clear()
+{
+  // 리소스를 소유한 RAII 래퍼들이 컨테이너에서 제거되면서 GL 객체가 반납됨.
+  // -> 반납된 리소스를 가리키는 handle 이 재사용되지 않도록 검색 테이블도 함께 초기화
+  programs.clear();
+  Shaders.clear();
+  Textures.clear();
+  shaderLookup.clear();
+  textureLookup.clear();
+  shaderNames.clear();
+  textureNames.clear();
+};
+
+void ResourceManager::SetMemoryBudget(std::size_t budgetBytes, GpuBudgetPolicy policy)
+{
+  GpuMemoryTracker::SetBudget(budgetBytes, policy);
+};
+
+void ResourceManager::PrintMemoryReport(std::ostream &out, bool listAllocations)
+{
+  GpuMemoryTracker::Report(out, listAllocations);
 };
 
 Shader ResourceManager::loadShaderFromFile(const char *vShaderFile, const char *fShaderFile, const char *gShaderFile)
@@ -109,27 +225,68 @@ Shader ResourceManager::loadShaderFromFile(const char *vShaderFile, const char *
   return shader;
 };
 
-Texture2D ResourceManager::loadTextureFromFile(const char *file, bool alpha)
+Texture2D ResourceManager::loadTextureFromFile(const char *file, const std::string &name, const TextureImportOptions &options)
 {
   // Texture2D 객체 생성
   Texture2D texture;
 
-  // alpha 매개변수에 따라 텍스쳐 internal format 변경
-  if (alpha)
+  // stb_image 라이브러리로 이미지 데이터를 파일에 저장된 채널 수 그대로 로드
+  int width, height, nrChannels;
+  unsigned char *data = stbi_load(file, &width, &height, &nrChannels, 0);
+  if (data == nullptr)
   {
-    texture.Internal_Format = GL_RGBA;
-    texture.Image_Format = GL_RGBA;
+    std::cout << "ERROR::TEXTURE: Failed to load texture '" << name << "' from " << file << std::endl;
+    return texture;
   }
 
-  // stb_image 라이브러리로 이미지 데이터 로드
-  int width, height, nrChannels;
-  unsigned char *data = stbi_load(file, &width, &height, &nrChannels, 0);
+  // 채널 검출, 목표 해상도로 축소, premultiply, 포맷 선택 등의 전처리 수행 후 원본 이미지 데이터 메모리 반납
+  TextureImage image;
+  ImportTexture(data, width, height, nrChannels, options, image);
+  stbi_image_free(data);
 
-  // 텍스쳐 생성 및 이미지 데이터 write
-  texture.Generate(width, height, data);
+  texture.Internal_Format = image.Internal_Format;
+  texture.Image_Format = image.Image_Format;
+  for (int i = 0; i < 4; i++)
+  {
+    texture.Swizzle[i] = image.Swizzle[i];
+  }
+  texture.PremultipliedAlpha = image.Premultiplied;
+  texture.Mipmaps = options.GenerateMipmaps;
 
-  // 이미지 데이터 메모리 반납
-  stbi_image_free(data);
+  // GPU 메모리 예산 초과 시 다운그레이드 정책이 설정되어 있다면, mip chain 제거 -> 더 작은 포맷 -> 더 작은 해상도 순으로 다운그레이드
+  unsigned int mipLevels = texture.Mipmaps ? CountMipLevels(image.Width, image.Height) : 1;
+  if (GpuMemoryTracker::Policy() == GPU_BUDGET_DOWNGRADE &&
+      GpuMemoryTracker::WouldExceedBudget(GpuMemoryTracker::EstimateTextureBytes(texture.Internal_Format, image.Width, image.Height, mipLevels)))
+  {
+    // 1단계: mip chain 을 생성하지 않음 (메모리 약 1/4 절감)
+    texture.Mipmaps = false;
+
+    // 2단계: 채널당 8bit 포맷 대신 16bit 이하 packed 포맷 사용 (양자화 오차 허용치와 무관하게 강제)
+    if (GpuMemoryTracker::WouldExceedBudget(GpuMemoryTracker::EstimateTextureBytes(texture.Internal_Format, image.Width, image.Height)))
+    {
+      texture.Internal_Format = CompactInternalFormat(image.Channels);
+    }
+
+    // 3단계: 그래도 예산을 초과한다면 최소 크기에 도달할 때까지 해상도를 절반씩 축소 (메모리 1/4 씩)
+    const int minSize = 16;
+    while (GpuMemoryTracker::WouldExceedBudget(GpuMemoryTracker::EstimateTextureBytes(texture.Internal_Format, image.Width, image.Height)) &&
+           image.Width / 2 >= minSize && image.Height / 2 >= minSize)
+    {
+      DownsampleHalf(image.Pixels, image.Width, image.Height, image.Channels);
+    }
+
+    std::cout << "WARNING::GPU_MEMORY: Downgraded texture '" << name << "' to " << image.Width << "x" << image.Height
+              << " (format 0x" << std::hex << texture.Internal_Format << std::dec << ", no mipmaps) to fit the memory budget" << std::endl;
+  }
+
+  // mip chain 을 생성하는 텍스쳐는 축소되어 그려질 때 aliasing 이 생기지 않도록 trilinear 필터링 사용
+  if (texture.Mipmaps)
+  {
+    texture.Filter_Min = GL_LINEAR_MIPMAP_LINEAR;
+  }
+
+  // 텍스쳐 생성 및 이미지 데이터 write
+  texture.Generate(image.Width, image.Height, image.Pixels.data(), name.c_str());
 
   return texture;
 };
@@ -1,13 +1,17 @@
 #ifndef RESOURCE_MANAGER_HPP
 #define RESOURCE_MANAGER_HPP
 
-#include <map>
 #include <string>
+#include <vector>
+#include <unordered_map>
 
 #include <glad/glad.h>
 
+#include "resource_handle.hpp"
+#include "gpu_memory_tracker.hpp"
 #include "../utils/shader.hpp"
 #include "../utils/texture.hpp"
+#include "../utils/texture_import.hpp"
 
 /**
  * Shader, Texture 등의 리소스 객체 생성, 저장, file system 인터페이스 호출을 담당하는 singleton class
@@ -16,28 +20,58 @@
 class ResourceManager
 {
 public:
-  // 생성된 리소스들을 std::pair<std::string name, 리소스 객체> 타입으로 저장할 std::map 컨테이너
-  static std::map<std::string, Shader> Shaders;
-  static std::map<std::string, Texture2D> Textures;
+  // 생성된 리소스들을 handle index 순서대로 저장할 dense std::vector 컨테이너 -> handle 로 O(1) 접근
+  // (Texture2D 는 move-only 이므로 텍스쳐 객체는 이 컨테이너가 단독으로 소유함.)
+  static std::vector<Shader> Shaders;
+  static std::vector<Texture2D> Textures;
 
-  // 파일 경로를 입력하면 리소스를 로드 및 생성하여 std::map 컨테이너에 저장하는 함수들 -> 캡슐화된 resource loading 함수들을 내부에서 호출.
-  static Shader LoadShader(const char *vShaderFile, const char *fShaderFile, const char *gShaderFile, std::string name);
-  static Texture2D LoadTexture(const char *file, bool alpha, std::string name);
+  // 파일 경로를 입력하면 리소스를 로드 및 생성하여 컨테이너에 저장하고, 저장된 위치를 가리키는 handle 을 반환하는 함수들
+  // -> 이미 같은 name 으로 로드된 리소스가 있다면, 기존 리소스를 교체하고 동일한 handle 을 반환함.
+  // -> 텍스쳐의 채널 수 및 포맷은 이미지 내용으로 결정되며, mip chain / premultiply / 목표 해상도 등은 options 로 지정함.
+  static ShaderHandle LoadShader(const char *vShaderFile, const char *fShaderFile, const char *gShaderFile, const std::string &name);
+  static TextureHandle LoadTexture(const char *file, const std::string &name, const TextureImportOptions &options = TextureImportOptions());
 
-  // 각 리소스 name 을 통해 std::map 컨테이너에 저장된 리소스를 검색 및 반환하는 getter
-  static Shader GetShader(std::string name);
-  static Texture2D GetTexture(std::string name);
+  // 리소스 name(또는 HashName() 으로 컴파일 타임에 해싱된 name)으로 handle 을 검색하는 함수들
+  // -> 로드되지 않은 name 을 전달하면 에러 로그 출력 후 std::out_of_range 예외를 던짐. (기본 리소스를 조용히 생성하지 않음)
+  static ShaderHandle GetShaderHandle(const std::string &name);
+  static ShaderHandle GetShaderHandle(unsigned int nameHash);
+  static TextureHandle GetTextureHandle(const std::string &name);
+  static TextureHandle GetTextureHandle(unsigned int nameHash);
 
-  // std::map 컨테이너에 저장된 리소스들 메모리 반납
+  // handle 로 컨테이너에 저장된 리소스를 O(1) 로 반환하는 getter (매 프레임 호출되는 곳에서는 이쪽을 사용)
+  static Shader &GetShader(ShaderHandle handle);
+  static Texture2D &GetTexture(TextureHandle handle);
+
+  // name 으로 리소스를 검색 및 반환하는 getter -> 초기화 단계처럼 자주 호출되지 않는 곳에서만 사용
+  static Shader &GetShader(const std::string &name);
+  static Texture2D &GetTexture(const std::string &name);
+
+  // 컨테이너에 저장된 리소스들 메모리 반납
   static void Clear();
 
+  // GPU 메모리 예산 설정 (이후 로드되는 텍스쳐부터 적용) 및 GPU 메모리 사용량 리포트 출력
+  // -> GPU_BUDGET_DOWNGRADE 정책에서는 예산을 초과하는 텍스쳐를 mip chain 제거 -> 더 작은 포맷 -> 더 작은 해상도 순으로 줄여서 업로드함.
+  static void SetMemoryBudget(std::size_t budgetBytes, GpuBudgetPolicy policy);
+  static void PrintMemoryReport(std::ostream &out, bool listAllocations = false);
+
 private:
+  // Shaders 컨테이너의 쉐이더 프로그램 소유권을 갖는 RAII 래퍼 (handle index 와 동일한 순서로 저장)
+  static std::vector<GLProgram> programs;
+
+  // name 해시값 -> handle index 검색 테이블 (로드 시점에 한 번만 갱신됨)
+  static std::unordered_map<unsigned int, unsigned int> shaderLookup;
+  static std::unordered_map<unsigned int, unsigned int> textureLookup;
+
+  // 에러 로그 및 해시 충돌 검사에 사용할 리소스 name (handle index 와 동일한 순서로 저장)
+  static std::vector<std::string> shaderNames;
+  static std::vector<std::string> textureNames;
+
   // singleton 클래스는 인스턴스 생성이 불필요하므로, 생성자 함수 캡슐화
   ResourceManager() {};
 
   // file system 인터페이스 호출을 통해 resource loading 처리 함수 캡슐화
   static Shader loadShaderFromFile(const char *vShaderFile, const char *fShaderFile, const char *gShaderFile = nullptr);
-  static Texture2D loadTextureFromFile(const char *file, bool alpha);
+  static Texture2D loadTextureFromFile(const char *file, const std::string &name, const TextureImportOptions &options);
 };
 
 #endif /* RESOURCE_MANAGER_HPP */
@@ -1,14 +1,29 @@
 #include "particle_generator.hpp"
-#include <cstdlib>
+#include "../manager/resource_manager.hpp"
+#include "../profiler/cpu_profiler.hpp"
+#include "../renderer/render_stats.hpp"
 
-ParticleGenerator::ParticleGenerator(Shader shader, Texture2D texture, unsigned int amount)
-    : shader(shader), texture(texture), amount(amount)
+ParticleGenerator::ParticleGenerator(Shader shader, TextureHandle texture, unsigned int amount)
+    : shader(shader), texture(texture), amount(amount), rng(1, RANDOM_STREAM_PARTICLES)
 {
   this->init();
+  this->initRenderData();
 }
 
-void ParticleGenerator::Update(float dt, GameObejct &object, unsigned int newParticles, glm::vec2 offset)
+ParticleGenerator::ParticleGenerator(unsigned int amount)
+    : amount(amount), rng(1, RANDOM_STREAM_PARTICLES)
 {
+  this->init();
+}
+
+void ParticleGenerator::Update(float dt, glm::vec2 position, glm::vec2 velocity, unsigned int newParticles, glm::vec2 offset)
+{
+  PROFILE_SCOPE("ParticleGenerator::Update");
+
+  // respawn 할 particle 들의 위치/색상 난수를 한 번에 생성 (particle 은 화면 효과일 뿐이므로 gameplay 난수열을 소비하지 않음)
+  this->randoms.resize(newParticles * 2);
+  this->rng.FillFloat(this->randoms.data(), this->randoms.size());
+
   // 매 프레임마다 newParticles 개수만큼 particle respawn
   for (unsigned int i = 0; i < newParticles; i++)
   {
@@ -16,7 +31,7 @@ void ParticleGenerator::Update(float dt, GameObejct &object, unsigned int newPar
     int unusedParticle = this->firstUnusedParticle();
 
     // 탐색된 대기 상태의 particle 재사용을 위해 오브젝트 풀에서 꺼내 respawn
-    this->respawnParticle(this->particles[unusedParticle], object, offset);
+    this->respawnParticle(this->particles[unusedParticle], position, velocity, offset, this->randoms[i * 2], this->randoms[i * 2 + 1]);
   }
 
   // 오브젝트 풀에 저장된 모든 particle 객체들을 순회하며 데이터 업데이트
@@ -41,45 +56,83 @@ void ParticleGenerator::Update(float dt, GameObejct &object, unsigned int newPar
   }
 };
 
-void ParticleGenerator::Draw()
+void ParticleGenerator::Draw(glm::vec2 viewMin, glm::vec2 viewMax)
 {
+  PROFILE_SCOPE("ParticleGenerator::Draw");
+
+  // 렌더링 데이터 없이 생성된 경우 그리지 않음
+  if (!this->VAO)
+  {
+    return;
+  }
+
   // particle 이 겹칠 때 glowy effect 를 주기 위해 blending function 을 additive blending(가산 혼합)으로 설정
   glBlendFunc(GL_SRC_ALPHA, GL_ONE);
 
   // particle 렌더링 시 사용할 쉐이더 객체 바인딩
   this->shader.Use();
 
+  // 모든 particle 이 같은 텍스쳐와 2D Quad 를 사용하므로, 루프 진입 전에 0번 texture unit 활성화 및 텍스쳐, VAO 객체를 한 번만 바인딩
+  glActiveTexture(GL_TEXTURE0);
+  ResourceManager::GetTexture(this->texture).Bind();
+  RenderStats::CountTextureBind();
+  glBindVertexArray(this->VAO.Get());
+
   // 오브젝트 풀에 저장된 particle 을 순회하며 렌더링
-  for (Particle particle : this->particles)
+  // -> particle quad 가 view 와 겹치지 않으면 draw call 을 생략 (quad 는 Position 에서 PARTICLE_SIZE 만큼 오른쪽 아래로 펼쳐짐)
+  unsigned int submitted = 0, culled = 0;
+  for (const Particle &particle : this->particles)
   {
     // 수명이 남아있는 particle 만 렌더링
     if (particle.Life > 0.0f)
     {
+      if (particle.Position.x >= viewMax.x || particle.Position.y >= viewMax.y ||
+          particle.Position.x + PARTICLE_SIZE <= viewMin.x || particle.Position.y + PARTICLE_SIZE <= viewMin.y)
+      {
+        culled++;
+        continue;
+      }
       this->shader.SetVec2("offset", particle.Position);
       this->shader.SetVec4("color", particle.Color);
-
-      // 0번 texture unit 활성화 및 전달받은 텍스쳐 객체 바인딩
-      glActiveTexture(GL_TEXTURE0);
-      this->texture.Bind();
-
-      glBindVertexArray(this->VAO);
       glDrawArrays(GL_TRIANGLES, 0, 6);
-      glBindVertexArray(0);
+      RenderStats::CountDrawCall();
+      submitted++;
     }
   }
+  glBindVertexArray(0);
+  RenderStats::CountSubmitted(submitted);
+  RenderStats::CountCulled(culled);
 
   // 렌더링 완료 후 blending function 을 default 로 원복
   glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 }
 
+unsigned int ParticleGenerator::LiveCount() const
+{
+  unsigned int count = 0;
+  for (const Particle &particle : this->particles)
+  {
+    if (particle.Life > 0.0f)
+    {
+      count++;
+    }
+  }
+  return count;
+};
+
 void ParticleGenerator::init()
+{
+  // this->amount 에 해당하는 개수만큼 오브젝트 풀에 particle 객체를 미리 생성
+  this->particles.assign(this->amount, Particle());
+};
+
+void ParticleGenerator::initRenderData()
 {
   /**
    * particle 2D Quad 렌더링 시 사용할 VBO, VAO 객체 생성 및 바인딩
    * (SpriteRenderer::initRenderData() 함수와 정점 데이터 설정 동일)
    */
-  // 실제 정점 데이터 바인딩 시, VAO 객체만 바인딩하면 되므로, VBO ID 값은 멤버변수로 들고있지 않아도 됨.
-  unsigned int VBO;
+  // 실제 정점 데이터 바인딩 시에는 VAO 객체만 바인딩하면 되지만, VBO 객체도 반납해야 하므로 멤버변수로 소유함.
   float particle_quad[] = {
       // pos      // tex
       0.0f, 1.0f, 0.0f, 1.0f,
@@ -90,14 +143,15 @@ void ParticleGenerator::init()
       1.0f, 1.0f, 1.0f, 1.0f,
       1.0f, 0.0f, 1.0f, 0.0f};
 
-  glGenVertexArrays(1, &this->VAO);
-  glGenBuffers(1, &VBO);
+  this->VAO = GLVertexArray::Create();
+  this->VBO = GLBuffer::Create();
 
-  glBindVertexArray(this->VAO);
+  glBindVertexArray(this->VAO.Get());
 
   // 2D Quad 정점 데이터를 VBO 객체에 write
-  glBindBuffer(GL_ARRAY_BUFFER, VBO);
+  glBindBuffer(GL_ARRAY_BUFFER, this->VBO.Get());
   glBufferData(GL_ARRAY_BUFFER, sizeof(particle_quad), particle_quad, GL_STATIC_DRAW);
+  this->VBO.Track(GPU_MEMORY_VERTEX_BUFFER, sizeof(particle_quad), "particle_quad");
 
   // 2D Quad 의 pos, uv 데이터가 vec4 로 묶인 0번 attribute 변수 활성화 및 데이터 해석 방식 정의
   glEnableVertexAttribArray(0);
@@ -106,12 +160,6 @@ void ParticleGenerator::init()
   // 정점 데이터 설정 완료 후 VBO, VAO 바인딩 해제
   glBindBuffer(GL_ARRAY_BUFFER, 0);
   glBindVertexArray(0);
-
-  // this->amount 에 해당하는 개수만큼 오브젝트 풀에 particle 객체를 미리 생성
-  for (unsigned int i = 0; i < this->amount; i++)
-  {
-    this->particles.push_back(Particle());
-  }
 };
 
 unsigned int lastUsedParticle = 0; // ParticleGenerator::firstUnusedParticle() 함수를 통해 가장 최근에 탐색되어 respawn 된 particle index 를 전역변수로 저장
@@ -147,16 +195,16 @@ unsigned int ParticleGenerator::firstUnusedParticle()
   return 0;
 };
 
-void ParticleGenerator::respawnParticle(Particle &particle, GameObejct &object, glm::vec2 offset)
+void ParticleGenerator::respawnParticle(Particle &particle, glm::vec2 position, glm::vec2 velocity, glm::vec2 offset, float jitter, float brightness)
 {
-  float random = ((std::rand() % 100) - 50) / 10.0f;    // [-5.0, 4.9] 범위 난수 생성 -> Particle position 랜덤 조정 목적
-  float rColor = 0.5f + ((std::rand() % 100) / 100.0f); // [0.5, 1.49] 범위 난수 생성 -> Particle color 랜덤 조정 목적
+  float random = jitter * 10.0f - 5.0f; // [-5.0, 5.0) 범위로 변환 -> Particle position 랜덤 조정 목적
+  float rColor = 0.5f + brightness;     // [0.5, 1.5) 범위로 변환 -> Particle color 랜덤 조정 목적
 
   /** 대기 상태의 particle 재사용을 위해 property update */
-  particle.Position = object.Position + random + offset;    // ball 위치(object.Position)에서 약간 떨어트린(offset) 뒤, slightly random 하게(random) 재조정
+  particle.Position = position + random + offset;           // ball 위치(position)에서 약간 떨어트린(offset) 뒤, slightly random 하게(random) 재조정
   particle.Color = glm::vec4(rColor, rColor, rColor, 1.0f); // 각 particle 마다 랜덤한 색상 부여
   particle.Life = 1.0f;                                     // particle 수명 1초로 초기화
-  particle.Velocity = object.Velocity * 0.1f;               // ball 속도(object.Velocity)와 방향을 맞추되, '속력'은 0.1배로 줄임.
+  particle.Velocity = velocity * 0.1f;                      // ball 속도(velocity)와 방향을 맞추되, '속력'은 0.1배로 줄임.
 };
 
 /**
@@ -7,8 +7,12 @@
 #include <glm/glm.hpp>
 
 #include "../utils/shader.hpp"
-#include "../utils/texture.hpp"
-#include "../game_object/game_object.hpp"
+#include "../utils/gl_object.hpp"
+#include "../utils/random.hpp"
+#include "../manager/resource_handle.hpp"
+
+// particle quad 의 world 크기 (particle.vs 의 scale 과 같아야 함, view culling 시 사용)
+const float PARTICLE_SIZE = 10.0f;
 
 // Particle 구조체 정의
 struct Particle
@@ -33,29 +37,41 @@ class ParticleGenerator
 {
 public:
   // 생성자 (particle 렌더링에 사용할 쉐이더 객체, 텍스쳐 객체, 오브젝트 풀에서 관리할 전체 particle 개수)
-  ParticleGenerator(Shader shader, Texture2D texture, unsigned int amount);
+  ParticleGenerator(Shader shader, TextureHandle texture, unsigned int amount);
+
+  // 렌더링 데이터 없이 오브젝트 풀만 생성하는 생성자 (GL 컨텍스트가 없는 벤치마크 등에서 Update() 만 호출하는 용도, Draw() 는 아무것도 그리지 않음)
+  explicit ParticleGenerator(unsigned int amount);
+
+  // 매 프레임마다 particle 업데이트 (position, velocity 로 이동 중인 object 를 따라다니도록 particle 재생성 및 각 particle property 업데이트)
+  void Update(float dt, glm::vec2 position, glm::vec2 velocity, unsigned int newParticles, glm::vec2 offset = glm::vec2(0.0f, 0.0f));
 
-  // 매 프레임마다 particle 업데이트 (particle 재생성 및 각 particle property 업데이트)
-  void Update(float dt, GameObejct &object, unsigned int newParticles, glm::vec2 offset = glm::vec2(0.0f, 0.0f));
+  // 수명이 남아있는 particle 중 view 영역 [viewMin, viewMax] 과 겹치는 particle 만 렌더링 (제출, culling 개수는 RenderStats 에 집계)
+  void Draw(glm::vec2 viewMin, glm::vec2 viewMax);
 
-  // 수명이 남아있는 particle 렌더링
-  void Draw();
+  // 수명이 남아있는 particle 개수 (성능 overlay 표시용)
+  unsigned int LiveCount() const;
 
 private:
   std::vector<Particle> particles; // 정해진 개수의 particle 들을 관리하는 컨테이너 -> Object Pool
   unsigned int amount;             // 오브젝트 풀에 담긴 전체 particle 개수
   Shader shader;                   // particle 렌더링에 사용할 쉐이더 객체
-  Texture2D texture;               // particle 렌더링에 사용할 텍스쳐 객체
-  unsigned int VAO;                // particle 렌더링에 사용할 정점 데이터가 바인딩된 VAO 객체
+  TextureHandle texture;           // particle 렌더링에 사용할 텍스쳐 handle (텍스쳐 객체는 ResourceManager 가 소유)
+  GLVertexArray VAO;               // particle 렌더링에 사용할 정점 데이터가 바인딩된 VAO 객체
+  GLBuffer VBO;                    // particle 2D Quad 정점 데이터가 기록된 VBO 객체
+  Random rng;                      // particle 위치/색상 랜덤 조정에 사용할 particles 난수열 (gameplay 난수열과 분리)
+  std::vector<float> randoms;      // respawn 할 particle 들의 난수를 한 번에 채워두는 버퍼 (particle 하나 당 2 개)
 
-  // particle 렌더링에 사용할 정점 데이터 및 버퍼 객체 초기화
+  // 오브젝트 풀 초기화
   void init();
 
+  // particle 렌더링에 사용할 정점 데이터 및 버퍼 객체 초기화
+  void initRenderData();
+
   // 가장 먼저 수명이 다해서 대기 상태에 있는 particle 탐색 -> 대기 상태에 있는 particle respawn 목적
   unsigned int firstUnusedParticle();
 
-  // 대기 상태에 있는 particle 를 재사용할 수 있도록 respawn
-  void respawnParticle(Particle &particle, GameObejct &object, glm::vec2 offset = glm::vec2(0.0f, 0.0f));
+  // 대기 상태에 있는 particle 를 재사용할 수 있도록 respawn (jitter, brightness 는 [0, 1) 범위 난수)
+  void respawnParticle(Particle &particle, glm::vec2 position, glm::vec2 velocity, glm::vec2 offset, float jitter, float brightness);
 };
 
 #endif /* PARTICLE_GENERATOR_HPP */
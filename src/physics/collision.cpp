@@ -0,0 +1,252 @@
+#include "collision.hpp"
+
+#include <cmath>
+#include <algorithm>
+
+// Swept Circle - AABB 충돌 검사에서 '이미 닿아 있음'으로 취급하는 표면과의 거리 (screen space pixel 단위)
+const float CONTACT_SKIN = 0.001f;
+
+// AABB - AABB 간 충돌 검사
+bool checkCollision(const TransformComponent &one, const TransformComponent &two)
+{
+  // 두 object 의 AABB 간 x축 방향 충돌 검사(= 수평 방향 overlap 검사)
+  bool collisionX = one.Position.x + one.Size.x >= two.Position.x &&
+                    two.Position.x + two.Size.x >= one.Position.x;
+
+  // 두 object 의 AABB 간 y축 방향 충돌 검사(= 수직 방향 overlap 검사)
+  bool collisionY = one.Position.y + one.Size.y >= two.Position.y &&
+                    two.Position.y + two.Size.y >= one.Position.y;
+
+  // x축, y축 방향 모두 충돌 시, 두 AABB 가 충돌한 것으로 판정
+  return collisionX && collisionY;
+};
+
+// Circle - AABB 간 충돌 검사 (docs/nodes.md 참고)
+Collision checkCollision(glm::vec2 center, float radius, const TransformComponent &two)
+{
+  // 두 번째 object 의 AABB 절반 크기 및 중점 계산 계산
+  glm::vec2 aabb_half_extents(two.Size.x / 2.0f, two.Size.y / 2.0f);
+  glm::vec2 aabb_center(
+      two.Position.x + aabb_half_extents.x,
+      two.Position.y + aabb_half_extents.y);
+
+  // Circle 과 AABB 중점 사이의 vector D 계산
+  glm::vec2 difference = center - aabb_center;
+
+  // [-aabb_half_extents, aabb_half_extents] 범위 내로 vector D clamping
+  glm::vec2 clamped = glm::clamp(difference, -aabb_half_extents, aabb_half_extents);
+
+  // AABB edges 와 clamp 된 vector D 가 교차하는 임의의 점 P 계산 -> circle 중점에서 가장 가까운 점 P
+  glm::vec2 closest = aabb_center + clamped;
+
+  // circle 중점 ~ 가장 가까운 점 P 사이의 거리 계산
+  difference = closest - center;
+
+  // 'circle 중점 ~ 가장 가까운 점 P 사이의 거리' 가 circle 반지름보다 작다면, Circle 과 AABB 가 충돌한 것으로 판정 (sqrt 를 생략하도록 제곱한 값끼리 비교)
+  if (glm::dot(difference, difference) < radius * radius)
+  {
+    // 더 자세한 충돌 정보를 사용자 정의 타입 Collision 으로 파싱하여 반환
+    return std::make_tuple(true, VectorDirection(difference), difference);
+  }
+  else
+  {
+    return std::make_tuple(false, UP, glm::vec2(0.0f, 0.0f));
+  }
+};
+
+// Circle - AABB 충돌 방향 계산
+Direction VectorDirection(glm::vec2 target)
+{
+  // 충돌 방향벡터 정의
+  glm::vec2 compass[] = {
+      glm::vec2(0.0f, 1.0f),  // up
+      glm::vec2(1.0f, 0.0f),  // right
+      glm::vec2(0.0f, -1.0f), // down
+      glm::vec2(-1.0f, 0.0f)  // left
+  };
+
+  float max = 0.0f;
+  unsigned int best_match = 0; // circle 중점이 AABB 내부에 있어서 target 이 영벡터인 경우 UP 으로 처리
+
+  /**
+   * 충돌 방향벡터를 순회하며 target 벡터와의 내적값이 가장 큰(= 가장 1에 가까운) 벡터
+   * (= 가장 방향이 비슷한 충돌 방향벡터)를 선택하여 best_match 에 갱신
+   *
+   * -> best_match 에 저장된 index 에 대응되는 Direction 타입으로 casting 후 반환
+   */
+  for (unsigned int i = 0; i < 4; i++)
+  {
+    float dot_product = glm::dot(glm::normalize(target), compass[i]);
+    if (dot_product > max)
+    {
+      max = dot_product;
+      best_match = i;
+    }
+  }
+  return (Direction)best_match;
+};
+
+void ResolveBallCollision(TransformComponent &ball, glm::vec2 &velocity, float radius, const Collision &collision)
+{
+  Direction dir = std::get<1>(collision);         // 충돌 방향
+  glm::vec2 diff_vector = std::get<2>(collision); // circle 중점 ~ 가장 가까운 점 P 사이의 거리
+
+  // 충돌 방향에 따른 충돌 처리
+  if (dir == LEFT || dir == RIGHT) // 수평 방향 충돌 처리
+  {
+    // 공의 수평 이동방향 뒤집기
+    velocity.x = -velocity.x;
+
+    // Circle - AABB 충돌 시, 수평 방향으로 AABB 내부로 침투한 거리(level of penetration) 계산
+    float penetration = radius - std::abs(diff_vector.x);
+
+    // 충돌 방향에 따라 반대 방향으로 침투 거리만큼 relocate -> 충돌한 공이 AABB 내부에 들어가지 못하도록 위치를 재조정한 것!
+    if (dir == LEFT)
+    {
+      ball.Position.x += penetration;
+    }
+    else
+    {
+      ball.Position.x -= penetration;
+    }
+  }
+  else // 수직 방향 충돌 처리
+  {
+    // 공의 수직 이동방향 뒤집기
+    velocity.y = -velocity.y;
+
+    // Circle - AABB 충돌 시, 수직 방향으로 AABB 내부로 침투한 거리(level of penetration) 계산
+    float penetration = radius - std::abs(diff_vector.y);
+
+    // 충돌 방향에 따라 반대 방향으로 침투 거리만큼 relocate -> 충돌한 공이 AABB 내부에 들어가지 못하도록 위치를 재조정한 것!
+    if (dir == UP)
+    {
+      ball.Position.y -= penetration;
+    }
+    else
+    {
+      ball.Position.y += penetration;
+    }
+  }
+};
+
+// Swept Circle - AABB 충돌 검사
+SweepHit SweepCircleAABB(glm::vec2 center, float radius, glm::vec2 motion, glm::vec2 boxMin, glm::vec2 boxMax)
+{
+  SweepHit result;
+  result.Hit = false;
+  result.Time = 1.0f;
+  result.Normal = glm::vec2(0.0f);
+
+  /**
+   * 시작 위치에서 이미 닿아 있거나 겹쳐 있는 경우 (직전 접촉 지점에 멈춰 있거나, 부동소수점 오차로 살짝 파고든 경우 등)
+   * -> 접촉 판정에 CONTACT_SKIN 만큼 여유를 두어, 표면에 맞닿은 채로 멀어지는 circle 이 다시 충돌로 판정되지 않도록 함.
+   */
+  glm::vec2 closest = glm::clamp(center, boxMin, boxMax);
+  glm::vec2 difference = center - closest;
+  float distanceSquared = glm::dot(difference, difference);
+  float contactRadius = radius + CONTACT_SKIN;
+  if (distanceSquared < contactRadius * contactRadius)
+  {
+    glm::vec2 normal;
+    if (distanceSquared > 0.0f)
+    {
+      normal = difference / std::sqrt(distanceSquared);
+    }
+    else
+    {
+      // circle 중점이 AABB 내부에 있으면 가장 가까운 면 방향을 법선으로 사용
+      float left = center.x - boxMin.x, right = boxMax.x - center.x;
+      float top = center.y - boxMin.y, bottom = boxMax.y - center.y;
+      float nearest = std::min(std::min(left, right), std::min(top, bottom));
+      normal = nearest == left ? glm::vec2(-1.0f, 0.0f) : nearest == right ? glm::vec2(1.0f, 0.0f)
+                                                        : nearest == top    ? glm::vec2(0.0f, -1.0f)
+                                                                            : glm::vec2(0.0f, 1.0f);
+    }
+    if (glm::dot(motion, normal) < 0.0f)
+    {
+      result.Hit = true;
+      result.Time = 0.0f;
+      result.Normal = normal;
+    }
+    return result;
+  }
+  if (motion.x == 0.0f && motion.y == 0.0f)
+  {
+    return result;
+  }
+
+  /**
+   * 반지름만큼 확장한 AABB 와 circle 중점 이동 경로(ray) 간 교차 검사 (slab method)
+   * -> circle 과 AABB 의 접촉은 'circle 중점이 AABB 를 반지름만큼 부풀린 모서리가 둥근 사각형에 닿는 것'과 같음.
+   * -> 먼저 모서리까지 각진 확장 AABB 로 진입 시점을 구하고, 진입 지점이 모서리 영역이면 아래에서 모서리 원과 다시 검사함.
+   */
+  glm::vec2 expandedMin = boxMin - glm::vec2(radius);
+  glm::vec2 expandedMax = boxMax + glm::vec2(radius);
+  float tEnter = -1.0f, tExit = 2.0f;
+  glm::vec2 normal(0.0f);
+  for (int axis = 0; axis < 2; axis++)
+  {
+    if (motion[axis] == 0.0f)
+    {
+      // 이 축으로 이동하지 않으면 시작 위치가 slab 안에 있어야만 교차 가능
+      if (center[axis] < expandedMin[axis] || center[axis] > expandedMax[axis])
+      {
+        return result;
+      }
+      continue;
+    }
+    float t1 = (expandedMin[axis] - center[axis]) / motion[axis];
+    float t2 = (expandedMax[axis] - center[axis]) / motion[axis];
+    if (t1 > t2)
+    {
+      std::swap(t1, t2);
+    }
+    if (t1 > tEnter)
+    {
+      // 가장 늦게 진입하는 slab 의 면이 실제 진입 면 -> 이동 방향의 반대쪽을 향하는 법선
+      tEnter = t1;
+      normal = glm::vec2(0.0f);
+      normal[axis] = motion[axis] > 0.0f ? -1.0f : 1.0f;
+    }
+    tExit = std::min(tExit, t2);
+  }
+  if (tEnter > tExit || tEnter > 1.0f || tExit <= 0.0f)
+  {
+    return result;
+  }
+  tEnter = std::max(tEnter, 0.0f);
+
+  glm::vec2 contact = center + motion * tEnter;
+  bool outsideX = contact.x < boxMin.x || contact.x > boxMax.x;
+  bool outsideY = contact.y < boxMin.y || contact.y > boxMax.y;
+  if (outsideX && outsideY)
+  {
+    /** 모서리 영역 진입 -> AABB 꼭짓점을 중심으로 하는 반지름 radius 원과 ray 의 교차 시점 계산 (2차 방정식의 작은 근) */
+    glm::vec2 corner(contact.x < boxMin.x ? boxMin.x : boxMax.x, contact.y < boxMin.y ? boxMin.y : boxMax.y);
+    glm::vec2 offset = center - corner;
+    float a = glm::dot(motion, motion);
+    float b = glm::dot(offset, motion);
+    float c = glm::dot(offset, offset) - radius * radius;
+    float discriminant = b * b - a * c;
+    if (discriminant < 0.0f)
+    {
+      // 모서리 원을 빗겨감 -> 인접한 면에도 닿지 않음
+      return result;
+    }
+    float t = (-b - std::sqrt(discriminant)) / a;
+    if (t < 0.0f || t > 1.0f)
+    {
+      return result;
+    }
+    result.Hit = true;
+    result.Time = t;
+    result.Normal = glm::normalize(center + motion * t - corner);
+    return result;
+  }
+
+  result.Hit = true;
+  result.Time = tEnter;
+  result.Normal = normal;
+  return result;
+}
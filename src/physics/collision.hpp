@@ -0,0 +1,58 @@
+#ifndef COLLISION_HPP
+#define COLLISION_HPP
+
+#include <tuple>
+
+#include <glm/glm.hpp>
+
+#include "../entity/components.hpp"
+
+/**
+ * 충돌 검사 함수 모음
+ *
+ * Game::DoCollisions() 에서 사용하는 충돌 검사 및 충돌 처리 함수들을 Game 클래스와 분리한 모듈.
+ * -> 렌더링, 오디오, 전역 게임 상태에 의존하지 않으므로 GL 컨텍스트 없이 벤치마크 등에서도 호출할 수 있음.
+ */
+
+// Circle - AABB 충돌 방향을 enum 으로 정의
+enum Direction
+{
+  UP,
+  RIGHT,
+  DOWN,
+  LEFT
+};
+
+// 충돌 정보를 std::tuple(n개의 데이터쌍) 컨테이너 사용자 정의 타입으로 정의
+typedef std::tuple<bool, Direction, glm::vec2> Collision; // <충돌 여부, 충돌 방향, circle 중점 ~ 가장 가까운 점 P 사이의 거리>
+
+// Swept Circle - AABB 충돌 검사 결과 (time of impact)
+struct SweepHit
+{
+  bool Hit;         // 이동 구간 안에서 충돌 여부
+  float Time;       // 최초 접촉 시점 -> 이동 구간 [0, 1] 에 대한 비율 (0 이면 시작 위치에서 이미 접촉)
+  glm::vec2 Normal; // 접촉 지점에서 AABB 바깥쪽을 향하는 단위 법선 벡터
+};
+
+// AABB - AABB 간 충돌 검사
+bool checkCollision(const TransformComponent &one, const TransformComponent &two);
+
+// Circle - AABB 간 충돌 검사 (center: circle 중점)
+Collision checkCollision(glm::vec2 center, float radius, const TransformComponent &two);
+
+// Circle - AABB 충돌 방향 계산
+Direction VectorDirection(glm::vec2 target);
+
+// Ball - Brick 충돌 시 충돌 방향에 따라 ball 이동방향을 뒤집고, brick 내부로 침투한 만큼 ball 위치 재조정 (collision resolution)
+void ResolveBallCollision(TransformComponent &ball, glm::vec2 &velocity, float radius, const Collision &collision);
+
+/**
+ * Swept Circle - AABB 충돌 검사 (continuous collision detection)
+ *
+ * 중점 center, 반지름 radius 인 circle 이 motion 만큼 이동하는 동안 [boxMin, boxMax] AABB 에 처음 닿는 시점과 법선 계산.
+ * -> 이동 후 위치의 overlap 만 검사하면 한 tick 이동거리가 brick 두께보다 긴 경우 brick 을 통과해버리므로(tunneling), 이동 경로 전체를 검사함.
+ * -> 시작 위치에서 이미 겹쳐 있으면, AABB 안쪽으로 이동하는 경우에만 Time = 0 으로 충돌 처리함. (밖으로 빠져나가는 중이면 무시)
+ */
+SweepHit SweepCircleAABB(glm::vec2 center, float radius, glm::vec2 motion, glm::vec2 boxMin, glm::vec2 boxMax);
+
+#endif /* COLLISION_HPP */
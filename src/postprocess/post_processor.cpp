@@ -1,30 +1,34 @@
 #include "post_processor.hpp"
+#include "../profiler/cpu_profiler.hpp"
+#include "../renderer/render_stats.hpp"
 #include <iostream>
 
 PostProcessor::PostProcessor(Shader shader, unsigned int width, unsigned int height)
     : PostProcessingShader(shader), Texture(), Width(width), Height(height), Confuse(false), Chaos(false), Shake(false)
 {
   /** framebuffer 및 renderbuffer 생성 */
-  glGenFramebuffers(1, &this->MSFBO);
-  glGenFramebuffers(1, &this->FBO);
-  glGenRenderbuffers(1, &this->RBO);
+  this->MSFBO = GLFramebuffer::Create();
+  this->FBO = GLFramebuffer::Create();
+  this->RBO = GLRenderbuffer::Create();
 
   /** multisampled 프레임버퍼 color buffer 로 사용할 renderbuffer attach */
   // (**MSAA 설정은 대부분의 그래픽 드라이버에 기본 활성화되어 있으므로, glEnable(GL_MULTISAMPLE) 중복 활성화 생략.)
-  glBindFramebuffer(GL_FRAMEBUFFER, this->MSFBO);
-  glBindRenderbuffer(GL_RENDERBUFFER, this->RBO);
+  glBindFramebuffer(GL_FRAMEBUFFER, this->MSFBO.Get());
+  glBindRenderbuffer(GL_RENDERBUFFER, this->RBO.Get());
   // multisampled buffer 를 지원하는 Renderbuffer 의 경우, glRenderbufferStorageMultisample() 함수를 이용해서 메모리 할당
   glRenderbufferStorageMultisample(GL_RENDERBUFFER, 4, GL_RGB, width, height);
-  glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, this->RBO);
+  // 할당된 renderbuffer 메모리 추정 크기 등록 (pixel 당 크기 * subsample 개수 -> 해상도에 비례하여 커짐)
+  this->RBO.Track(GPU_MEMORY_RENDERBUFFER, GpuMemoryTracker::EstimateTextureBytes(GL_RGB, width, height) * 4, "postprocess_msaa");
+  glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, this->RBO.Get());
   if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
   {
     std::cout << "ERROR::POSTPROCESSOR: Failed to initialize MSFBO" << std::endl;
   }
 
   /** intermediate 프레임버퍼 color buffer 로 사용할 texture attach */
-  glBindFramebuffer(GL_FRAMEBUFFER, this->FBO);
-  this->Texture.Generate(width, height, NULL);
-  glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, this->Texture.ID, 0);
+  glBindFramebuffer(GL_FRAMEBUFFER, this->FBO.Get());
+  this->Texture.Generate(width, height, NULL, "postprocess_color");
+  glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, this->Texture.ID(), 0);
   if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
   {
     std::cout << "ERROR::POSTPROCESSOR: Failed to initialize FBO" << std::endl;
@@ -78,18 +82,22 @@ PostProcessor::PostProcessor(Shader shader, unsigned int width, unsigned int hei
 
 void PostProcessor::BeginRender()
 {
+  PROFILE_SCOPE("PostProcessor::BeginRender");
+
   // scene 요소를 렌더링할 multisampled 프레임버퍼 바인딩 및 초기화
-  glBindFramebuffer(GL_FRAMEBUFFER, this->MSFBO);
+  glBindFramebuffer(GL_FRAMEBUFFER, this->MSFBO.Get());
   glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
   glClear(GL_COLOR_BUFFER_BIT);
 };
 
 void PostProcessor::EndRender()
 {
+  PROFILE_SCOPE("PostProcessor::EndRender");
+
   // multisampled 프레임버퍼에 렌더링된 결과를 intermediate 프레임버퍼에 blit 으로 복사
   // (**multisampled 프레임버퍼 blit 관련 하단 필기 참고)
-  glBindFramebuffer(GL_READ_FRAMEBUFFER, this->MSFBO);
-  glBindFramebuffer(GL_DRAW_FRAMEBUFFER, this->FBO);
+  glBindFramebuffer(GL_READ_FRAMEBUFFER, this->MSFBO.Get());
+  glBindFramebuffer(GL_DRAW_FRAMEBUFFER, this->FBO.Get());
   glBlitFramebuffer(0, 0, this->Width, this->Height, 0, 0, this->Width, this->Height, GL_COLOR_BUFFER_BIT, GL_NEAREST);
 
   // blit 을 마친 후 기본 프레임버퍼로 바인딩 원상복구
@@ -98,6 +106,8 @@ void PostProcessor::EndRender()
 
 void PostProcessor::Render(float time)
 {
+  PROFILE_SCOPE("PostProcessor::Render");
+
   // post processing 쉐이더 바인딩 및 uniform 변수들 전송
   this->PostProcessingShader.Use();
   this->PostProcessingShader.SetFloat("time", time);
@@ -108,11 +118,13 @@ void PostProcessor::Render(float time)
   // scene 요소가 렌더링된 텍스쳐를 0번 texture unit 활성화 후 바인딩
   glActiveTexture(GL_TEXTURE0);
   this->Texture.Bind();
+  RenderStats::CountTextureBind();
 
   // screen-size 2D Quad 정점 버퍼 객체 바인딩 후 draw call
-  glBindVertexArray(this->VAO);
+  glBindVertexArray(this->VAO.Get());
   glDrawArrays(GL_TRIANGLES, 0, 6);
   glBindVertexArray(0);
+  RenderStats::CountDrawCall();
 };
 
 void PostProcessor::initRenderData()
@@ -120,8 +132,7 @@ void PostProcessor::initRenderData()
   /**
    * screen-size 2D Quad 렌더링 시 사용할 VBO, VAO 객체 생성 및 바인딩
    */
-  // 실제 정점 데이터 바인딩 시, VAO 객체만 바인딩하면 되므로, VBO ID 값은 멤버변수로 들고있지 않아도 됨.
-  unsigned int VBO;
+  // 실제 정점 데이터 바인딩 시에는 VAO 객체만 바인딩하면 되지만, VBO 객체도 반납해야 하므로 멤버변수로 소유함.
   // screen quad 는 screen 크기와 같아야 하므로, clip space 좌표계의 최솟값, 최댓값인 -1.0, 1.0 로 정점 좌표값 정의
   float vertices[] = {
       // pos        // tex
@@ -133,14 +144,15 @@ void PostProcessor::initRenderData()
       1.0f, -1.0f, 1.0f, 0.0f,
       1.0f, 1.0f, 1.0f, 1.0f};
 
-  glGenVertexArrays(1, &this->VAO);
-  glGenBuffers(1, &VBO);
+  this->VAO = GLVertexArray::Create();
+  this->VBO = GLBuffer::Create();
 
-  glBindVertexArray(this->VAO);
+  glBindVertexArray(this->VAO.Get());
 
   // 2D Quad 정점 데이터를 VBO 객체에 write
-  glBindBuffer(GL_ARRAY_BUFFER, VBO);
+  glBindBuffer(GL_ARRAY_BUFFER, this->VBO.Get());
   glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+  this->VBO.Track(GPU_MEMORY_VERTEX_BUFFER, sizeof(vertices), "postprocess_quad");
 
   // 2D Quad 의 pos, uv 데이터가 vec4 로 묶인 0번 attribute 변수 활성화 및 데이터 해석 방식 정의
   glEnableVertexAttribArray(0);
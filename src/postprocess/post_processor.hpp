@@ -6,6 +6,7 @@
 
 #include "../utils/texture.hpp"
 #include "../utils/shader.hpp"
+#include "../utils/gl_object.hpp"
 #include "../renderer/sprite_renderer.hpp"
 
 /**
@@ -34,9 +35,10 @@ public:
   void Render(float time);
 
 private:
-  unsigned int MSFBO, FBO; // multisampled 프레임버퍼, intermediate 프레임버퍼 id (MSFBO -> FBO 로 blit 하여 렌더링 결과 복사)
-  unsigned int RBO;        // multisampled 프레임버퍼의 color attachment 로 사용할 renderbuffer (하단 필기 참고)
-  unsigned int VAO;        // 2D Quad 정점 데이터가 기록된 버퍼 객체들이 바인딩된 VAO 객체 id
+  GLFramebuffer MSFBO, FBO; // multisampled 프레임버퍼, intermediate 프레임버퍼 (MSFBO -> FBO 로 blit 하여 렌더링 결과 복사)
+  GLRenderbuffer RBO;       // multisampled 프레임버퍼의 color attachment 로 사용할 renderbuffer (하단 필기 참고)
+  GLVertexArray VAO;        // 2D Quad 정점 데이터가 기록된 버퍼 객체들이 바인딩된 VAO 객체
+  GLBuffer VBO;             // 2D Quad 정점 데이터가 기록된 VBO 객체
 
   // 2D Quad 정점 데이터 저장 및 VBO, VAO 객체 설정
   void initRenderData();
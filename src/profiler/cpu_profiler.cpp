@@ -0,0 +1,245 @@
+#include "cpu_profiler.hpp"
+
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <chrono>
+#include <algorithm>
+
+const unsigned int CpuProfiler::EVENTS_PER_THREAD;
+const unsigned int CpuProfiler::FRAME_HISTORY;
+const unsigned int CpuProfiler::MAX_THREADS;
+std::atomic<bool> CpuProfiler::enabled(true);
+
+// 스레드 하나가 기록하는 zone ring buffer
+struct ThreadBuffer
+{
+  std::mutex Mutex; // 기록(소유 스레드)과 내보내기(호출 스레드) 사이의 동기화 (평소에는 경합 없음)
+  std::vector<CpuProfileEvent> Events;
+  unsigned long long Head; // 지금까지 기록된 zone 개수 (Head % EVENTS_PER_THREAD 위치에 다음 zone 기록)
+  unsigned int Tid;
+  std::string Name;
+  bool InUse; // 소유 스레드가 아직 실행 중인지 여부 (registryMutex 로 보호, false 이면 다른 스레드가 재사용 가능)
+};
+
+// 스레드별 buffer 목록 (최대 MAX_THREADS 개)
+// -> 종료된 스레드의 buffer 는 다른 스레드가 재사용하기 전까지 남아있으므로, 그 동안은 기록을 내보낼 수 있음
+static std::mutex registryMutex;
+static std::vector<std::unique_ptr<ThreadBuffer>> threadBuffers;
+static unsigned int nextTid = 1;
+
+// 현재 스레드의 buffer 및 이름 (스레드 종료 시 buffer 를 반납)
+struct ThreadBufferOwner
+{
+  ThreadBuffer *Buffer;
+  std::string Name;
+
+  ThreadBufferOwner() : Buffer(nullptr) {};
+  ~ThreadBufferOwner()
+  {
+    if (this->Buffer != nullptr)
+    {
+      std::lock_guard<std::mutex> lock(registryMutex);
+      this->Buffer->InUse = false;
+    }
+  };
+};
+static thread_local ThreadBufferOwner currentThread;
+
+// 프레임 경계 시간 ring buffer
+static std::mutex frameMutex;
+static unsigned long long frameStarts[CpuProfiler::FRAME_HISTORY];
+static unsigned long long frameCount = 0;
+
+// 모든 timestamp 의 기준 시점
+static const std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+
+// 현재 스레드의 buffer 반환 (처음 호출한 스레드는 종료된 스레드의 buffer 를 재사용하거나 새로 생성, MAX_THREADS 개를 모두 사용 중이면 nullptr)
+static ThreadBuffer *threadBuffer()
+{
+  ThreadBufferOwner &owner = currentThread;
+  if (owner.Buffer != nullptr)
+  {
+    return owner.Buffer;
+  }
+
+  std::lock_guard<std::mutex> registryLock(registryMutex);
+  ThreadBuffer *buffer = nullptr;
+  for (const std::unique_ptr<ThreadBuffer> &candidate : threadBuffers)
+  {
+    if (!candidate->InUse)
+    {
+      buffer = candidate.get();
+      break;
+    }
+  }
+  if (buffer == nullptr)
+  {
+    if (threadBuffers.size() >= CpuProfiler::MAX_THREADS)
+    {
+      return nullptr;
+    }
+    threadBuffers.push_back(std::unique_ptr<ThreadBuffer>(new ThreadBuffer()));
+    buffer = threadBuffers.back().get();
+    buffer->Events.resize(CpuProfiler::EVENTS_PER_THREAD);
+  }
+
+  // 재사용하는 buffer 는 이전 스레드의 기록을 버리고 새 tid 로 시작 (Events 메모리는 그대로 재사용)
+  std::lock_guard<std::mutex> lock(buffer->Mutex);
+  buffer->Head = 0;
+  buffer->Tid = nextTid++;
+  buffer->Name = owner.Name.empty() ? "thread " + std::to_string(buffer->Tid) : owner.Name;
+  buffer->InUse = true;
+  owner.Buffer = buffer;
+  return buffer;
+}
+
+// JSON 문자열 값으로 출력하기 위해 따옴표, 역슬래시, 제어문자 escape
+static void writeJsonString(std::ostream &out, const char *str)
+{
+  out << '"';
+  for (const char *c = str; *c != '\0'; c++)
+  {
+    if (*c == '"' || *c == '\\')
+    {
+      out << '\\' << *c;
+    }
+    else if (static_cast<unsigned char>(*c) < 0x20)
+    {
+      out << ' ';
+    }
+    else
+    {
+      out << *c;
+    }
+  }
+  out << '"';
+}
+
+void CpuProfiler::SetEnabled(bool enable)
+{
+  enabled.store(enable, std::memory_order_relaxed);
+};
+
+unsigned long long CpuProfiler::Now()
+{
+  return static_cast<unsigned long long>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - epoch).count());
+};
+
+void CpuProfiler::Record(const char *name, unsigned long long startNs, unsigned long long endNs)
+{
+  ThreadBuffer *buffer = threadBuffer();
+  if (buffer == nullptr)
+  {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(buffer->Mutex);
+  CpuProfileEvent &event = buffer->Events[buffer->Head % EVENTS_PER_THREAD];
+  event.Name = name;
+  event.StartNs = startNs;
+  event.EndNs = endNs;
+  buffer->Head++;
+};
+
+void CpuProfiler::SetThreadName(const std::string &name)
+{
+  // 아직 buffer 가 없는 스레드는 이름만 보관 (비활성화 상태에서 이름만 지정한 스레드가 buffer 를 할당하지 않도록)
+  ThreadBufferOwner &owner = currentThread;
+  owner.Name = name;
+  if (owner.Buffer != nullptr)
+  {
+    std::lock_guard<std::mutex> lock(owner.Buffer->Mutex);
+    owner.Buffer->Name = name;
+  }
+};
+
+void CpuProfiler::MarkFrame()
+{
+  unsigned long long now = Now();
+  std::lock_guard<std::mutex> lock(frameMutex);
+  frameStarts[frameCount % FRAME_HISTORY] = now;
+  frameCount++;
+};
+
+unsigned long long CpuProfiler::FrameCount()
+{
+  std::lock_guard<std::mutex> lock(frameMutex);
+  return frameCount;
+};
+
+void CpuProfiler::WriteChromeTrace(std::ostream &out, unsigned int frames)
+{
+  // 최근 frames 개 프레임 경계 중 가장 오래된 시점 이후의 zone 들만 내보냄 (프레임 기록이 없으면 buffer 전체)
+  unsigned long long from = 0;
+  {
+    std::lock_guard<std::mutex> lock(frameMutex);
+    unsigned long long count = std::min<unsigned long long>(frames, std::min<unsigned long long>(frameCount, FRAME_HISTORY));
+    if (count > 0)
+    {
+      from = frameStarts[(frameCount - count) % FRAME_HISTORY];
+    }
+  }
+
+  out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+  bool first = true;
+  out << std::fixed << std::setprecision(3);
+
+  std::lock_guard<std::mutex> registryLock(registryMutex);
+  for (const std::unique_ptr<ThreadBuffer> &buffer : threadBuffers)
+  {
+    // buffer 를 잠근 시간을 최소화하기 위해 필요한 zone 만 복사한 후 출력
+    std::vector<CpuProfileEvent> events;
+    std::string threadName;
+    {
+      std::lock_guard<std::mutex> lock(buffer->Mutex);
+      unsigned long long count = std::min<unsigned long long>(buffer->Head, EVENTS_PER_THREAD);
+      events.reserve(static_cast<std::size_t>(count));
+      for (unsigned long long i = buffer->Head - count; i < buffer->Head; i++)
+      {
+        const CpuProfileEvent &event = buffer->Events[i % EVENTS_PER_THREAD];
+        if (event.StartNs >= from)
+        {
+          events.push_back(event);
+        }
+      }
+      threadName = buffer->Name;
+    }
+
+    // trace viewer 에 표시할 스레드 이름 metadata event
+    out << (first ? "" : ",") << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->Tid << ",\"args\":{\"name\":";
+    writeJsonString(out, threadName.c_str());
+    out << "}}";
+    first = false;
+
+    // zone 은 종료 시점 순서로 기록되므로, viewer 가 중첩 관계를 올바르게 구성하도록 시작 시점 순서로 정렬
+    // (시작 시점이 같으면 더 오래 지속된 바깥쪽 zone 을 먼저 출력)
+    std::sort(events.begin(), events.end(), [](const CpuProfileEvent &a, const CpuProfileEvent &b)
+              { return a.StartNs != b.StartNs ? a.StartNs < b.StartNs : a.EndNs > b.EndNs; });
+    for (const CpuProfileEvent &event : events)
+    {
+      // complete event("X") 의 ts, dur 는 us 단위
+      out << ",\n{\"name\":";
+      writeJsonString(out, event.Name);
+      out << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->Tid
+          << ",\"ts\":" << event.StartNs / 1000.0 << ",\"dur\":" << (event.EndNs - event.StartNs) / 1000.0 << "}";
+    }
+  }
+  out << "\n]}" << std::defaultfloat << std::endl;
+};
+
+bool CpuProfiler::WriteChromeTrace(const std::string &path, unsigned int frames)
+{
+  std::ofstream file(path.c_str());
+  if (!file)
+  {
+    std::cout << "ERROR::CPU_PROFILER: Failed to open trace file " << path << std::endl;
+    return false;
+  }
+  WriteChromeTrace(file, frames);
+  std::cout << "CPU_PROFILER: Wrote last " << frames << " frame(s) to " << path << std::endl;
+  return true;
+};
@@ -0,0 +1,102 @@
+#ifndef CPU_PROFILER_HPP
+#define CPU_PROFILER_HPP
+
+#include <string>
+#include <ostream>
+#include <atomic>
+
+// 측정된 timing zone 하나 (시간은 CpuProfiler 시작 시점 기준 ns 단위)
+struct CpuProfileEvent
+{
+  const char *Name; // 문자열 리터럴만 사용 (포인터만 저장하므로 zone 이 끝난 뒤에도 유효해야 함)
+  unsigned long long StartNs;
+  unsigned long long EndNs;
+};
+
+/**
+ * CpuProfiler 클래스
+ *
+ * PROFILE_SCOPE() 매크로로 지정한 timing zone 들을 스레드별 ring buffer 에 기록하는 singleton 클래스.
+ * -> 각 스레드는 자신의 buffer 에만 기록하므로 스레드 간 경합이 거의 없고,
+ *    buffer 가 가득 차면 가장 오래된 zone 부터 덮어쓰므로 메모리 사용량이 일정함.
+ * -> buffer 는 활성화 상태에서 처음 zone 을 기록할 때 할당하고, 스레드가 종료되면 다음에 생성되는 스레드가 재사용함.
+ *    (buffer 개수는 MAX_THREADS 로 제한되므로, 스레드를 반복해서 생성 / 종료하는 프로그램에서도 메모리 사용량이 늘어나지 않음)
+ * -> MarkFrame() 으로 기록한 프레임 경계를 기준으로 최근 N 프레임의 zone 들을
+ *    Chrome trace-event JSON 으로 내보낼 수 있음. (chrome://tracing 또는 https://ui.perfetto.dev 에서 확인)
+ *
+ * BREAKOUT_PROFILE 이 정의되지 않은 빌드에서는 PROFILE_SCOPE() 가 아무 코드도 생성하지 않으며,
+ * 정의된 빌드에서도 SetEnabled(false) 상태에서는 zone 당 atomic load 한 번의 비용만 발생함.
+ */
+class CpuProfiler
+{
+public:
+  // 스레드별 ring buffer 에 보관할 최대 zone 개수 및 프레임 경계 기록 개수
+  static const unsigned int EVENTS_PER_THREAD = 1 << 16;
+  static const unsigned int FRAME_HISTORY = 1024;
+
+  // 동시에 buffer 를 가질 수 있는 최대 스레드 개수 (초과한 스레드의 zone 은 기록하지 않음)
+  static const unsigned int MAX_THREADS = 64;
+
+  static void SetEnabled(bool enable);
+  static bool IsEnabled() { return enabled.load(std::memory_order_relaxed); };
+
+  // 프로파일러 시작 시점 기준 현재 시간 (ns)
+  static unsigned long long Now();
+
+  // 현재 스레드의 ring buffer 에 zone 기록 (CpuProfileScope 소멸 시 호출)
+  static void Record(const char *name, unsigned long long startNs, unsigned long long endNs);
+
+  // trace 에 표시할 현재 스레드 이름 지정 (buffer 를 할당하지 않고 이름만 보관했다가, 처음 zone 을 기록할 때 적용)
+  static void SetThreadName(const std::string &name);
+
+  // 프레임 경계 기록 (렌더링 루프에서 매 프레임 한 번 호출)
+  static void MarkFrame();
+  static unsigned long long FrameCount();
+
+  // 최근 frames 프레임 동안 기록된 zone 들을 Chrome trace-event JSON 으로 출력 (파일 출력 실패 시 false 반환)
+  static void WriteChromeTrace(std::ostream &out, unsigned int frames);
+  static bool WriteChromeTrace(const std::string &path, unsigned int frames);
+
+private:
+  static std::atomic<bool> enabled;
+
+  // singleton 클래스는 인스턴스 생성이 불필요하므로, 생성자 함수 캡슐화
+  CpuProfiler() {};
+};
+
+/**
+ * CpuProfileScope 클래스
+ *
+ * 생성 시점부터 소멸 시점까지를 하나의 zone 으로 기록하는 RAII 클래스 (PROFILE_SCOPE() 매크로로 사용)
+ */
+class CpuProfileScope
+{
+public:
+  explicit CpuProfileScope(const char *name) : name(name), active(CpuProfiler::IsEnabled()), start(active ? CpuProfiler::Now() : 0) {};
+  ~CpuProfileScope()
+  {
+    if (this->active)
+    {
+      CpuProfiler::Record(this->name, this->start, CpuProfiler::Now());
+    }
+  };
+
+  CpuProfileScope(const CpuProfileScope &) = delete;
+  CpuProfileScope &operator=(const CpuProfileScope &) = delete;
+
+private:
+  const char *name;
+  bool active;
+  unsigned long long start;
+};
+
+// 현재 scope 를 이름 붙은 zone 으로 측정하는 매크로 (name 은 문자열 리터럴)
+#ifdef BREAKOUT_PROFILE
+#define PROFILE_CONCAT_IMPL(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_IMPL(a, b)
+#define PROFILE_SCOPE(name) CpuProfileScope PROFILE_CONCAT(profileScope, __LINE__)(name)
+#else
+#define PROFILE_SCOPE(name) ((void)0)
+#endif
+
+#endif /* CPU_PROFILER_HPP */
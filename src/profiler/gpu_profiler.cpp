@@ -0,0 +1,294 @@
+#include "gpu_profiler.hpp"
+
+#include <iostream>
+#include <iomanip>
+#include <cstring>
+#include <utility>
+
+#include <glad/glad.h>
+
+const unsigned int GpuProfiler::QUERY_LATENCY;
+const unsigned int GpuProfiler::HISTORY_SIZE;
+std::vector<GpuProfiler::Pass> GpuProfiler::passes;
+int GpuProfiler::activePass = -1;
+unsigned long long GpuProfiler::frameIndex = 0;
+bool GpuProfiler::supported = false;
+bool GpuProfiler::enabled = false;
+bool GpuProfiler::inFrame = false;
+unsigned int GpuProfiler::logInterval = 0;
+
+bool GpuProfiler::Init()
+{
+  // GL_TIME_ELAPSED query 는 OpenGL 3.3 core 에 포함되어 있지만, 일부 구현은 counter bit 수를 0 으로 보고하여 측정을 지원하지 않음.
+  // (Mesa llvmpipe 등 software rasterizer 도 64 bit counter 를 지원하므로 CI 환경에서도 동작함.)
+  supported = false;
+  if (GLAD_GL_VERSION_3_3)
+  {
+    int bits = 0;
+    glGetQueryiv(GL_TIME_ELAPSED, GL_QUERY_COUNTER_BITS, &bits);
+    supported = bits > 0;
+  }
+
+  if (!supported)
+  {
+    std::cout << "WARNING::GPU_PROFILER: GL_TIME_ELAPSED queries are not supported, GPU profiling is disabled" << std::endl;
+    enabled = false;
+  }
+  return supported;
+};
+
+void GpuProfiler::Release()
+{
+  // Pass 가 소유한 GLQuery 들이 컨테이너에서 제거되면서 query 객체가 반납됨.
+  passes.clear();
+  activePass = -1;
+  inFrame = false;
+};
+
+bool GpuProfiler::IsSupported()
+{
+  return supported;
+};
+
+bool GpuProfiler::IsEnabled()
+{
+  return enabled;
+};
+
+void GpuProfiler::SetEnabled(bool enable)
+{
+  if (enable && !supported)
+  {
+    return;
+  }
+
+  // 측정 중인 pass 가 있다면 먼저 닫아서 query 가 열린 채로 남지 않도록 함.
+  if (!enable && activePass >= 0)
+  {
+    EndPass();
+  }
+
+  // 다시 활성화하는 경우, 비활성화 이전에 발행된 오래된 결과가 통계에 섞이지 않도록 pending 상태 초기화
+  if (enable && !enabled)
+  {
+    for (Pass &pass : passes)
+    {
+      for (unsigned int i = 0; i < QUERY_LATENCY; i++)
+      {
+        pass.Pending[i] = false;
+      }
+    }
+  }
+  enabled = enable;
+};
+
+void GpuProfiler::SetLogInterval(unsigned int frames)
+{
+  logInterval = frames;
+};
+
+void GpuProfiler::BeginFrame()
+{
+  if (!enabled)
+  {
+    return;
+  }
+  inFrame = true;
+
+  // 이번 프레임에 재사용할 query 슬롯에 QUERY_LATENCY 프레임 전 발행된 결과가 남아있다면 먼저 수집
+  unsigned int slot = static_cast<unsigned int>(frameIndex % QUERY_LATENCY);
+  for (Pass &pass : passes)
+  {
+    collect(pass, slot);
+  }
+};
+
+void GpuProfiler::EndFrame()
+{
+  if (!inFrame)
+  {
+    return;
+  }
+
+  if (activePass >= 0)
+  {
+    EndPass();
+  }
+  inFrame = false;
+  frameIndex++;
+
+  if (logInterval > 0 && frameIndex % logInterval == 0)
+  {
+    Log(std::cout);
+  }
+};
+
+void GpuProfiler::BeginPass(const char *name)
+{
+  if (!inFrame)
+  {
+    return;
+  }
+
+  // GL_TIME_ELAPSED query 는 중첩할 수 없으므로 열려있는 pass 를 먼저 닫음
+  if (activePass >= 0)
+  {
+    EndPass();
+  }
+
+  int index = findPass(name);
+  if (index < 0)
+  {
+    // 처음 측정하는 pass 는 query 객체를 생성하여 등록
+    Pass pass;
+    pass.Name = name;
+    for (unsigned int i = 0; i < QUERY_LATENCY; i++)
+    {
+      pass.Queries[i] = GLQuery::Create();
+      pass.Pending[i] = false;
+    }
+    pass.LastFrame = ~0ull;
+    pass.HistoryCount = 0;
+    pass.HistoryNext = 0;
+    pass.Dropped = 0;
+    passes.push_back(std::move(pass));
+    index = static_cast<int>(passes.size()) - 1;
+  }
+
+  // 같은 pass 를 한 프레임에 두 번 측정하면 이전 query 를 덮어쓰게 되므로 무시
+  Pass &pass = passes[index];
+  if (pass.LastFrame == frameIndex)
+  {
+    return;
+  }
+
+  unsigned int slot = static_cast<unsigned int>(frameIndex % QUERY_LATENCY);
+  glBeginQuery(GL_TIME_ELAPSED, pass.Queries[slot].Get());
+  pass.Pending[slot] = true;
+  pass.LastFrame = frameIndex;
+  activePass = index;
+};
+
+void GpuProfiler::EndPass()
+{
+  if (activePass < 0)
+  {
+    return;
+  }
+  glEndQuery(GL_TIME_ELAPSED);
+  activePass = -1;
+};
+
+bool GpuProfiler::GetStats(const std::string &name, GpuPassStats &stats)
+{
+  int index = findPass(name.c_str());
+  if (index < 0)
+  {
+    return false;
+  }
+  stats = computeStats(passes[index]);
+  return true;
+};
+
+std::vector<GpuPassStats> GpuProfiler::Stats()
+{
+  std::vector<GpuPassStats> stats;
+  stats.reserve(passes.size());
+  for (const Pass &pass : passes)
+  {
+    stats.push_back(computeStats(pass));
+  }
+  return stats;
+};
+
+float GpuProfiler::TotalAverageMs()
+{
+  float total = 0.0f;
+  for (const Pass &pass : passes)
+  {
+    total += computeStats(pass).AverageMs;
+  }
+  return total;
+};
+
+void GpuProfiler::Log(std::ostream &out)
+{
+  out << std::fixed << std::setprecision(3) << "GPU:";
+  for (const Pass &pass : passes)
+  {
+    GpuPassStats stats = computeStats(pass);
+    out << " " << stats.Name << " " << stats.AverageMs << "ms [" << stats.MinMs << "-" << stats.MaxMs << "]";
+    if (stats.Dropped > 0)
+    {
+      out << " (" << stats.Dropped << " dropped)";
+    }
+    out << " |";
+  }
+  out << " total " << TotalAverageMs() << "ms" << std::defaultfloat << std::endl;
+};
+
+int GpuProfiler::findPass(const char *name)
+{
+  // pass 개수가 적으므로 선형 검색 (대부분 같은 문자열 리터럴로 호출되므로 포인터 비교를 먼저 수행)
+  for (std::size_t i = 0; i < passes.size(); i++)
+  {
+    if (passes[i].Name.c_str() == name || std::strcmp(passes[i].Name.c_str(), name) == 0)
+    {
+      return static_cast<int>(i);
+    }
+  }
+  return -1;
+};
+
+void GpuProfiler::collect(Pass &pass, unsigned int slot)
+{
+  if (!pass.Pending[slot])
+  {
+    return;
+  }
+  pass.Pending[slot] = false;
+
+  // 결과가 아직 준비되지 않았다면 기다리지 않고 sample 을 버림 (GPU 가 QUERY_LATENCY 프레임 이상 밀려있는 경우)
+  int available = 0;
+  glGetQueryObjectiv(pass.Queries[slot].Get(), GL_QUERY_RESULT_AVAILABLE, &available);
+  if (!available)
+  {
+    pass.Dropped++;
+    return;
+  }
+
+  GLuint64 elapsed = 0;
+  glGetQueryObjectui64v(pass.Queries[slot].Get(), GL_QUERY_RESULT, &elapsed);
+  pass.History[pass.HistoryNext] = static_cast<float>(elapsed / 1.0e6);
+  pass.HistoryNext = (pass.HistoryNext + 1) % HISTORY_SIZE;
+  if (pass.HistoryCount < HISTORY_SIZE)
+  {
+    pass.HistoryCount++;
+  }
+};
+
+GpuPassStats GpuProfiler::computeStats(const Pass &pass)
+{
+  GpuPassStats stats;
+  stats.Name = pass.Name;
+  stats.Samples = pass.HistoryCount;
+  stats.Dropped = pass.Dropped;
+  stats.LastMs = stats.AverageMs = stats.MinMs = stats.MaxMs = 0.0f;
+  if (pass.HistoryCount == 0)
+  {
+    return stats;
+  }
+
+  stats.LastMs = pass.History[(pass.HistoryNext + HISTORY_SIZE - 1) % HISTORY_SIZE];
+  stats.MinMs = stats.MaxMs = pass.History[0];
+  float sum = 0.0f;
+  for (unsigned int i = 0; i < pass.HistoryCount; i++)
+  {
+    float ms = pass.History[i];
+    sum += ms;
+    stats.MinMs = ms < stats.MinMs ? ms : stats.MinMs;
+    stats.MaxMs = ms > stats.MaxMs ? ms : stats.MaxMs;
+  }
+  stats.AverageMs = sum / pass.HistoryCount;
+  return stats;
+};
@@ -0,0 +1,99 @@
+#ifndef GPU_PROFILER_HPP
+#define GPU_PROFILER_HPP
+
+#include <string>
+#include <vector>
+#include <ostream>
+
+#include "../utils/gl_object.hpp"
+
+// 이름 붙은 render pass 하나의 GPU 시간 통계 (최근 GpuProfiler::HISTORY_SIZE 개 sample 기준, ms 단위)
+struct GpuPassStats
+{
+  std::string Name;
+  float LastMs;
+  float AverageMs;
+  float MinMs;
+  float MaxMs;
+  unsigned int Samples; // 통계에 사용된 sample 개수
+  unsigned int Dropped; // readback 시점까지 결과가 준비되지 않아 버려진 sample 개수 (누적)
+};
+
+/**
+ * GpuProfiler 클래스
+ *
+ * GL_TIME_ELAPSED timer query 로 render pass 별 GPU 시간을 측정하는 singleton 클래스.
+ *
+ * 각 pass 마다 QUERY_LATENCY 개의 query 객체를 돌려쓰면서, 결과는 QUERY_LATENCY 프레임 뒤에 같은 query 를
+ * 재사용하기 직전에 읽어옴. -> 결과가 준비되었는지(GL_QUERY_RESULT_AVAILABLE)만 확인하고 기다리지 않으므로,
+ * CPU 가 GPU 작업 완료를 기다리며 파이프라인이 멈추는(stall) 일이 없음.
+ *
+ * GL_TIME_ELAPSED query 는 중첩될 수 없으므로 pass 는 순차적으로만 측정하며(BeginPass() 는 열려있는 pass 를 먼저 닫음),
+ * 같은 이름의 pass 는 한 프레임에 한 번만 측정함.
+ */
+class GpuProfiler
+{
+public:
+  // query 발행 후 결과를 읽기까지의 프레임 수 (= pass 당 query 객체 개수)
+  static const unsigned int QUERY_LATENCY = 4;
+  // 평균/최소/최대 계산에 사용할 최근 sample 개수
+  static const unsigned int HISTORY_SIZE = 120;
+
+  // timer query 지원 여부 확인 (GL 컨텍스트 생성 이후 호출) 및 query 객체 반납 (GL 컨텍스트 종료 이전 호출)
+  static bool Init();
+  static void Release();
+
+  static bool IsSupported();
+  static bool IsEnabled();
+  // 측정 활성화 여부 설정 (비활성화 상태에서는 모든 Begin/End 호출이 즉시 반환됨)
+  static void SetEnabled(bool enabled);
+  // frames 프레임마다 pass 별 통계를 로그로 출력 (0 이면 출력하지 않음)
+  static void SetLogInterval(unsigned int frames);
+
+  // 프레임 단위 측정 시작/종료 -> 렌더링 루프에서 Render() 호출 전후로 호출
+  static void BeginFrame();
+  static void EndFrame();
+
+  // 이름 붙은 render pass 측정 시작/종료
+  static void BeginPass(const char *name);
+  static void EndPass();
+
+  // pass 별 통계 조회 (GetStats() 는 해당 이름의 pass 가 아직 없으면 false 반환)
+  static bool GetStats(const std::string &name, GpuPassStats &stats);
+  static std::vector<GpuPassStats> Stats();
+  // 모든 pass 평균 시간의 합 (ms)
+  static float TotalAverageMs();
+
+  // pass 별 통계를 한 줄로 출력
+  static void Log(std::ostream &out);
+
+private:
+  // 측정 대상 render pass
+  struct Pass
+  {
+    std::string Name;
+    GLQuery Queries[QUERY_LATENCY];
+    bool Pending[QUERY_LATENCY]; // 결과를 아직 읽지 않은 query 여부
+    unsigned long long LastFrame; // 마지막으로 측정한 프레임 번호 (한 프레임 중복 측정 방지)
+
+    float History[HISTORY_SIZE]; // 최근 sample 들을 저장하는 ring buffer (ms)
+    unsigned int HistoryCount;
+    unsigned int HistoryNext;
+    unsigned int Dropped;
+  };
+
+  static std::vector<Pass> passes;
+  static int activePass; // 현재 측정 중인 pass index (-1 이면 없음)
+  static unsigned long long frameIndex;
+  static bool supported, enabled, inFrame;
+  static unsigned int logInterval;
+
+  // singleton 클래스는 인스턴스 생성이 불필요하므로, 생성자 함수 캡슐화
+  GpuProfiler() {};
+
+  static int findPass(const char *name);
+  static void collect(Pass &pass, unsigned int slot);
+  static GpuPassStats computeStats(const Pass &pass);
+};
+
+#endif /* GPU_PROFILER_HPP */
@@ -0,0 +1,121 @@
+#include "performance_overlay.hpp"
+#include "gpu_profiler.hpp"
+#include "../renderer/render_stats.hpp"
+
+#include <sstream>
+#include <iomanip>
+#include <vector>
+#include <algorithm>
+
+const unsigned int PerformanceOverlay::HISTORY_SIZE;
+
+// overlay 레이아웃 상수 (px)
+static const float OVERLAY_PADDING = 5.0f;
+static const float OVERLAY_TEXT_SCALE = 0.5f;
+static const float GRAPH_HEIGHT = 50.0f;
+// 그래프 최대 높이에 대응하는 frame-time (30fps) 및 기준선으로 표시할 목표 frame-time (60fps)
+static const float GRAPH_MAX_MS = 1000.0f / 30.0f;
+static const float TARGET_MS = 1000.0f / 60.0f;
+
+PerformanceOverlay::PerformanceOverlay() : count(0), next(0)
+{
+  std::fill(this->frameTimes, this->frameTimes + HISTORY_SIZE, 0.0f);
+  std::fill(this->simulationTimes, this->simulationTimes + HISTORY_SIZE, 0.0f);
+  std::fill(this->renderTimes, this->renderTimes + HISTORY_SIZE, 0.0f);
+};
+
+void PerformanceOverlay::RecordFrame(float frameMs, float simulationMs, float renderMs)
+{
+  this->frameTimes[this->next] = frameMs;
+  this->simulationTimes[this->next] = simulationMs;
+  this->renderTimes[this->next] = renderMs;
+  this->next = (this->next + 1) % HISTORY_SIZE;
+  if (this->count < HISTORY_SIZE)
+  {
+    this->count++;
+  }
+};
+
+float PerformanceOverlay::FrameTimePercentile(float percentile) const
+{
+  if (this->count == 0)
+  {
+    return 0.0f;
+  }
+
+  // 원본 ring buffer 순서(그래프 표시 순서)를 유지하기 위해 복사본에서 n 번째 값 선택
+  std::vector<float> sorted(this->frameTimes, this->frameTimes + this->count);
+  std::size_t index = static_cast<std::size_t>(percentile / 100.0f * (this->count - 1) + 0.5f);
+  std::nth_element(sorted.begin(), sorted.begin() + index, sorted.end());
+  return sorted[index];
+};
+
+void PerformanceOverlay::Draw(TextRenderer &text, QuadBatch &batch, glm::vec2 position, const OverlayContent &content)
+{
+  float frameMs = this->average(this->frameTimes);
+  const RenderFrameStats &stats = RenderStats::LastFrame();
+
+  /** overlay 에 표시할 여러 줄의 텍스트를 하나의 문자열로 구성 -> RenderText() 한 번(= draw call 한 번)으로 렌더링 */
+  std::ostringstream ss;
+  ss << std::fixed << std::setprecision(1);
+  ss << "FPS " << (frameMs > 0.0f ? 1000.0f / frameMs : 0.0f) << "  " << std::setprecision(2) << frameMs << "ms"
+     << "  p50 " << this->FrameTimePercentile(50.0f) << "  p99 " << this->FrameTimePercentile(99.0f) << "\n";
+  ss << "CPU sim " << this->average(this->simulationTimes) << "ms  render " << this->average(this->renderTimes) << "ms\n";
+  ss << "GPU ";
+  if (GpuProfiler::IsEnabled())
+  {
+    ss << GpuProfiler::TotalAverageMs() << "ms\n";
+  }
+  else
+  {
+    ss << "n/a\n";
+  }
+  ss << "draws " << stats.DrawCalls << "  binds " << stats.TextureBinds << "\n";
+  ss << "submitted " << stats.Submitted << "  culled " << stats.Culled << "\n";
+  ss << "particles " << content.LiveParticles << "  bricks " << content.LiveBricks << "\n";
+  ss << "powerups " << (content.ActivePowerUps.empty() ? "-" : content.ActivePowerUps);
+  const unsigned int lineCount = 7;
+
+  float lineHeight = text.LineHeight * OVERLAY_TEXT_SCALE;
+  float width = HISTORY_SIZE + OVERLAY_PADDING * 2.0f;
+  float textHeight = lineHeight * lineCount;
+  glm::vec2 graphOrigin = position + glm::vec2(OVERLAY_PADDING, OVERLAY_PADDING * 2.0f + textHeight);
+  float height = textHeight + GRAPH_HEIGHT + OVERLAY_PADDING * 3.0f;
+
+  /** 배경 패널 및 frame-time 그래프를 QuadBatch 에 모아서 한 번에 렌더링 */
+  batch.AddQuad(position, glm::vec2(width, height), glm::vec4(0.0f, 0.0f, 0.0f, 0.6f));
+
+  // 가장 오래된 프레임부터 왼쪽에서 오른쪽으로 1px 너비의 막대로 표시 (목표 frame-time 이내는 녹색, 2배 이내는 노란색, 그 이상은 빨간색)
+  unsigned int oldest = (this->next + HISTORY_SIZE - this->count) % HISTORY_SIZE;
+  for (unsigned int i = 0; i < this->count; i++)
+  {
+    float ms = this->frameTimes[(oldest + i) % HISTORY_SIZE];
+    float barHeight = std::min(ms / GRAPH_MAX_MS, 1.0f) * GRAPH_HEIGHT;
+    glm::vec4 color = ms <= TARGET_MS * 1.05f ? glm::vec4(0.2f, 0.9f, 0.2f, 0.9f)
+                      : ms <= TARGET_MS * 2.0f ? glm::vec4(0.9f, 0.8f, 0.2f, 0.9f)
+                                               : glm::vec4(0.9f, 0.2f, 0.2f, 0.9f);
+    batch.AddQuad(glm::vec2(graphOrigin.x + i, graphOrigin.y + GRAPH_HEIGHT - barHeight), glm::vec2(1.0f, barHeight), color);
+  }
+
+  // 목표 frame-time(60fps) 기준선
+  float targetY = graphOrigin.y + GRAPH_HEIGHT - TARGET_MS / GRAPH_MAX_MS * GRAPH_HEIGHT;
+  batch.AddLine(glm::vec2(graphOrigin.x, targetY), glm::vec2(graphOrigin.x + HISTORY_SIZE, targetY), 1.0f, glm::vec4(1.0f, 1.0f, 1.0f, 0.5f));
+  batch.Flush();
+
+  text.RenderText(ss.str(), position.x + OVERLAY_PADDING, position.y + OVERLAY_PADDING, OVERLAY_TEXT_SCALE, glm::vec3(1.0f));
+};
+
+float PerformanceOverlay::average(const float *values) const
+{
+  if (this->count == 0)
+  {
+    return 0.0f;
+  }
+
+  float sum = 0.0f;
+  for (unsigned int i = 0; i < this->count; i++)
+  {
+    sum += values[i];
+  }
+  return sum / this->count;
+};
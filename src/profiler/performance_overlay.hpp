@@ -0,0 +1,62 @@
+#ifndef PERFORMANCE_OVERLAY_HPP
+#define PERFORMANCE_OVERLAY_HPP
+
+#include <string>
+
+#include <glm/glm.hpp>
+
+#include "../renderer/text_renderer.hpp"
+#include "../renderer/quad_batch.hpp"
+
+// overlay 에 표시할 게임 콘텐츠 측 통계 (Game 이 매 프레임 채워서 전달)
+struct OverlayContent
+{
+  unsigned int LiveParticles;
+  unsigned int LiveBricks;
+  std::string ActivePowerUps; // 활성화된 powerup 유형들을 공백으로 구분한 문자열
+
+  OverlayContent() : LiveParticles(0), LiveBricks(0) {};
+};
+
+/**
+ * PerformanceOverlay 클래스
+ *
+ * FPS, frame-time 그래프(p50/p99), simulation / render CPU 시간, GPU 시간, draw call 및 텍스쳐 바인딩 횟수, view culling 결과,
+ * 콘텐츠 통계를 화면에 표시하는 토글 가능한 HUD.
+ * -> 느려진 원인이 GPU, CPU, 콘텐츠(particle, brick 개수 등) 중 어디에 있는지 실행 중인 화면에서 바로 확인하기 위한 목적
+ *
+ * 표시 여부는 Game::ShowOverlay 로 토글함.
+ *
+ * 텍스트는 TextRenderer 로 여러 줄을 한 번에, 배경 패널과 그래프는 QuadBatch 로 한 번에 그리므로
+ * overlay 자체의 비용은 draw call 2 번임.
+ */
+class PerformanceOverlay
+{
+public:
+  // frame-time 그래프에 표시할 최근 프레임 개수
+  static const unsigned int HISTORY_SIZE = 240;
+
+  PerformanceOverlay();
+
+  // 한 프레임의 전체 시간, simulation(입력 처리 + 업데이트) CPU 시간, 렌더링 CPU 시간 기록 (ms)
+  void RecordFrame(float frameMs, float simulationMs, float renderMs);
+
+  // 최근 HISTORY_SIZE 프레임의 frame-time 백분위수 (percentile 은 0 ~ 100)
+  float FrameTimePercentile(float percentile) const;
+
+  // 주어진 screen space 좌상단 위치에 overlay 렌더링
+  void Draw(TextRenderer &text, QuadBatch &batch, glm::vec2 position, const OverlayContent &content);
+
+private:
+  // 최근 프레임 기록 ring buffer (ms)
+  float frameTimes[HISTORY_SIZE];
+  float simulationTimes[HISTORY_SIZE];
+  float renderTimes[HISTORY_SIZE];
+  unsigned int count; // 기록된 프레임 개수 (최대 HISTORY_SIZE)
+  unsigned int next;  // 다음 프레임을 기록할 index
+
+  // ring buffer 에 기록된 값들의 평균
+  float average(const float *values) const;
+};
+
+#endif /* PERFORMANCE_OVERLAY_HPP */
@@ -0,0 +1,36 @@
+#include "camera_uniforms.hpp"
+
+#include <glm/gtc/type_ptr.hpp>
+
+CameraUniforms::CameraUniforms()
+    : projection(1.0f), view(1.0f), uploaded(false)
+{
+  // std140 배치에서 mat4 는 column 마다 16 byte 이므로 C++ 의 glm::mat4 와 같은 배치 -> 두 행렬을 이어서 그대로 업로드
+  this->buffer = GLBuffer::Create();
+  glBindBuffer(GL_UNIFORM_BUFFER, this->buffer.Get());
+  glBufferData(GL_UNIFORM_BUFFER, 2 * sizeof(glm::mat4), NULL, GL_DYNAMIC_DRAW);
+  glBindBuffer(GL_UNIFORM_BUFFER, 0);
+  this->buffer.Track(GPU_MEMORY_UNIFORM_BUFFER, 2 * sizeof(glm::mat4), "camera_uniforms");
+  glBindBufferBase(GL_UNIFORM_BUFFER, CAMERA_UNIFORM_BINDING, this->buffer.Get());
+}
+
+void CameraUniforms::Bind(Shader &shader)
+{
+  shader.BindUniformBlock("Camera", CAMERA_UNIFORM_BINDING);
+}
+
+void CameraUniforms::Update(const glm::mat4 &projection, const glm::mat4 &view)
+{
+  if (this->uploaded && projection == this->projection && view == this->view)
+  {
+    return;
+  }
+  this->projection = projection;
+  this->view = view;
+  this->uploaded = true;
+
+  glBindBuffer(GL_UNIFORM_BUFFER, this->buffer.Get());
+  glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(glm::mat4), glm::value_ptr(projection));
+  glBufferSubData(GL_UNIFORM_BUFFER, sizeof(glm::mat4), sizeof(glm::mat4), glm::value_ptr(view));
+  glBindBuffer(GL_UNIFORM_BUFFER, 0);
+}
@@ -0,0 +1,38 @@
+#ifndef CAMERA_UNIFORMS_HPP
+#define CAMERA_UNIFORMS_HPP
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+#include "../utils/shader.hpp"
+#include "../utils/gl_object.hpp"
+
+// 'Camera' uniform block 을 연결할 uniform buffer binding point
+const unsigned int CAMERA_UNIFORM_BINDING = 0;
+
+/**
+ * CameraUniforms 클래스
+ *
+ * sprite, particle, text 쉐이더가 공유하는 'Camera' uniform block (std140: mat4 projection, mat4 view) 의 uniform buffer 를 소유하는 클래스.
+ * -> 쉐이더마다 projection, view 행렬을 따로 전송하지 않고, 매 프레임 buffer 한 번만 갱신하면 연결된 모든 쉐이더에 반영됨.
+ * -> 행렬이 이전 프레임과 같다면 (카메라가 움직이지 않는 일반 레벨) 업로드하지 않음.
+ */
+class CameraUniforms
+{
+public:
+  // uniform buffer 생성 및 CAMERA_UNIFORM_BINDING 에 연결 (GL 컨텍스트 생성 이후 호출)
+  CameraUniforms();
+
+  // 쉐이더의 'Camera' uniform block 을 CAMERA_UNIFORM_BINDING 에 연결
+  static void Bind(Shader &shader);
+
+  // projection, view 행렬 업로드 (이전에 업로드한 값과 같으면 생략)
+  void Update(const glm::mat4 &projection, const glm::mat4 &view);
+
+private:
+  GLBuffer buffer;
+  glm::mat4 projection, view; // 마지막으로 업로드한 행렬
+  bool uploaded;
+};
+
+#endif /* CAMERA_UNIFORMS_HPP */
@@ -0,0 +1,91 @@
+#include "quad_batch.hpp"
+#include "render_stats.hpp"
+
+#include <cmath>
+
+const std::size_t QuadBatch::FLOATS_PER_VERTEX;
+const std::size_t QuadBatch::VERTICES_PER_QUAD;
+
+QuadBatch::QuadBatch(Shader shader) : shader(shader), capacity(0)
+{
+  /** 정점 데이터 VAO, VBO 객체 생성 및 설정 (VBO 메모리는 Flush() 시점에 필요한 크기만큼 할당) */
+  this->VAO = GLVertexArray::Create();
+  this->VBO = GLBuffer::Create();
+  glBindVertexArray(this->VAO.Get());
+  glBindBuffer(GL_ARRAY_BUFFER, this->VBO.Get());
+  glEnableVertexAttribArray(0);
+  glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, FLOATS_PER_VERTEX * sizeof(float), (void *)0);
+  glEnableVertexAttribArray(1);
+  glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, FLOATS_PER_VERTEX * sizeof(float), (void *)(2 * sizeof(float)));
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+  glBindVertexArray(0);
+};
+
+void QuadBatch::AddQuad(glm::vec2 position, glm::vec2 size, glm::vec4 color)
+{
+  this->pushQuad(position, glm::vec2(position.x + size.x, position.y), position + size, glm::vec2(position.x, position.y + size.y), color);
+};
+
+void QuadBatch::AddLine(glm::vec2 from, glm::vec2 to, float thickness, glm::vec4 color)
+{
+  glm::vec2 direction = to - from;
+  float length = std::sqrt(direction.x * direction.x + direction.y * direction.y);
+  if (length <= 0.0f)
+  {
+    return;
+  }
+
+  // 선분 방향에 수직인 단위벡터에 두께의 절반을 곱하여 양쪽으로 늘림
+  glm::vec2 normal = glm::vec2(-direction.y, direction.x) * (0.5f * thickness / length);
+  this->pushQuad(from + normal, to + normal, to - normal, from - normal, color);
+};
+
+void QuadBatch::Flush()
+{
+  if (this->vertices.empty())
+  {
+    return;
+  }
+
+  // 누적된 정점 데이터를 VBO 에 업로드 (용량이 부족할 때만 메모리를 재할당하고, 그 외에는 기존 메모리에 덮어씀)
+  std::size_t bytes = this->vertices.size() * sizeof(float);
+  glBindBuffer(GL_ARRAY_BUFFER, this->VBO.Get());
+  if (bytes > this->capacity)
+  {
+    this->capacity = bytes * 2;
+    glBufferData(GL_ARRAY_BUFFER, this->capacity, NULL, GL_DYNAMIC_DRAW);
+    this->VBO.Track(GPU_MEMORY_VERTEX_BUFFER, this->capacity, "quad_batch");
+  }
+  glBufferSubData(GL_ARRAY_BUFFER, 0, bytes, this->vertices.data());
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+  // 쉐이더 바인딩 후 모든 도형을 한 번의 draw call 로 렌더링
+  this->shader.Use();
+  glBindVertexArray(this->VAO.Get());
+  glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(this->vertices.size() / FLOATS_PER_VERTEX));
+  glBindVertexArray(0);
+  RenderStats::CountDrawCall();
+
+  // 다음 프레임에 재사용할 수 있도록 메모리는 유지한 채로 비움
+  this->vertices.clear();
+};
+
+std::size_t QuadBatch::QuadCount() const
+{
+  return this->vertices.size() / (FLOATS_PER_VERTEX * VERTICES_PER_QUAD);
+};
+
+void QuadBatch::pushQuad(glm::vec2 p0, glm::vec2 p1, glm::vec2 p2, glm::vec2 p3, glm::vec4 color)
+{
+  // 삼각형 (p0, p1, p2), (p0, p2, p3) 순으로 정점 추가
+  const glm::vec2 corners[VERTICES_PER_QUAD] = {p0, p1, p2, p0, p2, p3};
+  for (std::size_t i = 0; i < VERTICES_PER_QUAD; i++)
+  {
+    this->vertices.push_back(corners[i].x);
+    this->vertices.push_back(corners[i].y);
+    this->vertices.push_back(color.r);
+    this->vertices.push_back(color.g);
+    this->vertices.push_back(color.b);
+    this->vertices.push_back(color.a);
+  }
+};
@@ -0,0 +1,53 @@
+#ifndef QUAD_BATCH_HPP
+#define QUAD_BATCH_HPP
+
+#include <vector>
+#include <cstddef>
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+#include "../utils/shader.hpp"
+#include "../utils/gl_object.hpp"
+
+/**
+ * QuadBatch 클래스
+ *
+ * 텍스쳐 없이 단색으로 칠하는 사각형 및 선분들을 CPU 측 정점 버퍼에 모아뒀다가,
+ * Flush() 호출 시 한 번의 버퍼 업로드 및 draw call 로 렌더링하는 batch renderer 클래스.
+ * -> 성능 overlay 의 배경 패널, frame-time 그래프처럼 작은 도형이 많은 UI 를 draw call 하나로 그리기 위한 목적
+ */
+class QuadBatch
+{
+public:
+  // 생성자 (projection uniform 이 전송된 quad_batch 쉐이더 객체)
+  QuadBatch(Shader shader);
+
+  // screen space 좌상단 위치와 크기로 사각형 추가
+  void AddQuad(glm::vec2 position, glm::vec2 size, glm::vec4 color);
+
+  // 두 점을 잇는 주어진 두께의 선분 추가 (선분 방향에 수직으로 두께만큼 늘린 사각형으로 그림)
+  void AddLine(glm::vec2 from, glm::vec2 to, float thickness, glm::vec4 color);
+
+  // 추가된 도형들을 한 번의 draw call 로 렌더링 후 비움
+  void Flush();
+
+  // 아직 렌더링되지 않은 사각형 개수
+  std::size_t QuadCount() const;
+
+private:
+  // 정점 하나 당 float 개수 (position 2 + color 4) 및 사각형 하나 당 정점 개수 (삼각형 2개)
+  static const std::size_t FLOATS_PER_VERTEX = 6;
+  static const std::size_t VERTICES_PER_QUAD = 6;
+
+  Shader shader;
+  std::vector<float> vertices; // Flush() 전까지 누적되는 정점 데이터
+  GLVertexArray VAO;
+  GLBuffer VBO;
+  std::size_t capacity; // VBO 에 할당된 메모리 크기 (byte)
+
+  // 사각형 네 꼭짓점으로 삼각형 2개 분량의 정점 추가
+  void pushQuad(glm::vec2 p0, glm::vec2 p1, glm::vec2 p2, glm::vec2 p3, glm::vec4 color);
+};
+
+#endif /* QUAD_BATCH_HPP */
@@ -0,0 +1,10 @@
+#include "render_stats.hpp"
+
+RenderFrameStats RenderStats::current;
+RenderFrameStats RenderStats::last;
+
+void RenderStats::NewFrame()
+{
+  last = current;
+  current = RenderFrameStats();
+};
@@ -0,0 +1,47 @@
+#ifndef RENDER_STATS_HPP
+#define RENDER_STATS_HPP
+
+// 한 프레임 동안 누적된 렌더링 통계
+struct RenderFrameStats
+{
+  unsigned int DrawCalls;
+  unsigned int TextureBinds;
+  unsigned int Submitted; // view culling 을 통과하여 그리도록 제출된 object 개수 (brick, sprite, particle)
+  unsigned int Culled;    // view 밖에 있어서 그리지 않은 object 개수
+
+  RenderFrameStats() : DrawCalls(0), TextureBinds(0), Submitted(0), Culled(0) {};
+};
+
+/**
+ * RenderStats 클래스
+ *
+ * 프레임 당 draw call, 텍스쳐 바인딩 횟수 및 view culling 결과를 집계하는 singleton 클래스.
+ * -> 각 renderer 가 draw call, 텍스쳐 바인딩 직후 Count*() 를 호출하고,
+ *    렌더링 루프가 매 프레임 시작 시점에 NewFrame() 을 호출하여 직전 프레임 통계를 확정함.
+ *
+ * 렌더링은 메인 스레드에서만 수행하므로 별도의 동기화는 하지 않음.
+ */
+class RenderStats
+{
+public:
+  // 직전 프레임 통계 확정 후 현재 프레임 카운터 초기화
+  static void NewFrame();
+
+  static void CountDrawCall() { current.DrawCalls++; };
+  static void CountTextureBind() { current.TextureBinds++; };
+  static void CountSubmitted(unsigned int count) { current.Submitted += count; };
+  static void CountCulled(unsigned int count) { current.Culled += count; };
+
+  // 현재 집계 중인 프레임 통계 및 마지막으로 완료된 프레임 통계
+  static const RenderFrameStats &Current() { return current; };
+  static const RenderFrameStats &LastFrame() { return last; };
+
+private:
+  static RenderFrameStats current;
+  static RenderFrameStats last;
+
+  // singleton 클래스는 인스턴스 생성이 불필요하므로, 생성자 함수 캡슐화
+  RenderStats() {};
+};
+
+#endif /* RENDER_STATS_HPP */
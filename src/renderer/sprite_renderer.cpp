@@ -1,4 +1,6 @@
 #include "sprite_renderer.hpp"
+#include "../manager/resource_manager.hpp"
+#include "render_stats.hpp"
 
 SpriteRenderer::SpriteRenderer(Shader &shader)
 {
@@ -6,13 +8,12 @@ SpriteRenderer::SpriteRenderer(Shader &shader)
   this->initRenderData();
 };
 
-SpriteRenderer::~SpriteRenderer()
+void SpriteRenderer::DrawSprite(TextureHandle texture, glm::vec2 position, glm::vec2 size, float rotate, glm::vec3 color)
 {
-  // 소멸자 함수 내에서 2D Quad VAO 객체 메모리 반납
-  glDeleteVertexArrays(1, &this->quadVAO);
+  this->DrawSprite(ResourceManager::GetTexture(texture), position, size, rotate, color);
 };
 
-void SpriteRenderer::DrawSprite(Texture2D &texture, glm::vec2 position, glm::vec2 size, float rotate, glm::vec3 color)
+void SpriteRenderer::DrawSprite(const Texture2D &texture, glm::vec2 position, glm::vec2 size, float rotate, glm::vec3 color)
 {
   // 2D Sprite 렌더링 시 적용할 쉐이더 객체 바인딩
   this->shader.Use();
@@ -39,19 +40,31 @@ void SpriteRenderer::DrawSprite(Texture2D &texture, glm::vec2 position, glm::vec
   // 0번 texture unit 활성화 및 전달받은 텍스쳐 객체 바인딩
   glActiveTexture(GL_TEXTURE0);
   texture.Bind();
+  RenderStats::CountTextureBind();
+
+  // alpha 가 미리 곱해진 텍스쳐는 source color 에 alpha 를 다시 곱하지 않도록 blend func 변경 후 draw call 이 끝나면 원복
+  if (texture.PremultipliedAlpha)
+  {
+    glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+  }
 
   // 2D Quad VAO 객체 바인딩 후 draw call
-  glBindVertexArray(this->quadVAO);
+  glBindVertexArray(this->quadVAO.Get());
   glDrawArrays(GL_TRIANGLES, 0, 6);
   glBindVertexArray(0);
+  RenderStats::CountDrawCall();
+
+  if (texture.PremultipliedAlpha)
+  {
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+  }
 };
 
 void SpriteRenderer::initRenderData()
 {
   /** 2D Quad 렌더링 시 사용할 VBO, VAO 객체 생성 및 바인딩 */
 
-  // 실제 정점 데이터 바인딩 시, VAO 객체만 바인딩하면 되므로, VBO ID 값은 멤버변수로 들고있지 않아도 됨.
-  unsigned int VBO;
+  // 실제 정점 데이터 바인딩 시에는 VAO 객체만 바인딩하면 되지만, VBO 객체도 반납해야 하므로 멤버변수로 소유함.
   float vertices[] = {
       // pos      // tex
       0.0f, 1.0f, 0.0f, 1.0f,
@@ -62,14 +75,15 @@ void SpriteRenderer::initRenderData()
       1.0f, 1.0f, 1.0f, 1.0f,
       1.0f, 0.0f, 1.0f, 0.0f};
 
-  glGenVertexArrays(1, &this->quadVAO);
-  glGenBuffers(1, &VBO);
+  this->quadVAO = GLVertexArray::Create();
+  this->quadVBO = GLBuffer::Create();
 
   // 2D Quad 정점 데이터를 VBO 객체에 write
-  glBindBuffer(GL_ARRAY_BUFFER, VBO);
+  glBindBuffer(GL_ARRAY_BUFFER, this->quadVBO.Get());
   glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+  this->quadVBO.Track(GPU_MEMORY_VERTEX_BUFFER, sizeof(vertices), "sprite_quad");
 
-  glBindVertexArray(this->quadVAO);
+  glBindVertexArray(this->quadVAO.Get());
 
   // 2D Quad 의 pos, uv 데이터가 vec4 로 묶인 0번 attribute 변수 활성화 및 데이터 해석 방식 정의
   glEnableVertexAttribArray(0);
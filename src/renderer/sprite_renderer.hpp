@@ -7,6 +7,8 @@
 
 #include "../utils/texture.hpp"
 #include "../utils/shader.hpp"
+#include "../utils/gl_object.hpp"
+#include "../manager/resource_handle.hpp"
 
 /**
  * SpriteRenderer 클래스
@@ -21,17 +23,20 @@ class SpriteRenderer
 {
 public:
   SpriteRenderer(Shader &shader);
-  ~SpriteRenderer();
 
   // sprite draw call
-  void DrawSprite(Texture2D &texture, glm::vec2 position, glm::vec2 size = glm::vec2(10.0f, 10.0f), float rotate = 0.0f, glm::vec3 color = glm::vec3(1.0f));
+  void DrawSprite(const Texture2D &texture, glm::vec2 position, glm::vec2 size = glm::vec2(10.0f, 10.0f), float rotate = 0.0f, glm::vec3 color = glm::vec3(1.0f));
+
+  // ResourceManager 에 저장된 텍스쳐를 handle 로 참조하여 sprite draw call
+  void DrawSprite(TextureHandle texture, glm::vec2 position, glm::vec2 size = glm::vec2(10.0f, 10.0f), float rotate = 0.0f, glm::vec3 color = glm::vec3(1.0f));
 
 private:
   // 2D Sprite 렌더링 시 바인딩할 쉐이더
   Shader shader;
 
-  // 2D Sprite 렌더링 시 바인딩할 2D Quad 정점 데이터를 바인딩하는 VAO 객체 ID
-  unsigned int quadVAO;
+  // 2D Sprite 렌더링 시 바인딩할 2D Quad 정점 데이터를 바인딩하는 VAO 객체 및 정점 데이터가 기록된 VBO 객체 (소멸 시 자동 반납)
+  GLVertexArray quadVAO;
+  GLBuffer quadVBO;
 
   // 2D Sprite 정점 데이터 초기화
   void initRenderData();
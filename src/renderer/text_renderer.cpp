@@ -1,4 +1,6 @@
 #include <iostream>
+#include <utility>
+#include <algorithm>
 
 #include <glm/gtc/matrix_transform.hpp>
 #include <ft2build.h>
@@ -6,25 +8,32 @@
 
 #include "text_renderer.hpp"
 #include "../manager/resource_manager.hpp"
+#include "render_stats.hpp"
+#include "camera_uniforms.hpp"
 
-TextRenderer::TextRenderer(unsigned int width, unsigned int height)
+TextRenderer::TextRenderer()
+    : AtlasWidth(0), AtlasHeight(0), LineHeight(0.0f), vboCapacity(0)
 {
   // 텍스트 렌더링 시 바인딩할 쉐이더 객체 생성 및 uniform 변수 전송
-  this->TextShader = ResourceManager::LoadShader("resources/shaders/text.vs", "resources/shaders/text.fs", nullptr, "text");
+  this->TextShader = ResourceManager::GetShader(ResourceManager::LoadShader("resources/shaders/text.vs", "resources/shaders/text.fs", nullptr, "text"));
 
-  // 2D 텍스트 렌더링 시 적용할 orthogonal projection 행렬 계산 및 전송 (관련 필기 하단 참고)
-  this->TextShader.SetMat4("projection", glm::ortho(0.0f, static_cast<float>(width), static_cast<float>(height), 0.0f), true);
+  // 2D 텍스트 렌더링 시 적용할 orthogonal projection 행렬은 sprite, particle 쉐이더와 공유하는 'Camera' uniform block 에서 읽음 (관련 필기 하단 참고)
+  // -> text 는 HUD 이므로 view 행렬은 적용하지 않고 항상 screen space 에 그림
+  CameraUniforms::Bind(this->TextShader);
 
   // 각 glyph 텍스쳐를 바인딩할 0번 texture unit 위치값 전송
-  this->TextShader.SetInt("text", 0);
+  this->TextShader.Use().SetInt("text", 0);
 
   /** 2D Quad 의 VAO, VBO 객체 생성 및 설정 */
-  glGenVertexArrays(1, &this->VAO);
-  glGenBuffers(1, &this->VBO);
-  glBindVertexArray(this->VAO);
-  glBindBuffer(GL_ARRAY_BUFFER, this->VBO);
+  this->VAO = GLVertexArray::Create();
+  this->VBO = GLBuffer::Create();
+  glBindVertexArray(this->VAO.Get());
+  glBindBuffer(GL_ARRAY_BUFFER, this->VBO.Get());
   // 2D Quad 는 각 glyph metrices 에 따라 매 프레임마다 정점 데이터가 자주 변경되므로, GL_DYNAMIC_DRAW 모드로 정점 데이터 버퍼의 메모리를 예약함.
-  glBufferData(GL_ARRAY_BUFFER, sizeof(float) * 6 * 4, NULL, GL_DYNAMIC_DRAW);
+  // -> 문자열 전체를 한 번에 업로드하므로, 우선 64 글자 분량을 예약해두고 더 긴 문자열이 들어오면 RenderText() 에서 늘림.
+  this->vboCapacity = sizeof(float) * 6 * 4 * 64;
+  glBufferData(GL_ARRAY_BUFFER, this->vboCapacity, NULL, GL_DYNAMIC_DRAW);
+  this->VBO.Track(GPU_MEMORY_VERTEX_BUFFER, this->vboCapacity, "text_quads");
   glEnableVertexAttribArray(0);
   glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, 4 * sizeof(float), 0);
   glBindBuffer(GL_ARRAY_BUFFER, 0);
@@ -33,7 +42,7 @@ TextRenderer::TextRenderer(unsigned int width, unsigned int height)
 
 void TextRenderer::Load(std::string font, unsigned int fontSize)
 {
-  // 기존에 파싱해서 컨테이너에 저장해 둔 glyph metrices 초기화 (레드-블랙트리 노드 데이터만 초기화. 노드에 할당된 메모리는 유지)
+  // 기존에 파싱해서 컨테이너에 저장해 둔 glyph metrices 초기화
   this->Characters.clear();
 
   /** FreeType 라이브러리 초기화 */
@@ -42,6 +51,7 @@ void TextRenderer::Load(std::string font, unsigned int fontSize)
   {
     // FreeType 라이브러리 초기화 실패 -> FreeType 함수들은 에러 발생 시 0 이 아닌 값을 반환.
     std::cout << "ERROR::FREETYPE: Could not init FreeType Library" << std::endl;
+    return;
   }
 
   /** FT_Face 인터페이스로 .ttf 파일 로드 */
@@ -50,17 +60,30 @@ void TextRenderer::Load(std::string font, unsigned int fontSize)
   {
     // .ttf 파일 로드 실패
     std::cout << "ERROR::FREETYPE: Failed to load font" << std::endl;
+    FT_Done_FreeType(ft);
+    return;
   }
 
   // .ttf 파일 로드 성공 시 작업들 처리
 
   // .ttf 파일로부터 렌더링할 glyph 들의 pixel size 설정 -> height 값만 설정하고 width 는 각 glyph 형태에 따라 동적으로 계산하도록 0 으로 지정
   FT_Set_Pixel_Sizes(face, 0, fontSize);
+  this->LineHeight = static_cast<float>(face->size->metrics.height >> 6);
+
+  /**
+   * 128 개의 ASCII 문자들의 glyph 들을 8-bit grayscale bitmap 으로 렌더링한 뒤, 하나의 atlas 이미지에 나란히 배치
+   *
+   * -> 고정된 atlas 너비 안에서 왼쪽부터 glyph 를 채워나가다가, 자리가 부족하면 다음 줄로 넘어가는 단순한 row packing.
+   * -> 인접한 glyph 가 linear 필터링 시 섞여 들어오지 않도록 glyph 사이에 1px 간격을 둠.
+   */
+  const unsigned int atlasWidth = 512;
+  const unsigned int padding = 1;
+  std::vector<unsigned char> atlas;
+  unsigned int penX = padding, penY = padding, rowHeight = 0;
+
+  // glyph 별 atlas 내 위치 (uv 는 atlas 높이가 확정된 뒤에 계산)
+  std::map<char, glm::uvec2> offsets;
 
-  // glyph 가 렌더링된 grayscale bitmap 의 텍스쳐 데이터 정렬 단위 변경 (하단 필기 참고)
-  glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
-
-  // 128 개의 ASCII 문자들의 glyph 들을 8-bit grayscale bitmap 텍스쳐 버퍼에 렌더링
   for (unsigned char c = 0; c < 128; c++)
   {
     if (FT_Load_Char(face, c, FT_LOAD_RENDER))
@@ -70,88 +93,132 @@ void TextRenderer::Load(std::string font, unsigned int fontSize)
       continue;
     }
 
-    // 각 glyph grayscale bitmap 텍스쳐 생성 및 bitmap 데이터 복사
-    unsigned int texture;
-    glGenTextures(1, &texture);
-    glBindTexture(GL_TEXTURE_2D, texture);
-    glTexImage2D(
-        GL_TEXTURE_2D,
-        0,
-        GL_RED,
-        face->glyph->bitmap.width,
-        face->glyph->bitmap.rows, // bitmap 버퍼 줄 수 = bitmap 버퍼 height
-        0,
-        GL_RED,
-        GL_UNSIGNED_BYTE,
-        face->glyph->bitmap.buffer);
-
-    // 텍스쳐 파라미터 설정
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    const FT_Bitmap &bitmap = face->glyph->bitmap;
+    if (penX + bitmap.width + padding > atlasWidth)
+    {
+      penX = padding;
+      penY += rowHeight + padding;
+      rowHeight = 0;
+    }
+
+    // atlas 이미지 높이를 현재 줄까지 늘린 뒤 glyph bitmap 복사 (FreeType bitmap 은 각 줄이 pitch byte 단위로 저장됨)
+    atlas.resize(static_cast<std::size_t>(atlasWidth) * (penY + bitmap.rows + padding), 0);
+    for (unsigned int row = 0; row < bitmap.rows; row++)
+    {
+      const unsigned char *src = bitmap.buffer + row * bitmap.pitch;
+      std::copy(src, src + bitmap.width, atlas.begin() + (penY + row) * atlasWidth + penX);
+    }
+    offsets[static_cast<char>(c)] = glm::uvec2(penX, penY);
 
     // 로드된 glyph metrices 를 커스텀 자료형으로 파싱
     Character character = {
-        texture,
-        glm::ivec2(face->glyph->bitmap.width, face->glyph->bitmap.rows),
+        glm::vec4(0.0f),
+        glm::ivec2(bitmap.width, bitmap.rows),
         glm::ivec2(face->glyph->bitmap_left, face->glyph->bitmap_top),
         static_cast<unsigned int>(face->glyph->advance.x)};
     // std::map 컨테이너는 std::pair 를 node 로 삼아 key-value 쌍을 추가함. (참고로, std::map 은 red-black tree 기반의 컨테이너)
-    Characters.insert(std::pair<char, Character>(c, character));
+    Characters.insert(std::make_pair(static_cast<char>(c), character));
+
+    penX += bitmap.width + padding;
+    rowHeight = std::max(rowHeight, static_cast<unsigned int>(bitmap.rows));
+  }
+
+  // FreeType 리소스 반납
+  FT_Done_Face(face);
+  FT_Done_FreeType(ft);
+
+  this->AtlasWidth = atlasWidth;
+  this->AtlasHeight = static_cast<unsigned int>(atlas.size() / atlasWidth);
+
+  // atlas 해상도가 확정되었으므로 각 glyph 의 uv 좌표 계산
+  for (std::map<char, Character>::iterator iter = this->Characters.begin(); iter != this->Characters.end(); iter++)
+  {
+    glm::uvec2 offset = offsets[iter->first];
+    Character &ch = iter->second;
+    ch.UV = glm::vec4(
+        static_cast<float>(offset.x) / this->AtlasWidth,
+        static_cast<float>(offset.y) / this->AtlasHeight,
+        static_cast<float>(offset.x + ch.Size.x) / this->AtlasWidth,
+        static_cast<float>(offset.y + ch.Size.y) / this->AtlasHeight);
   }
+
+  // glyph atlas 텍스쳐 생성 및 bitmap 데이터 복사
+  // (grayscale bitmap 의 각 줄은 1 byte 단위로 정렬되어 있으므로, 텍스쳐 데이터 정렬 단위 변경 -> 하단 필기 참고)
+  if (!this->Atlas)
+  {
+    this->Atlas = GLTexture::Create();
+  }
+  glBindTexture(GL_TEXTURE_2D, this->Atlas.Get());
+  glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+  glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, this->AtlasWidth, this->AtlasHeight, 0, GL_RED, GL_UNSIGNED_BYTE, atlas.data());
+  this->Atlas.Track(GPU_MEMORY_GLYPH, atlas.size(), "glyph_atlas");
+
+  // 텍스쳐 파라미터 설정
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+  glBindTexture(GL_TEXTURE_2D, 0);
 };
 
-void TextRenderer::RenderText(std::string text, float x, float y, float scale, glm::vec3 color)
+void TextRenderer::RenderText(const std::string &text, float x, float y, float scale, glm::vec3 color)
 {
-  // shader 객체 바인딩 및 색상값 전송
-  this->TextShader.Use();
-  this->TextShader.SetVec3("textColor", color);
-
-  // grayscale bitmap 텍스쳐(glyph 텍스쳐)를 바인딩할 0번 texture unit 활성화
-  glActiveTexture(0);
+  // 'H' 처럼 천장과의 간격이 0 인 glyph 의 Bearing.y 를 폰트 최대 높이로 사용 (하단 필기 참고)
+  std::map<char, Character>::const_iterator capital = this->Characters.find('H');
+  if (capital == this->Characters.end())
+  {
+    return;
+  }
+  const int maxBearingY = capital->second.Bearing.y;
+  const float startX = x;
 
-  // glyph 텍스쳐를 적용할 2D Quad 정점 데이터 VAO 객체 바인딩
-  glBindVertexArray(this->VAO);
+  /** 주어진 문자열 컨테이너 std::string 을 순회하며 각 문자에 대응되는 glyph 의 2D Quad 정점 데이터를 하나의 버퍼에 모음 */
+  this->vertices.clear();
 
-  /** 주어진 문자열 컨테이너 std::string 을 순회하며 각 문자에 대응되는 glyph 를 2D Quad 에 렌더링  */
   // std::string 컨테이너를 순회하는 '읽기 전용' 이터레이터 선언 (하단 필기 참고)
   std::string::const_iterator c;
   for (c = text.begin(); c != text.end(); c++)
   {
-    // 현재 순회 중인 char 타입 문자에 대응되는 glyph metrices 를 가져옴
-    Character ch = Characters[*c];
+    // 줄바꿈 문자는 x 좌표를 시작 위치로 되돌리고 y 좌표를 한 줄만큼 내림
+    if (*c == '\n')
+    {
+      x = startX;
+      y += this->LineHeight * scale;
+      continue;
+    }
+
+    // 현재 순회 중인 char 타입 문자에 대응되는 glyph metrices 를 가져옴 (atlas 에 없는 문자는 건너뜀)
+    std::map<char, Character>::const_iterator iter = this->Characters.find(*c);
+    if (iter == this->Characters.end())
+    {
+      continue;
+    }
+    const Character &ch = iter->second;
 
     // 현재 문자를 렌더링할 glyph 의 위치(= 2D Quad 의 좌상단 정점의 좌표값) 계산 (하단 필기 참고)
     float xpos = x + ch.Bearing.x * scale;
-    float ypos = y + (this->Characters['H'].Bearing.y - ch.Bearing.y) * scale;
+    float ypos = y + (maxBearingY - ch.Bearing.y) * scale;
 
     // 현재 문자를 렌더링할 glyph 의 크기(= 2D Quad 의 width, height) 계산
     float w = ch.Size.x * scale;
     float h = ch.Size.y * scale;
 
-    // glyph 의 위치(= 2D Quad 좌상단 정점)와 크기(= 2D Quad 의 width, height)를 가지고 2D Quad 정점 데이터 계산
+    // glyph 의 위치(= 2D Quad 좌상단 정점)와 크기(= 2D Quad 의 width, height), atlas 내 uv 영역을 가지고 2D Quad 정점 데이터 계산
     // (이때, text-rendering 예제와 달리 orthogonal projection 행렬에 의해 위아래가 뒤집혔으므로, 정점 순서를 변경해서 2D Quad 의 앞/뒷면이 뒤집어지지 않도록 함.)
-    float vertices[6][4] = {
-        // position      // uv
-        {xpos, ypos + h, 0.0f, 1.0f},
-        {xpos + w, ypos, 1.0f, 0.0f},
-        {xpos, ypos, 0.0f, 0.0f},
-
-        {xpos, ypos + h, 0.0f, 1.0f},
-        {xpos + w, ypos + h, 1.0f, 1.0f},
-        {xpos + w, ypos, 1.0f, 0.0f}};
-
-    // 2D Quad 에 적용할 grayscale bitmap 텍스쳐 버퍼 바인딩
-    glBindTexture(GL_TEXTURE_2D, ch.TextureID);
-
-    // 재계산된 2D Quad 정점 데이터를 VBO 객체에 덮어쓰기
-    glBindBuffer(GL_ARRAY_BUFFER, this->VBO);
-    glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(vertices), vertices);
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-
-    // 2D Quad draw call
-    glDrawArrays(GL_TRIANGLES, 0, 6);
+    // (공백 문자처럼 크기가 0 인 glyph 는 정점 데이터를 추가하지 않고 원점만 이동)
+    if (w > 0.0f && h > 0.0f)
+    {
+      const float quad[6][4] = {
+          // position      // uv
+          {xpos, ypos + h, ch.UV.x, ch.UV.w},
+          {xpos + w, ypos, ch.UV.z, ch.UV.y},
+          {xpos, ypos, ch.UV.x, ch.UV.y},
+
+          {xpos, ypos + h, ch.UV.x, ch.UV.w},
+          {xpos + w, ypos + h, ch.UV.z, ch.UV.w},
+          {xpos + w, ypos, ch.UV.z, ch.UV.y}};
+      this->vertices.insert(this->vertices.end(), &quad[0][0], &quad[0][0] + 6 * 4);
+    }
 
     /**
      * 현재 glyph 원점에서 Advance 만큼 떨어진 다음 glyph 원점의 x 좌표값 계산
@@ -167,7 +234,38 @@ void TextRenderer::RenderText(std::string text, float x, float y, float scale, g
     x += (ch.Advance >> 6) * scale;
   }
 
-  // std::string 컨테이너에 저장된 모든 문자열 렌더링 완료 후, 텍스쳐 및 VAO 객체 바인딩 해제
+  if (this->vertices.empty())
+  {
+    return;
+  }
+
+  // 모아둔 정점 데이터를 VBO 객체에 한 번에 덮어쓰기 (용량이 부족할 때만 메모리 재할당)
+  std::size_t bytes = this->vertices.size() * sizeof(float);
+  glBindBuffer(GL_ARRAY_BUFFER, this->VBO.Get());
+  if (bytes > this->vboCapacity)
+  {
+    this->vboCapacity = bytes * 2;
+    glBufferData(GL_ARRAY_BUFFER, this->vboCapacity, NULL, GL_DYNAMIC_DRAW);
+    this->VBO.Track(GPU_MEMORY_VERTEX_BUFFER, this->vboCapacity, "text_quads");
+  }
+  glBufferSubData(GL_ARRAY_BUFFER, 0, bytes, this->vertices.data());
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+  // shader 객체 바인딩 및 색상값 전송
+  this->TextShader.Use();
+  this->TextShader.SetVec3("textColor", color);
+
+  // glyph atlas 텍스쳐를 0번 texture unit 에 바인딩
+  glActiveTexture(GL_TEXTURE0);
+  glBindTexture(GL_TEXTURE_2D, this->Atlas.Get());
+  RenderStats::CountTextureBind();
+
+  // 문자열 전체를 한 번의 draw call 로 렌더링
+  glBindVertexArray(this->VAO.Get());
+  glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(this->vertices.size() / 4));
+  RenderStats::CountDrawCall();
+
+  // 텍스쳐 및 VAO 객체 바인딩 해제
   glBindVertexArray(0);
   glBindTexture(GL_TEXTURE_2D, 0);
 };
@@ -2,17 +2,20 @@
 #define TEXT_RENDERER_HPP
 
 #include <map>
+#include <string>
+#include <vector>
 
 #include <glad/glad.h>
 #include <glm/glm.hpp>
 
 #include "../utils/texture.hpp"
 #include "../utils/shader.hpp"
+#include "../utils/gl_object.hpp"
 
 /** FreeType 라이브러리로 로드한 glyph metrices(각 글꼴의 크기, 위치, baseline 등)를 파싱할 자료형 정의 */
 struct Character
 {
-  unsigned int TextureID; // FreeType 내부에서 렌더링된 각 glyph 의 텍스쳐 버퍼 ID
+  glm::vec4 UV;           // glyph atlas 텍스쳐 내에서 glyph 가 차지하는 영역의 uv 좌표 (u0, v0, u1, v1)
   glm::ivec2 Size;        // glyph 크기
   glm::ivec2 Bearing;     // glyph 원점에서 x축, y축 방향으로 각각 떨어진 offset
   unsigned int Advance;   // 현재 glyph 원점에서 다음 glyph 원점까지의 거리 (1/64px 단위로 정의되어 있으므로, 값 사용 시 1px 단위로 변환해야 함.)
@@ -25,6 +28,9 @@ struct Character
  *
  * 아래 텍스트 렌더링 관련 코드들 재사용하여 구현
  * https://github.com/jooo0922/opengl-text-rendering/blob/main/src/main.cpp
+ *
+ * 모든 glyph 를 하나의 atlas 텍스쳐에 모아두므로, RenderText() 한 번 호출에 포함된 문자열 전체를
+ * 텍스쳐 바인딩 한 번, 버퍼 업로드 한 번, draw call 한 번으로 렌더링함. ('\n' 으로 여러 줄 렌더링 가능)
  */
 class TextRenderer
 {
@@ -35,17 +41,30 @@ public:
   // 텍스트 렌더링 시 바인딩할 쉐이더
   Shader TextShader;
 
-  TextRenderer(unsigned int width, unsigned int height);
+  // 모든 glyph 가 렌더링된 grayscale atlas 텍스쳐 및 해상도
+  GLTexture Atlas;
+  unsigned int AtlasWidth, AtlasHeight;
+
+  // 줄바꿈 시 다음 줄까지의 간격 (scale 1.0 기준 px)
+  float LineHeight;
+
+  // 텍스트 쉐이더 로드 및 'Camera' uniform block 연결 (projection 행렬은 CameraUniforms 가 갱신함)
+  TextRenderer();
 
   // FreeType 라이브러리 초기화 및 .ttf 파일 로드
   void Load(std::string font, unsigned int fontSize);
 
   // 주어진 std::string 문자열을 주어진 위치, 크기, 색상으로 렌더링
-  void RenderText(std::string text, float x, float y, float scale, glm::vec3 color = glm::vec3(1.0f));
+  void RenderText(const std::string &text, float x, float y, float scale, glm::vec3 color = glm::vec3(1.0f));
 
 private:
-  // 텍스트 렌더링 시 바인딩할 2D Quad 정점 데이터 버퍼 객체 ID
-  unsigned int VAO, VBO;
+  // 텍스트 렌더링 시 바인딩할 2D Quad 정점 데이터 버퍼 객체
+  GLVertexArray VAO;
+  GLBuffer VBO;
+  std::size_t vboCapacity; // VBO 에 할당된 메모리 크기 (byte)
+
+  // RenderText() 호출 시 문자열 전체의 정점 데이터를 모아둘 CPU 측 버퍼 (매 호출마다 재할당하지 않도록 멤버로 유지)
+  std::vector<float> vertices;
 };
 
 #endif /* TEXT_RENDERER_HPP */
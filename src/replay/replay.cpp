@@ -0,0 +1,278 @@
+#include "replay.hpp"
+
+#include <iostream>
+#include <iomanip>
+#include <cstring>
+#include <algorithm>
+#include <iterator>
+
+// 기록 파일 형식 상수
+static const char REPLAY_MAGIC[4] = {'B', 'R', 'P', 'L'};
+static const unsigned short REPLAY_VERSION = 1;
+static const unsigned char REPLAY_END_MARKER = 0xFF;
+static const unsigned int MAX_EVENTS_PER_TICK = 254;
+
+/** little-endian 정수 쓰기 / 읽기 함수 (플랫폼 byte order 와 무관하게 같은 파일이 생성되도록 byte 단위로 처리) */
+static void writeUint(std::ostream &out, unsigned long long value, unsigned int bytes)
+{
+  for (unsigned int i = 0; i < bytes; i++)
+  {
+    out.put(static_cast<char>((value >> (i * 8)) & 0xFF));
+  }
+}
+
+static bool readUint(const std::vector<unsigned char> &data, std::size_t &offset, unsigned int bytes, unsigned long long &value)
+{
+  if (offset + bytes > data.size())
+  {
+    return false;
+  }
+  value = 0;
+  for (unsigned int i = 0; i < bytes; i++)
+  {
+    value |= static_cast<unsigned long long>(data[offset + i]) << (i * 8);
+  }
+  offset += bytes;
+  return true;
+}
+
+// float 값을 bit 패턴 그대로 정수로 변환 (delta time 을 오차 없이 기록하기 위해 텍스트가 아닌 bit 패턴으로 저장)
+static unsigned int floatBits(float value)
+{
+  unsigned int bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+static float bitsFloat(unsigned int bits)
+{
+  float value;
+  std::memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+ReplayRecorder::ReplayRecorder() : tickCount(0) {};
+
+ReplayRecorder::~ReplayRecorder()
+{
+  // Close() 없이 소멸되는 경우에도 기록된 tick 까지는 재생할 수 있도록 버퍼를 비움 (footer 는 기록되지 않음)
+  if (this->file.is_open())
+  {
+    this->file.flush();
+  }
+};
+
+bool ReplayRecorder::Open(const std::string &path, unsigned int seed, unsigned int width, unsigned int height)
+{
+  this->file.open(path.c_str(), std::ios::binary | std::ios::trunc);
+  if (!this->file)
+  {
+    std::cout << "ERROR::REPLAY: Failed to create replay file " << path << std::endl;
+    return false;
+  }
+
+  this->file.write(REPLAY_MAGIC, sizeof(REPLAY_MAGIC));
+  writeUint(this->file, REPLAY_VERSION, 2);
+  writeUint(this->file, seed, 4);
+  writeUint(this->file, width, 2);
+  writeUint(this->file, height, 2);
+  this->pending.clear();
+  this->tickCount = 0;
+  return true;
+};
+
+void ReplayRecorder::RecordKey(int key, bool pressed)
+{
+  if (!this->file.is_open() || key < 0 || key >= 1024)
+  {
+    return;
+  }
+  this->pending.push_back(ReplayKeyEvent(static_cast<unsigned short>(key), pressed));
+};
+
+void ReplayRecorder::EndTick(float dt)
+{
+  if (!this->file.is_open())
+  {
+    return;
+  }
+
+  // 한 tick 에 MAX_EVENTS_PER_TICK 개를 넘는 키 이벤트는 현실적으로 발생하지 않으므로 초과분은 버림
+  if (this->pending.size() > MAX_EVENTS_PER_TICK)
+  {
+    std::cout << "WARNING::REPLAY: Dropped " << this->pending.size() - MAX_EVENTS_PER_TICK << " key events in tick " << this->tickCount << std::endl;
+    this->pending.resize(MAX_EVENTS_PER_TICK);
+  }
+
+  writeUint(this->file, this->pending.size(), 1);
+  writeUint(this->file, floatBits(dt), 4);
+  for (const ReplayKeyEvent &event : this->pending)
+  {
+    writeUint(this->file, event.Key | (event.Pressed ? 0x8000u : 0u), 2);
+  }
+  this->pending.clear();
+  this->tickCount++;
+};
+
+void ReplayRecorder::Close(unsigned long long finalHash)
+{
+  if (!this->file.is_open())
+  {
+    return;
+  }
+
+  writeUint(this->file, REPLAY_END_MARKER, 1);
+  writeUint(this->file, this->tickCount, 4);
+  writeUint(this->file, finalHash, 8);
+  this->file.close();
+};
+
+ReplayPlayer::ReplayPlayer() : seed(0), width(0), height(0), expectedHash(0), hasExpectedHash(false), next(0) {};
+
+bool ReplayPlayer::Load(const std::string &path)
+{
+  std::ifstream file(path.c_str(), std::ios::binary);
+  if (!file)
+  {
+    std::cout << "ERROR::REPLAY: Failed to open replay file " << path << std::endl;
+    return false;
+  }
+  std::vector<unsigned char> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+  // header 검사
+  std::size_t offset = sizeof(REPLAY_MAGIC);
+  unsigned long long version = 0, seed = 0, width = 0, height = 0;
+  if (data.size() < sizeof(REPLAY_MAGIC) || std::memcmp(data.data(), REPLAY_MAGIC, sizeof(REPLAY_MAGIC)) != 0 ||
+      !readUint(data, offset, 2, version) || !readUint(data, offset, 4, seed) ||
+      !readUint(data, offset, 2, width) || !readUint(data, offset, 2, height))
+  {
+    std::cout << "ERROR::REPLAY: Invalid replay header in " << path << std::endl;
+    return false;
+  }
+  if (version != REPLAY_VERSION)
+  {
+    std::cout << "ERROR::REPLAY: Unsupported replay version " << version << " in " << path << std::endl;
+    return false;
+  }
+  this->seed = static_cast<unsigned int>(seed);
+  this->width = static_cast<unsigned int>(width);
+  this->height = static_cast<unsigned int>(height);
+
+  // tick 파싱 (footer 를 만나거나 파일 끝에 도달할 때까지)
+  this->ticks.clear();
+  this->events.clear();
+  this->hasExpectedHash = false;
+  unsigned long long count = 0;
+  while (readUint(data, offset, 1, count))
+  {
+    if (count == REPLAY_END_MARKER)
+    {
+      unsigned long long tickCount = 0, hash = 0;
+      if (!readUint(data, offset, 4, tickCount) || !readUint(data, offset, 8, hash) || tickCount != this->ticks.size())
+      {
+        std::cout << "ERROR::REPLAY: Corrupted replay footer in " << path << std::endl;
+        return false;
+      }
+      this->expectedHash = hash;
+      this->hasExpectedHash = true;
+      break;
+    }
+
+    Tick tick;
+    unsigned long long dtBits = 0;
+    if (!readUint(data, offset, 4, dtBits))
+    {
+      // 기록 도중 비정상 종료되어 잘린 tick 은 버림
+      break;
+    }
+    tick.Dt = bitsFloat(static_cast<unsigned int>(dtBits));
+    tick.FirstEvent = static_cast<unsigned int>(this->events.size());
+    tick.EventCount = static_cast<unsigned int>(count);
+
+    bool truncated = false;
+    for (unsigned long long i = 0; i < count; i++)
+    {
+      unsigned long long event = 0;
+      if (!readUint(data, offset, 2, event))
+      {
+        truncated = true;
+        break;
+      }
+      this->events.push_back(ReplayKeyEvent(static_cast<unsigned short>(event & 0x7FFF), (event & 0x8000) != 0));
+    }
+    if (truncated)
+    {
+      this->events.resize(tick.FirstEvent);
+      break;
+    }
+    this->ticks.push_back(tick);
+  }
+
+  if (!this->hasExpectedHash)
+  {
+    std::cout << "WARNING::REPLAY: " << path << " has no footer (recording was interrupted), final state hash will not be verified" << std::endl;
+  }
+
+  this->next = 0;
+  this->tickTimes.clear();
+  this->tickTimes.reserve(this->ticks.size());
+  return true;
+};
+
+bool ReplayPlayer::NextTick(float &dt, std::vector<ReplayKeyEvent> &events)
+{
+  if (this->next >= this->ticks.size())
+  {
+    return false;
+  }
+
+  const Tick &tick = this->ticks[this->next++];
+  dt = tick.Dt;
+  events.assign(this->events.begin() + tick.FirstEvent, this->events.begin() + tick.FirstEvent + tick.EventCount);
+  return true;
+};
+
+void ReplayPlayer::RecordTickTime(float ms)
+{
+  this->tickTimes.push_back(ms);
+};
+
+bool ReplayPlayer::Report(std::ostream &out, unsigned long long finalHash) const
+{
+  out << "REPLAY: " << this->next << "/" << this->ticks.size() << " ticks";
+  if (!this->tickTimes.empty())
+  {
+    std::vector<float> sorted(this->tickTimes);
+    std::sort(sorted.begin(), sorted.end());
+    float total = 0.0f;
+    for (float ms : sorted)
+    {
+      total += ms;
+    }
+
+    out << std::fixed << std::setprecision(3)
+        << " in " << total << "ms (" << (total > 0.0f ? sorted.size() * 1000.0f / total : 0.0f) << " ticks/s)"
+        << " | tick mean " << total / sorted.size() << "ms"
+        << " p50 " << sorted[(sorted.size() - 1) / 2] << "ms"
+        << " p99 " << sorted[static_cast<std::size_t>((sorted.size() - 1) * 0.99f)] << "ms"
+        << " max " << sorted.back() << "ms" << std::defaultfloat;
+  }
+  out << std::endl;
+
+  out << "REPLAY: final state hash 0x" << std::hex << std::setw(16) << std::setfill('0') << finalHash;
+  bool match = true;
+  if (this->hasExpectedHash)
+  {
+    match = finalHash == this->expectedHash && this->next == this->ticks.size();
+    if (match)
+    {
+      out << " (match)";
+    }
+    else
+    {
+      out << " (MISMATCH, recorded 0x" << std::setw(16) << this->expectedHash << ")";
+    }
+  }
+  out << std::dec << std::setfill(' ') << std::endl;
+  return match;
+};
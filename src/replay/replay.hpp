@@ -0,0 +1,107 @@
+#ifndef REPLAY_HPP
+#define REPLAY_HPP
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <ostream>
+
+/**
+ * 입력 기록(.brp) 파일 형식 (모든 정수는 little-endian)
+ *
+ * header : "BRPL" magic(4) | version(u16) | RNG seed(u32) | 화면 너비(u16) | 화면 높이(u16)
+ * tick   : 키 이벤트 개수(u8, 0 ~ 254) | delta time(f32 bit 패턴 u32) | 키 이벤트(u16) x 개수
+ *          -> 키 이벤트는 하위 15 bit 에 키 코드, 최상위 bit 에 press(1) / release(0) 를 기록함.
+ * footer : 종료 표시(u8 0xFF) | 기록한 tick 개수(u32) | 마지막 tick 직후의 게임 상태 hash(u64)
+ *
+ * 대부분의 tick 은 키 이벤트가 없으므로 tick 하나 당 5 byte 로 기록됨. (60fps 기준 초당 300 byte)
+ */
+
+// 한 tick 동안 발생한 키 입력 이벤트
+struct ReplayKeyEvent
+{
+  unsigned short Key; // GLFW 키 코드 (0 ~ 1023)
+  bool Pressed;       // press(true) 또는 release(false)
+
+  ReplayKeyEvent() : Key(0), Pressed(false) {};
+  ReplayKeyEvent(unsigned short key, bool pressed) : Key(key), Pressed(pressed) {};
+};
+
+/**
+ * ReplayRecorder 클래스
+ *
+ * 매 tick 의 키 입력 이벤트와 delta time 을 파일로 기록하는 클래스.
+ * -> 게임 시뮬레이션은 (RNG seed, 매 tick 의 키 입력, delta time) 만으로 결정되므로, 이 값들만 기록하면 같은 게임을 그대로 재현할 수 있음.
+ */
+class ReplayRecorder
+{
+public:
+  ReplayRecorder();
+  ~ReplayRecorder();
+
+  // 기록 파일 생성 및 header 기록
+  bool Open(const std::string &path, unsigned int seed, unsigned int width, unsigned int height);
+  bool IsOpen() const { return this->file.is_open(); };
+
+  // 현재 tick 에 키 입력 이벤트 추가 (GLFW 키 콜백함수에서 호출)
+  void RecordKey(int key, bool pressed);
+
+  // 누적된 키 입력 이벤트와 이번 tick 의 delta time 을 기록 (ProcessInput() 호출 직전에 호출)
+  void EndTick(float dt);
+
+  // footer(tick 개수, 최종 게임 상태 hash) 기록 후 파일 닫기
+  void Close(unsigned long long finalHash);
+
+private:
+  std::ofstream file;
+  std::vector<ReplayKeyEvent> pending; // 아직 기록되지 않은 현재 tick 의 키 입력 이벤트
+  unsigned int tickCount;
+};
+
+/**
+ * ReplayPlayer 클래스
+ *
+ * 기록 파일을 메모리에 로드한 뒤, tick 단위로 키 입력 이벤트와 delta time 을 돌려주는 클래스.
+ * -> 재생 중 측정한 tick 별 처리 시간으로 frame-time 통계를 계산하고, 최종 게임 상태 hash 를 기록 시점의 hash 와 비교함.
+ */
+class ReplayPlayer
+{
+public:
+  ReplayPlayer();
+
+  // 기록 파일 로드 (형식이 올바르지 않으면 에러 로그 출력 후 false 반환)
+  bool Load(const std::string &path);
+
+  unsigned int Seed() const { return this->seed; };
+  unsigned int Width() const { return this->width; };
+  unsigned int Height() const { return this->height; };
+  unsigned int TickCount() const { return static_cast<unsigned int>(this->ticks.size()); };
+
+  // 다음 tick 의 delta time 과 키 입력 이벤트 반환 (모든 tick 을 재생했다면 false 반환)
+  bool NextTick(float &dt, std::vector<ReplayKeyEvent> &events);
+
+  // 재생한 tick 하나의 처리 시간 기록 (ms)
+  void RecordTickTime(float ms);
+
+  // frame-time 통계 및 최종 게임 상태 hash 비교 결과 출력 (hash 가 일치하면 true 반환)
+  bool Report(std::ostream &out, unsigned long long finalHash) const;
+
+private:
+  // tick 별 delta time 및 키 입력 이벤트 범위 (이벤트는 events 컨테이너에 연속으로 저장)
+  struct Tick
+  {
+    float Dt;
+    unsigned int FirstEvent;
+    unsigned int EventCount;
+  };
+
+  unsigned int seed, width, height;
+  std::vector<Tick> ticks;
+  std::vector<ReplayKeyEvent> events;
+  unsigned long long expectedHash;
+  bool hasExpectedHash; // footer 가 없는 파일(기록 도중 비정상 종료)은 hash 비교를 생략함
+  std::size_t next;
+  std::vector<float> tickTimes;
+};
+
+#endif /* REPLAY_HPP */
@@ -0,0 +1,112 @@
+#include "gl_object.hpp"
+
+#ifndef NDEBUG
+#include <atomic>
+
+// 종류별 live 객체 카운터 (GL 객체는 보통 메인 스레드에서만 생성/반납하지만, 집계는 스레드 안전하게 처리)
+static std::atomic<int> liveCounts[GL_OBJECT_KIND_COUNT];
+#endif
+
+// 로그 출력 시 사용할 종류별 이름
+static const char *kindNames[GL_OBJECT_KIND_COUNT] = {
+    "textures", "buffers", "vertex_arrays", "framebuffers", "renderbuffers", "programs", "queries"};
+
+void GLObjectStats::OnCreate(GLObjectKind kind)
+{
+#ifndef NDEBUG
+  liveCounts[kind].fetch_add(1, std::memory_order_relaxed);
+#else
+  (void)kind;
+#endif
+};
+
+void GLObjectStats::OnDelete(GLObjectKind kind)
+{
+#ifndef NDEBUG
+  liveCounts[kind].fetch_sub(1, std::memory_order_relaxed);
+#else
+  (void)kind;
+#endif
+};
+
+int GLObjectStats::LiveCount(GLObjectKind kind)
+{
+#ifndef NDEBUG
+  return liveCounts[kind].load(std::memory_order_relaxed);
+#else
+  (void)kind;
+  return 0;
+#endif
+};
+
+void GLObjectStats::Report(std::ostream &out)
+{
+  out << "GL objects alive:";
+  for (int i = 0; i < GL_OBJECT_KIND_COUNT; i++)
+  {
+    out << " " << kindNames[i] << "=" << LiveCount(static_cast<GLObjectKind>(i));
+  }
+  out << std::endl;
+};
+
+unsigned int GenerateGLObject(GLObjectKind kind)
+{
+  unsigned int id = 0;
+  switch (kind)
+  {
+  case GL_OBJECT_TEXTURE:
+    glGenTextures(1, &id);
+    break;
+  case GL_OBJECT_BUFFER:
+    glGenBuffers(1, &id);
+    break;
+  case GL_OBJECT_VERTEX_ARRAY:
+    glGenVertexArrays(1, &id);
+    break;
+  case GL_OBJECT_FRAMEBUFFER:
+    glGenFramebuffers(1, &id);
+    break;
+  case GL_OBJECT_RENDERBUFFER:
+    glGenRenderbuffers(1, &id);
+    break;
+  case GL_OBJECT_PROGRAM:
+    id = glCreateProgram();
+    break;
+  case GL_OBJECT_QUERY:
+    glGenQueries(1, &id);
+    break;
+  default:
+    break;
+  }
+  return id;
+};
+
+void DeleteGLObject(GLObjectKind kind, unsigned int id)
+{
+  switch (kind)
+  {
+  case GL_OBJECT_TEXTURE:
+    glDeleteTextures(1, &id);
+    break;
+  case GL_OBJECT_BUFFER:
+    glDeleteBuffers(1, &id);
+    break;
+  case GL_OBJECT_VERTEX_ARRAY:
+    glDeleteVertexArrays(1, &id);
+    break;
+  case GL_OBJECT_FRAMEBUFFER:
+    glDeleteFramebuffers(1, &id);
+    break;
+  case GL_OBJECT_RENDERBUFFER:
+    glDeleteRenderbuffers(1, &id);
+    break;
+  case GL_OBJECT_PROGRAM:
+    glDeleteProgram(id);
+    break;
+  case GL_OBJECT_QUERY:
+    glDeleteQueries(1, &id);
+    break;
+  default:
+    break;
+  }
+};
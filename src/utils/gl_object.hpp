@@ -0,0 +1,142 @@
+#ifndef GL_OBJECT_HPP
+#define GL_OBJECT_HPP
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+
+#include <glad/glad.h>
+
+#include "../manager/gpu_memory_tracker.hpp"
+
+// RAII 래퍼가 관리하는 OpenGL 객체 종류를 enum 으로 정의
+enum GLObjectKind
+{
+  GL_OBJECT_TEXTURE,
+  GL_OBJECT_BUFFER,
+  GL_OBJECT_VERTEX_ARRAY,
+  GL_OBJECT_FRAMEBUFFER,
+  GL_OBJECT_RENDERBUFFER,
+  GL_OBJECT_PROGRAM,
+  GL_OBJECT_QUERY,
+  GL_OBJECT_KIND_COUNT
+};
+
+/**
+ * GLObjectStats 클래스
+ *
+ * 현재 살아있는(= 생성 후 아직 반납되지 않은) OpenGL 객체 개수를 종류별로 집계하는 debug 용 카운터.
+ * -> level reset 등을 반복해도 카운트가 일정하게 유지되는지 확인하여 GL name 누수를 검출하는 목적.
+ *
+ * NDEBUG 가 정의된 release 빌드에서는 집계하지 않으며, LiveCount() 는 항상 0 을 반환함.
+ */
+class GLObjectStats
+{
+public:
+  // 종류별 live 객체 카운트 증감 (GLObject 내부에서만 호출)
+  static void OnCreate(GLObjectKind kind);
+  static void OnDelete(GLObjectKind kind);
+
+  // 종류별 live 객체 개수 조회 및 로그 출력
+  static int LiveCount(GLObjectKind kind);
+  static void Report(std::ostream &out);
+
+private:
+  GLObjectStats() {};
+};
+
+// 종류별 OpenGL 객체 생성 및 반납 함수 (gl_object.cpp 에서 glGen* / glDelete* 로 분기)
+unsigned int GenerateGLObject(GLObjectKind kind);
+void DeleteGLObject(GLObjectKind kind, unsigned int id);
+
+/**
+ * GLObject 클래스 템플릿
+ *
+ * OpenGL 객체 name(ID) 하나를 단독으로 소유하는 move-only RAII 래퍼.
+ * -> 소멸 시점에 소유한 객체를 자동으로 반납하므로, 명시적인 glDelete* 호출 누락으로 인한 누수를 방지함.
+ * -> 복사를 금지하여 하나의 GL 객체를 여러 인스턴스가 공유한 채로 중복 반납하는 상황을 방지함.
+ *
+ * 기본 생성자는 GL 함수를 호출하지 않는 빈 상태(ID == 0)이므로, GL 컨텍스트 없이도 안전하게 생성 가능.
+ *
+ * 메모리를 할당한 이후 Track() 을 호출하면 GpuMemoryTracker 에 추정 크기가 등록되고,
+ * 객체가 반납될 때 등록도 함께 해제되므로 메모리 집계가 소유권과 항상 일치함.
+ */
+template <GLObjectKind Kind>
+class GLObject
+{
+public:
+  GLObject() : id(0), allocation(0) {};
+
+  // 외부에서 생성된 GL 객체(ex> glCreateProgram() 반환값)의 소유권을 넘겨받는 생성자
+  explicit GLObject(unsigned int adoptId) : id(adoptId), allocation(0)
+  {
+    if (this->id != 0)
+    {
+      GLObjectStats::OnCreate(Kind);
+    }
+  };
+
+  ~GLObject() { this->Reset(); };
+
+  // 새로운 GL 객체를 생성하여 소유하는 GLObject 반환
+  static GLObject Create() { return GLObject(GenerateGLObject(Kind)); };
+
+  // 복사 금지, 이동만 허용
+  GLObject(const GLObject &) = delete;
+  GLObject &operator=(const GLObject &) = delete;
+  GLObject(GLObject &&other) : id(other.id), allocation(other.allocation)
+  {
+    other.id = 0;
+    other.allocation = 0;
+  };
+  GLObject &operator=(GLObject &&other)
+  {
+    if (this != &other)
+    {
+      this->Reset();
+      this->id = other.id;
+      this->allocation = other.allocation;
+      other.id = 0;
+      other.allocation = 0;
+    }
+    return *this;
+  };
+
+  // 소유한 GL 객체 ID 반환 (소유권은 유지)
+  unsigned int Get() const { return this->id; };
+  explicit operator bool() const { return this->id != 0; };
+
+  // 소유한 GL 객체에 할당된 GPU 메모리 추정 크기 등록 (다시 호출하면 기존 등록을 교체 -> 재할당 시 사용)
+  void Track(GpuMemoryCategory category, std::size_t bytes, const std::string &label)
+  {
+    GpuMemoryTracker::Unregister(this->allocation);
+    this->allocation = GpuMemoryTracker::Register(category, bytes, label);
+  };
+
+  // 소유한 GL 객체를 반납하고 빈 상태로 전환
+  void Reset()
+  {
+    GpuMemoryTracker::Unregister(this->allocation);
+    this->allocation = 0;
+    if (this->id != 0)
+    {
+      DeleteGLObject(Kind, this->id);
+      GLObjectStats::OnDelete(Kind);
+      this->id = 0;
+    }
+  };
+
+private:
+  unsigned int id;
+  unsigned int allocation; // GpuMemoryTracker 등록 id (0 이면 미등록)
+};
+
+typedef GLObject<GL_OBJECT_TEXTURE> GLTexture;
+typedef GLObject<GL_OBJECT_BUFFER> GLBuffer;
+typedef GLObject<GL_OBJECT_VERTEX_ARRAY> GLVertexArray;
+typedef GLObject<GL_OBJECT_FRAMEBUFFER> GLFramebuffer;
+typedef GLObject<GL_OBJECT_RENDERBUFFER> GLRenderbuffer;
+typedef GLObject<GL_OBJECT_PROGRAM> GLProgram;
+typedef GLObject<GL_OBJECT_QUERY> GLQuery;
+
+#endif /* GL_OBJECT_HPP */
@@ -0,0 +1,63 @@
+#include "random.hpp"
+
+Random::Random()
+{
+  this->Seed(0, RANDOM_STREAM_GAMEPLAY);
+}
+
+Random::Random(unsigned long long seed, RandomStream stream)
+{
+  this->Seed(seed, stream);
+}
+
+void Random::Seed(unsigned long long seed, RandomStream stream)
+{
+  // PCG 기준 구현의 pcg32_srandom_r() 과 동일한 초기화 -> stream 번호로 증분값(홀수)을 정하고, seed 를 상태에 섞음
+  this->state = 0;
+  this->increment = (static_cast<unsigned long long>(stream) << 1u) | 1u;
+  this->Next();
+  this->state += seed;
+  this->Next();
+}
+
+unsigned int Random::NextBelow(unsigned int bound)
+{
+  // Lemire 의 곱셈 방식 -> 32bit 난수 x bound 의 상위 32bit 를 결과로 사용하고, 편향이 생기는 구간에 떨어진 경우에만 다시 뽑음
+  unsigned long long m = static_cast<unsigned long long>(this->Next()) * bound;
+  unsigned int low = static_cast<unsigned int>(m);
+  if (low < bound)
+  {
+    unsigned int threshold = (0u - bound) % bound;
+    while (low < threshold)
+    {
+      m = static_cast<unsigned long long>(this->Next()) * bound;
+      low = static_cast<unsigned int>(m);
+    }
+  }
+  return static_cast<unsigned int>(m >> 32);
+}
+
+void Random::FillFloat(float *out, std::size_t count)
+{
+  // 상태를 지역변수로 복사해서 루프를 도는 동안 메모리에 다시 쓰지 않도록 함
+  Random local = *this;
+  for (std::size_t i = 0; i < count; i++)
+  {
+    out[i] = local.NextFloat();
+  }
+  *this = local;
+}
+
+/**
+ * Next() % bound 의 modulo 편향
+ *
+ *
+ * 32bit 난수는 2^32 개의 값 중 하나를 균등하게 생성하는데,
+ * bound 가 2^32 의 약수가 아니라면 2^32 개의 값을 bound 개의 구간에 똑같이 나눠 담을 수 없음.
+ *
+ * ex> bound = 3 이면 2^32 = 3 * 1431655765 + 1 이므로,
+ * % 연산 결과 0 은 1431655766 번, 1 과 2 는 1431655765 번 나오게 되어 0 이 아주 조금 더 자주 나옴.
+ *
+ * bound 가 클수록 편향도 커지므로(std::rand() 처럼 RAND_MAX 가 32767 인 구현에서는 특히 심함),
+ * NextBelow() 는 편향이 생기는 (2^32 mod bound) 개의 값이 나온 경우에만 다시 뽑아서 모든 결과가 같은 확률이 되도록 함.
+ */
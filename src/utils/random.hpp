@@ -0,0 +1,64 @@
+#ifndef RANDOM_HPP
+#define RANDOM_HPP
+
+#include <cstddef>
+
+// 서로 독립적인 난수열(stream) 이름 -> 같은 seed 라도 stream 이 다르면 겹치지 않는 난수열을 생성함.
+enum RandomStream
+{
+  RANDOM_STREAM_GAMEPLAY,  // 게임 결과에 영향을 주는 난수 (PowerUp 생성 등) -> 입력 기록 재생 시 반드시 같은 난수열이어야 함
+  RANDOM_STREAM_PARTICLES, // particle respawn 위치/색상
+  RANDOM_STREAM_COSMETIC   // 그 밖에 게임 결과와 무관한 연출용 난수
+};
+
+/**
+ * Random 클래스
+ *
+ * PCG32 (XSH-RR, 64bit 상태 -> 32bit 출력) 난수 생성기.
+ * -> 상태가 16 byte 뿐이라 게임 인스턴스나 particle 생성기마다 하나씩 소유할 수 있고, 스레드 간 공유 상태가 없음.
+ * -> 정수 연산만 사용하므로 플랫폼, 컴파일러와 관계없이 같은 seed 에서 같은 난수열을 생성함. (std::rand 는 구현마다 다름)
+ * https://www.pcg-random.org 참고
+ */
+class Random
+{
+public:
+  Random();
+  Random(unsigned long long seed, RandomStream stream);
+
+  // seed 및 stream 지정
+  void Seed(unsigned long long seed, RandomStream stream);
+
+  // [0, 2^32) 범위 정수
+  unsigned int Next()
+  {
+    unsigned long long old = this->state;
+    this->state = old * 6364136223846793005ull + this->increment;
+    unsigned int xorshifted = static_cast<unsigned int>(((old >> 18u) ^ old) >> 27u);
+    unsigned int rot = static_cast<unsigned int>(old >> 59u);
+    return (xorshifted >> rot) | (xorshifted << ((0u - rot) & 31u));
+  };
+
+  // [0, bound) 범위의 편향 없는 정수 (Next() % bound 는 bound 가 2^32 의 약수가 아니면 작은 값이 더 자주 나옴 -> 하단 필기 참고)
+  unsigned int NextBelow(unsigned int bound);
+
+  // [0, 1) 범위 float (상위 24bit 사용 -> float 가수부로 정확히 표현되는 균등 분포)
+  float NextFloat() { return (this->Next() >> 8) * (1.0f / 16777216.0f); };
+
+  // [min, max) 범위 float
+  float NextRange(float min, float max) { return min + (max - min) * this->NextFloat(); };
+
+  // 1/chance 확률로 true 반환
+  bool OneIn(unsigned int chance) { return this->NextBelow(chance) == 0; };
+
+  // [0, 1) 범위 float 를 count 개 연속으로 기록 (particle respawn 등 한 번에 여러 개의 난수가 필요한 경우)
+  void FillFloat(float *out, std::size_t count);
+
+  // 현재 상태 (게임 상태 hash 계산용)
+  unsigned long long State() const { return this->state; };
+
+private:
+  unsigned long long state;
+  unsigned long long increment; // stream 선택값 (항상 홀수)
+};
+
+#endif /* RANDOM_HPP */
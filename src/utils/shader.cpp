@@ -161,6 +161,18 @@ void Shader::SetMat4(const char *name, const glm::mat4 &mat, bool useShader)
   glUniformMatrix4fv(glGetUniformLocation(this->ID, name), 1, GL_FALSE, &mat[0][0]);
 };
 
+void Shader::BindUniformBlock(const char *name, unsigned int binding)
+{
+  // GLSL 330 에서는 쉐이더 안에서 layout(binding = N) 으로 지정할 수 없으므로, 링킹 후 block index 를 조회해서 연결함
+  unsigned int index = glGetUniformBlockIndex(this->ID, name);
+  if (index == GL_INVALID_INDEX)
+  {
+    std::cout << "WARNING::SHADER: Uniform block '" << name << "' not found" << std::endl;
+    return;
+  }
+  glUniformBlockBinding(this->ID, index, binding);
+};
+
 void Shader::checkCompileErrors(unsigned int shader, std::string type)
 {
   int success;
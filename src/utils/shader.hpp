@@ -28,7 +28,7 @@
 class Shader
 {
 public:
-  unsigned int ID; // 생성된 ShaderProgram의 참조 ID
+  unsigned int ID; // 생성된 ShaderProgram의 참조 ID (소유하지 않음 -> 쉐이더 프로그램 반납은 ResourceManager 가 GLProgram 으로 관리)
 
   // Shader 클래스 생성자
   Shader() {};
@@ -53,6 +53,9 @@ public:
   void SetMat3(const char *name, const glm::mat3 &mat, bool useShader = false);
   void SetMat4(const char *name, const glm::mat4 &mat, bool useShader = false);
 
+  // 이름이 name 인 uniform block 을 uniform buffer binding point 에 연결 (쉐이더에 해당 block 이 없으면 경고 출력)
+  void BindUniformBlock(const char *name, unsigned int binding);
+
 private:
   // 쉐이더 객체 및 쉐이더 프로그램 객체의 컴파일 및 링킹 에러 대응
   void checkCompileErrors(unsigned int shader, std::string type);
@@ -1,29 +1,63 @@
 #include "texture.hpp"
+#include "texture_import.hpp"
 #include <iostream> // 콘솔 입출력을 위한 헤더
 
 Texture2D::Texture2D() : Width(0), Height(0), Internal_Format(GL_RGB), Image_Format(GL_RGB), Wrap_S(GL_REPEAT),
-                         Wrap_T(GL_REPEAT), Filter_Min(GL_LINEAR), Filter_Max(GL_LINEAR) // 텍스쳐 파라미터 멤버변수 초기화
+                         Wrap_T(GL_REPEAT), Filter_Min(GL_LINEAR), Filter_Max(GL_LINEAR), Mipmaps(false), MipLevels(1),
+                         PremultipliedAlpha(false) // 텍스쳐 파라미터 멤버변수 초기화
 {
-  // 텍스쳐 생성 후 ID 값 할당받기
-  glGenTextures(1, &this->ID);
+  this->Swizzle[0] = GL_RED;
+  this->Swizzle[1] = GL_GREEN;
+  this->Swizzle[2] = GL_BLUE;
+  this->Swizzle[3] = GL_ALPHA;
+
+  // 기본 생성자에서는 GL 객체를 생성하지 않음 -> 사용되지 않는 Texture2D 인스턴스가 GL name 을 점유하지 않도록 함.
 };
 
 // 생성된 텍스쳐 객체에 메모리 할당 및 이미지 데이터 write
-void Texture2D::Generate(unsigned int width, unsigned int height, unsigned char *data)
+void Texture2D::Generate(unsigned int width, unsigned int height, unsigned char *data, const char *label)
 {
   // 입력받은 텍스쳐 버퍼 크기로 변경
   this->Width = width;
   this->Height = height;
 
+  // 아직 텍스쳐 객체가 생성되지 않았다면 생성 후 ID 값 할당받기
+  if (!this->Object)
+  {
+    this->Object = GLTexture::Create();
+  }
+
   // 생성된 텍스쳐 바인딩 후 이미지 데이터 write
-  glBindTexture(GL_TEXTURE_2D, this->ID);
+  // (이미지 데이터는 각 줄 사이에 padding 없이 저장되어 있으므로, 줄 단위 정렬을 1 byte 로 지정 -> text_renderer.cpp 필기 참고)
+  glBindTexture(GL_TEXTURE_2D, this->Object.Get());
+  glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
   glTexImage2D(GL_TEXTURE_2D, 0, this->Internal_Format, this->Width, this->Height, 0, this->Image_Format, GL_UNSIGNED_BYTE, data);
 
+  // level 0 이미지로부터 나머지 mip level 들을 생성
+  // (mip chain 이 없는데 Filter_Min 이 *_MIPMAP_* 이면 텍스쳐가 incomplete 상태가 되므로, 이 경우 GL_LINEAR 로 대체)
+  if (this->Mipmaps)
+  {
+    glGenerateMipmap(GL_TEXTURE_2D);
+    this->MipLevels = CountMipLevels(this->Width, this->Height);
+  }
+  else
+  {
+    this->MipLevels = 1;
+    if (this->Filter_Min != GL_NEAREST && this->Filter_Min != GL_LINEAR)
+    {
+      this->Filter_Min = GL_LINEAR;
+    }
+  }
+
+  // 할당된 텍스쳐 메모리 추정 크기(mip chain 포함)를 GpuMemoryTracker 에 등록 (재할당 시 기존 등록 교체)
+  this->Object.Track(GPU_MEMORY_TEXTURE, GpuMemoryTracker::EstimateTextureBytes(this->Internal_Format, this->Width, this->Height, this->MipLevels), label);
+
   // 텍스쳐 파라미터 설정
   glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, this->Wrap_S);
   glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, this->Wrap_T);
   glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, this->Filter_Min);
   glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, this->Filter_Max);
+  glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, this->Swizzle);
 
   // 텍스쳐 바인딩 해제
   glBindTexture(GL_TEXTURE_2D, 0);
@@ -32,5 +66,5 @@ void Texture2D::Generate(unsigned int width, unsigned int height, unsigned char
 // 텍스쳐 객체 바인딩
 void Texture2D::Bind() const
 {
-  glBindTexture(GL_TEXTURE_2D, this->ID);
+  glBindTexture(GL_TEXTURE_2D, this->Object.Get());
 };
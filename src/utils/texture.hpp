@@ -3,11 +3,19 @@
 
 #include <glad/glad.h> // OpenGL 함수를 초기화하기 위한 헤더
 
+#include "gl_object.hpp"
+
+/**
+ * Texture2D 클래스
+ *
+ * 텍스쳐 객체를 단독으로 소유하는 move-only 클래스
+ * -> 복사가 불가능하므로, 게임 오브젝트 등에서는 Texture2D 를 복사하지 않고 TextureHandle 로 참조함.
+ */
 class Texture2D
 {
 public:
-  // 생성된 텍스쳐 객체 ID
-  unsigned int ID;
+  // 생성된 텍스쳐 객체 (소멸 시 자동 반납)
+  GLTexture Object;
 
   // 텍스쳐 버퍼 해상도
   unsigned int Width;
@@ -23,10 +31,25 @@ public:
   unsigned int Filter_Min;
   unsigned int Filter_Max;
 
+  // mip chain 생성 여부 및 생성된 mip level 개수 (level 0 포함, mip chain 이 없으면 1)
+  bool Mipmaps;
+  unsigned int MipLevels;
+
+  // 1, 2 채널 포맷(R8, RG8)을 샘플링할 때 RGBA 로 확장하기 위한 swizzle (기본값은 identity)
+  int Swizzle[4];
+
+  // color 값에 alpha 가 미리 곱해져 있는지 여부 -> SpriteRenderer 가 blend func 을 선택할 때 사용
+  bool PremultipliedAlpha;
+
+  // 기본 생성자는 GL 객체를 생성하지 않음 -> Generate() 최초 호출 시점에 텍스쳐 객체 생성
   Texture2D();
 
-  // 생성된 텍스쳐 객체에 메모리 할당 및 이미지 데이터 write
-  void Generate(unsigned int width, unsigned int height, unsigned char *data);
+  // 생성된 텍스쳐 객체 ID 반환
+  unsigned int ID() const { return this->Object.Get(); };
+
+  // 텍스쳐 객체 생성(최초 1회) 후 메모리 할당 및 이미지 데이터 write (Mipmaps 가 true 면 mip chain 까지 생성)
+  // -> label 은 GpuMemoryTracker 에 메모리 사용량을 등록할 때 표시할 이름
+  void Generate(unsigned int width, unsigned int height, unsigned char *data, const char *label = "texture");
 
   // 텍스쳐 객체 바인딩
   void Bind() const;
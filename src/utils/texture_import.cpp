@@ -0,0 +1,302 @@
+#include "texture_import.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+
+#include <glad/glad.h> // internal format 상수만 사용 (GL 함수는 호출하지 않음)
+
+TextureImage::TextureImage() : Width(0), Height(0), Channels(0), Internal_Format(GL_RGB), Image_Format(GL_RGB), Premultiplied(false)
+{
+  // 기본 swizzle 은 채널을 그대로 샘플링하는 identity
+  this->Swizzle[0] = GL_RED;
+  this->Swizzle[1] = GL_GREEN;
+  this->Swizzle[2] = GL_BLUE;
+  this->Swizzle[3] = GL_ALPHA;
+};
+
+int DetectChannels(const unsigned char *pixels, int width, int height, int channels)
+{
+  // alpha 채널이 없는 이미지(1, 3 채널)는 불투명한 것으로 간주
+  bool hasAlpha = channels == 2 || channels == 4;
+  bool opaque = true;
+  bool gray = true;
+
+  std::size_t count = static_cast<std::size_t>(width) * height;
+  for (std::size_t i = 0; i < count; i++)
+  {
+    const unsigned char *p = pixels + i * channels;
+    if (hasAlpha && p[channels - 1] != 255)
+    {
+      opaque = false;
+    }
+    if (channels >= 3 && (p[0] != p[1] || p[1] != p[2]))
+    {
+      gray = false;
+    }
+
+    // 더 이상 축약할 채널이 없다는 것이 확정되면 나머지 pixel 은 검사하지 않음
+    if (!gray && (!hasAlpha || !opaque))
+    {
+      break;
+    }
+  }
+
+  bool keepAlpha = hasAlpha && !opaque;
+  if (gray)
+  {
+    return keepAlpha ? 2 : 1;
+  }
+  return keepAlpha ? 4 : 3;
+}
+
+void ConvertChannels(std::vector<unsigned char> &pixels, int width, int height, int fromChannels, int toChannels)
+{
+  if (fromChannels == toChannels)
+  {
+    return;
+  }
+
+  // 축약 방향만 지원하므로, 원본 버퍼를 앞에서부터 덮어써도 아직 읽지 않은 pixel 을 훼손하지 않음 (in-place 변환)
+  bool fromAlpha = fromChannels == 2 || fromChannels == 4;
+  bool toAlpha = toChannels == 2 || toChannels == 4;
+  std::size_t count = static_cast<std::size_t>(width) * height;
+  for (std::size_t i = 0; i < count; i++)
+  {
+    const unsigned char *src = &pixels[i * fromChannels];
+    unsigned char r = src[0];
+    unsigned char g = fromChannels >= 3 ? src[1] : src[0];
+    unsigned char b = fromChannels >= 3 ? src[2] : src[0];
+    unsigned char a = fromAlpha ? src[fromChannels - 1] : 255;
+
+    unsigned char *dst = &pixels[i * toChannels];
+    if (toChannels <= 2)
+    {
+      dst[0] = r;
+    }
+    else
+    {
+      dst[0] = r;
+      dst[1] = g;
+      dst[2] = b;
+    }
+    if (toAlpha)
+    {
+      dst[toChannels - 1] = a;
+    }
+  }
+  pixels.resize(count * toChannels);
+}
+
+void PremultiplyAlpha(std::vector<unsigned char> &pixels, int width, int height, int channels)
+{
+  if (channels != 2 && channels != 4)
+  {
+    return;
+  }
+
+  std::size_t count = static_cast<std::size_t>(width) * height;
+  for (std::size_t i = 0; i < count; i++)
+  {
+    unsigned char *p = &pixels[i * channels];
+    unsigned int alpha = p[channels - 1];
+    for (int c = 0; c < channels - 1; c++)
+    {
+      // (x * a + 127) / 255 로 반올림하여 alpha == 255 인 pixel 은 값이 변하지 않도록 함.
+      p[c] = static_cast<unsigned char>((p[c] * alpha + 127) / 255);
+    }
+  }
+}
+
+void DownsampleHalf(std::vector<unsigned char> &pixels, int &width, int &height, int channels)
+{
+  int halfWidth = width > 1 ? width / 2 : 1;
+  int halfHeight = height > 1 ? height / 2 : 1;
+  std::vector<unsigned char> half(static_cast<std::size_t>(halfWidth) * halfHeight * channels);
+
+  for (int y = 0; y < halfHeight; y++)
+  {
+    // 원본 해상도가 홀수이거나 1px 인 경우를 대비해 샘플링 좌표를 원본 범위 내로 제한
+    int y0 = std::min(y * 2, height - 1);
+    int y1 = std::min(y * 2 + 1, height - 1);
+    for (int x = 0; x < halfWidth; x++)
+    {
+      int x0 = std::min(x * 2, width - 1);
+      int x1 = std::min(x * 2 + 1, width - 1);
+      for (int c = 0; c < channels; c++)
+      {
+        unsigned int sum = pixels[(y0 * width + x0) * channels + c] + pixels[(y0 * width + x1) * channels + c] +
+                           pixels[(y1 * width + x0) * channels + c] + pixels[(y1 * width + x1) * channels + c];
+        half[(y * halfWidth + x) * channels + c] = static_cast<unsigned char>((sum + 2) / 4);
+      }
+    }
+  }
+
+  pixels.swap(half);
+  width = halfWidth;
+  height = halfHeight;
+}
+
+void ResizeBox(std::vector<unsigned char> &pixels, int &width, int &height, int channels, int targetWidth, int targetHeight)
+{
+  targetWidth = std::max(1, std::min(targetWidth, width));
+  targetHeight = std::max(1, std::min(targetHeight, height));
+  if (targetWidth == width && targetHeight == height)
+  {
+    return;
+  }
+
+  std::vector<unsigned char> resized(static_cast<std::size_t>(targetWidth) * targetHeight * channels);
+  for (int y = 0; y < targetHeight; y++)
+  {
+    // 대상 pixel 하나가 덮는 원본 영역 [y0, y1) (축소이므로 항상 1px 이상)
+    int y0 = static_cast<int>(static_cast<long long>(y) * height / targetHeight);
+    int y1 = std::max(y0 + 1, static_cast<int>(static_cast<long long>(y + 1) * height / targetHeight));
+    for (int x = 0; x < targetWidth; x++)
+    {
+      int x0 = static_cast<int>(static_cast<long long>(x) * width / targetWidth);
+      int x1 = std::max(x0 + 1, static_cast<int>(static_cast<long long>(x + 1) * width / targetWidth));
+      unsigned int area = static_cast<unsigned int>((y1 - y0) * (x1 - x0));
+      for (int c = 0; c < channels; c++)
+      {
+        unsigned int sum = 0;
+        for (int sy = y0; sy < y1; sy++)
+        {
+          for (int sx = x0; sx < x1; sx++)
+          {
+            sum += pixels[(static_cast<std::size_t>(sy) * width + sx) * channels + c];
+          }
+        }
+        resized[(static_cast<std::size_t>(y) * targetWidth + x) * channels + c] = static_cast<unsigned char>((sum + area / 2) / area);
+      }
+    }
+  }
+
+  pixels.swap(resized);
+  width = targetWidth;
+  height = targetHeight;
+}
+
+// 8bit 값을 n bit 로 양자화했다가 다시 8bit 로 복원한 값 (GPU 가 compact 포맷으로 변환 후 샘플링할 때와 동일)
+static int quantize(int value, int bits)
+{
+  int levels = (1 << bits) - 1;
+  int q = (value * levels + 127) / 255;
+  return (q * 255 + levels / 2) / levels;
+}
+
+int QuantizationError(const unsigned char *pixels, int width, int height, int channels, const int bits[4])
+{
+  int maxError = 0;
+  std::size_t count = static_cast<std::size_t>(width) * height;
+  for (std::size_t i = 0; i < count; i++)
+  {
+    const unsigned char *p = pixels + i * channels;
+    for (int c = 0; c < channels; c++)
+    {
+      maxError = std::max(maxError, std::abs(quantize(p[c], bits[c]) - p[c]));
+    }
+  }
+  return maxError;
+}
+
+unsigned int CompactInternalFormat(int channels)
+{
+  switch (channels)
+  {
+  case 1:
+    return GL_R8;
+  case 2:
+    return GL_RG8;
+  case 3:
+    return GL_RGB565;
+  default:
+    return GL_RGBA4;
+  }
+}
+
+unsigned int CountMipLevels(unsigned int width, unsigned int height)
+{
+  unsigned int levels = 1;
+  unsigned int size = std::max(width, height);
+  while (size > 1)
+  {
+    size /= 2;
+    levels++;
+  }
+  return levels;
+}
+
+void ImportTexture(const unsigned char *data, int width, int height, int channels, const TextureImportOptions &options, TextureImage &image)
+{
+  image.Width = width;
+  image.Height = height;
+  image.Pixels.assign(data, data + static_cast<std::size_t>(width) * height * channels);
+
+  // 1단계: 호출자가 지정한 값이 아닌 실제 이미지 내용으로 채널 수 결정
+  image.Channels = DetectChannels(data, width, height, channels);
+  ConvertChannels(image.Pixels, width, height, channels, image.Channels);
+
+  // 2단계: 목표 해상도보다 큰 원본은 업로드 전에 축소 (메모리 및 샘플링 비용 절감)
+  int targetWidth = options.MaxWidth > 0 ? std::min(options.MaxWidth, image.Width) : image.Width;
+  int targetHeight = options.MaxHeight > 0 ? std::min(options.MaxHeight, image.Height) : image.Height;
+  ResizeBox(image.Pixels, image.Width, image.Height, image.Channels, targetWidth, targetHeight);
+
+  // 3단계: premultiply (양자화 오차 검사보다 먼저 수행해야 실제로 업로드될 값 기준으로 검사할 수 있음)
+  bool hasAlpha = image.Channels == 2 || image.Channels == 4;
+  image.Premultiplied = options.PremultiplyAlpha && hasAlpha;
+  if (image.Premultiplied)
+  {
+    PremultiplyAlpha(image.Pixels, image.Width, image.Height, image.Channels);
+  }
+
+  // 4단계: 채널 수에 대응하는 포맷 선택
+  const unsigned char *pixels = image.Pixels.data();
+  switch (image.Channels)
+  {
+  case 1:
+    // gray 이미지는 R 채널 하나만 저장하고, 샘플링 시 (r, r, r, 1) 로 확장 -> 항상 무손실이므로 CompactFormats 와 무관하게 사용
+    image.Internal_Format = GL_R8;
+    image.Image_Format = GL_RED;
+    image.Swizzle[0] = image.Swizzle[1] = image.Swizzle[2] = GL_RED;
+    image.Swizzle[3] = GL_ONE;
+    break;
+  case 2:
+    // gray + alpha 이미지는 (r, r, r, g) 로 확장
+    image.Internal_Format = GL_RG8;
+    image.Image_Format = GL_RG;
+    image.Swizzle[0] = image.Swizzle[1] = image.Swizzle[2] = GL_RED;
+    image.Swizzle[3] = GL_GREEN;
+    break;
+  case 3:
+  {
+    static const int rgb565[4] = {5, 6, 5, 0};
+    image.Internal_Format = GL_RGB;
+    image.Image_Format = GL_RGB;
+    if (options.CompactFormats && QuantizationError(pixels, image.Width, image.Height, 3, rgb565) <= options.MaxCompactError)
+    {
+      image.Internal_Format = GL_RGB565;
+    }
+    break;
+  }
+  default:
+  {
+    static const int rgba4[4] = {4, 4, 4, 4};
+    static const int rgb5a1[4] = {5, 5, 5, 1};
+    image.Internal_Format = GL_RGBA;
+    image.Image_Format = GL_RGBA;
+    if (options.CompactFormats)
+    {
+      // 둘 다 16bit 이므로, alpha 가 0 / 255 뿐인 이미지는 color 정밀도가 더 높은 RGB5_A1 을 우선 검사
+      if (QuantizationError(pixels, image.Width, image.Height, 4, rgb5a1) <= options.MaxCompactError)
+      {
+        image.Internal_Format = GL_RGB5_A1;
+      }
+      else if (QuantizationError(pixels, image.Width, image.Height, 4, rgba4) <= options.MaxCompactError)
+      {
+        image.Internal_Format = GL_RGBA4;
+      }
+    }
+    break;
+  }
+  }
+}
@@ -0,0 +1,79 @@
+#ifndef TEXTURE_IMPORT_HPP
+#define TEXTURE_IMPORT_HPP
+
+#include <vector>
+
+/**
+ * 텍스쳐 import 옵션
+ *
+ * ResourceManager::LoadTexture() 호출 시 텍스쳐마다 지정하는 CPU 측 전처리 옵션.
+ * -> 기본값은 mip chain 생성 + 손실이 거의 없는 경우에만 compact 포맷 사용.
+ */
+struct TextureImportOptions
+{
+  // mip chain 생성 여부 (축소되어 그려지는 sprite 의 aliasing 및 샘플링 대역폭 감소 목적)
+  bool GenerateMipmaps;
+  // color 값에 alpha 를 미리 곱해둘지 여부 -> 투명한 테두리가 mip 필터링 시 어둡게 번지는 현상 방지 (blend func 도 GL_ONE 으로 바뀜)
+  bool PremultiplyAlpha;
+  // RGB565 / RGBA4 / RGB5_A1 / R8 / RG8 등 compact internal format 사용 허용 여부
+  bool CompactFormats;
+  // compact 포맷 양자화 시 허용하는 채널당 최대 오차 (0 ~ 255 단위, 0 이면 완전 무손실인 경우에만 사용)
+  int MaxCompactError;
+  // 목표 해상도 (원본이 더 크면 축 별로 해당 크기까지 축소, 0 이면 제한 없음)
+  // -> sprite 는 어차피 그려지는 크기로 늘려서 그리므로 종횡비는 유지하지 않음.
+  int MaxWidth;
+  int MaxHeight;
+
+  TextureImportOptions()
+      : GenerateMipmaps(true), PremultiplyAlpha(false), CompactFormats(true), MaxCompactError(2), MaxWidth(0), MaxHeight(0) {};
+};
+
+/**
+ * import 파이프라인을 거친 CPU 측 이미지 데이터와 업로드 시 사용할 포맷 정보
+ */
+struct TextureImage
+{
+  std::vector<unsigned char> Pixels; // 줄 사이 padding 없이 저장된 pixel 데이터
+  int Width;
+  int Height;
+  int Channels; // 실제 내용 기준으로 검출된 채널 수 (1: gray, 2: gray + alpha, 3: RGB, 4: RGBA)
+
+  // glTexImage2D() 에 전달할 포맷 및 sampling 시 RGBA 로 확장하기 위한 swizzle
+  unsigned int Internal_Format;
+  unsigned int Image_Format;
+  int Swizzle[4];
+
+  bool Premultiplied;
+
+  TextureImage();
+};
+
+// 이미지 내용을 검사하여 실제로 필요한 채널 수 반환
+// -> 모든 alpha 가 255 이면 alpha 채널 제거, 모든 pixel 의 R == G == B 이면 gray 채널 하나로 축약
+int DetectChannels(const unsigned char *pixels, int width, int height, int channels);
+
+// 채널 수를 변환하여 pixel 데이터 재구성 (DetectChannels() 결과로 축약하는 방향만 사용)
+void ConvertChannels(std::vector<unsigned char> &pixels, int width, int height, int fromChannels, int toChannels);
+
+// color 채널에 alpha 를 미리 곱함 (alpha 채널이 있는 2, 4 채널 이미지에만 적용)
+void PremultiplyAlpha(std::vector<unsigned char> &pixels, int width, int height, int channels);
+
+// 2x2 pixel 평균(box filter)으로 가로, 세로 절반 해상도로 축소
+void DownsampleHalf(std::vector<unsigned char> &pixels, int &width, int &height, int channels);
+
+// 영역 평균(box filter)으로 임의의 해상도로 축소
+void ResizeBox(std::vector<unsigned char> &pixels, int &width, int &height, int channels, int targetWidth, int targetHeight);
+
+// 채널당 bits[c] 비트로 양자화했을 때의 최대 오차 계산 (0 ~ 255 단위)
+int QuantizationError(const unsigned char *pixels, int width, int height, int channels, const int bits[4]);
+
+// 예산 초과 등으로 강제로 포맷을 줄여야 할 때 채널 수에 대응하는 compact internal format 반환
+unsigned int CompactInternalFormat(int channels);
+
+// 해상도에 대응하는 전체 mip level 개수 계산 (level 0 포함)
+unsigned int CountMipLevels(unsigned int width, unsigned int height);
+
+// stb_image 로 로드한 원본 이미지를 옵션에 따라 전처리 (채널 검출 -> 축소 -> premultiply -> 포맷 선택 순)
+void ImportTexture(const unsigned char *data, int width, int height, int channels, const TextureImportOptions &options, TextureImage &image);
+
+#endif /* TEXTURE_IMPORT_HPP */
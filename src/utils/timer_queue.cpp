@@ -0,0 +1,176 @@
+#include "timer_queue.hpp"
+
+#include <algorithm>
+
+const unsigned int TIMER_INDEX_BITS = 24;
+const unsigned int TIMER_INDEX_MASK = (1u << TIMER_INDEX_BITS) - 1;
+
+TimerQueue::TimerQueue()
+    : now(0.0), nextOrder(0), pendingCount(0), highWater(0) {};
+
+TimerHandle TimerQueue::Schedule(float delay, unsigned int kind, unsigned int payload)
+{
+  unsigned int index;
+  if (!this->freeSlots.empty())
+  {
+    index = this->freeSlots.back();
+    this->freeSlots.pop_back();
+  }
+  else
+  {
+    index = static_cast<unsigned int>(this->slots.size());
+    Slot slot = {0.0, 0, 0, 0, 0, false};
+    this->slots.push_back(slot);
+  }
+
+  Slot &slot = this->slots[index];
+  slot.Deadline = this->now + delay;
+  slot.Kind = kind;
+  slot.Payload = payload;
+  slot.Active = true;
+  this->pendingCount++;
+  this->highWater = std::max(this->highWater, this->pendingCount);
+  this->push(index);
+  return (static_cast<unsigned int>(slot.Generation) << TIMER_INDEX_BITS) | index;
+}
+
+bool TimerQueue::Cancel(TimerHandle handle)
+{
+  if (this->find(handle) == nullptr)
+  {
+    return false;
+  }
+  // heap 에 남은 항목은 version 이 달라져서 꺼낼 때 버려짐
+  this->release(handle & TIMER_INDEX_MASK);
+  return true;
+}
+
+bool TimerQueue::Extend(TimerHandle handle, float extra)
+{
+  Slot *slot = this->find(handle);
+  if (slot == nullptr)
+  {
+    return false;
+  }
+  slot->Deadline += extra;
+  this->push(handle & TIMER_INDEX_MASK);
+  return true;
+}
+
+bool TimerQueue::Reschedule(TimerHandle handle, float delay)
+{
+  Slot *slot = this->find(handle);
+  if (slot == nullptr)
+  {
+    return false;
+  }
+  // 같은 tick 에 같은 지속시간으로 여러 번 재설정하면 만료 시각이 그대로이므로, heap 에 이미 있는 항목을 그대로 사용 (항목이 쌓여서 heap 이 늘어나지 않도록)
+  double deadline = this->now + delay;
+  if (deadline == slot->Deadline)
+  {
+    return true;
+  }
+  slot->Deadline = deadline;
+  this->push(handle & TIMER_INDEX_MASK);
+  return true;
+}
+
+bool TimerQueue::IsPending(TimerHandle handle) const
+{
+  return this->find(handle) != nullptr;
+}
+
+float TimerQueue::Remaining(TimerHandle handle) const
+{
+  const Slot *slot = this->find(handle);
+  return slot == nullptr ? 0.0f : static_cast<float>(std::max(0.0, slot->Deadline - this->now));
+}
+
+void TimerQueue::Advance(float dt, std::vector<TimerEvent> &out)
+{
+  this->now += dt;
+  while (!this->heap.empty() && this->heap.front().Deadline <= this->now)
+  {
+    std::pop_heap(this->heap.begin(), this->heap.end(), later);
+    Entry entry = this->heap.back();
+    this->heap.pop_back();
+
+    // 취소, 연장되어 더 이상 유효하지 않은 항목은 버림
+    const Slot &slot = this->slots[entry.Slot];
+    if (!slot.Active || slot.Version != entry.Version)
+    {
+      continue;
+    }
+    TimerEvent event = {slot.Kind, slot.Payload};
+    this->release(entry.Slot);
+    out.push_back(event);
+  }
+}
+
+void TimerQueue::Clear()
+{
+  this->now = 0.0;
+  this->nextOrder = 0;
+  this->pendingCount = 0;
+  this->heap.clear();
+  this->freeSlots.clear();
+  for (unsigned int i = 0; i < this->slots.size(); i++)
+  {
+    // slot 은 남겨두고 세대 번호만 올려서 이전 handle 무효화
+    if (this->slots[i].Active)
+    {
+      this->slots[i].Active = false;
+      this->slots[i].Generation++;
+    }
+    this->freeSlots.push_back(static_cast<unsigned int>(this->slots.size()) - 1 - i);
+  }
+}
+
+void TimerQueue::Reserve(unsigned int count)
+{
+  this->slots.reserve(count);
+  this->freeSlots.reserve(count);
+  // 연장, 재설정한 timer 는 이전 항목이 만료 시각까지 heap 에 남아있으므로 slot 개수의 2 배 확보
+  this->heap.reserve(count * 2);
+}
+
+// std::push_heap / pop_heap 은 max-heap 이므로, 만료 시각(같으면 예약 순서)이 더 늦은 항목을 '작은' 항목으로 비교
+bool TimerQueue::later(const Entry &a, const Entry &b)
+{
+  return a.Deadline != b.Deadline ? a.Deadline > b.Deadline : a.Order > b.Order;
+}
+
+TimerQueue::Slot *TimerQueue::find(TimerHandle handle)
+{
+  return const_cast<Slot *>(static_cast<const TimerQueue *>(this)->find(handle));
+}
+
+const TimerQueue::Slot *TimerQueue::find(TimerHandle handle) const
+{
+  unsigned int index = handle & TIMER_INDEX_MASK;
+  if (handle == NULL_TIMER || index >= this->slots.size())
+  {
+    return nullptr;
+  }
+  const Slot &slot = this->slots[index];
+  return slot.Active && slot.Generation == (handle >> TIMER_INDEX_BITS) ? &slot : nullptr;
+}
+
+void TimerQueue::push(unsigned int index)
+{
+  Slot &slot = this->slots[index];
+  slot.Version++;
+  Entry entry = {slot.Deadline, this->nextOrder++, index, slot.Version};
+  this->heap.push_back(entry);
+  std::push_heap(this->heap.begin(), this->heap.end(), later);
+}
+
+void TimerQueue::release(unsigned int index)
+{
+  Slot &slot = this->slots[index];
+  slot.Active = false;
+  slot.Version++;
+  slot.Generation++;
+  this->freeSlots.push_back(index);
+  this->pendingCount--;
+}
@@ -0,0 +1,109 @@
+#ifndef TIMER_QUEUE_HPP
+#define TIMER_QUEUE_HPP
+
+#include <vector>
+
+/**
+ * Timer handle
+ *
+ * 하위 24bit 는 timer slot index, 상위 8bit 는 해당 slot 의 세대 번호. (Entity ID 와 같은 구성)
+ * -> 만료되거나 취소된 timer 의 slot 을 재사용하더라도, 이전 handle 로는 새 timer 를 취소, 연장할 수 없음.
+ */
+typedef unsigned int TimerHandle;
+
+const TimerHandle NULL_TIMER = 0xFFFFFFFFu; // 어떤 timer 도 가리키지 않는 handle
+
+// 만료된 timer 정보 (예약 시 전달한 종류 및 대상 값)
+struct TimerEvent
+{
+  unsigned int Kind;    // 예약한 쪽에서 정의한 timer 종류
+  unsigned int Payload; // 예약한 쪽에서 정의한 대상 값 (ex> powerup entity)
+};
+
+/**
+ * TimerQueue 클래스
+ *
+ * 만료 시각 순서로 정렬된 min-heap 으로 timer 를 관리하는 클래스. (shake 효과, powerup 지속시간 등 시간제한이 있는 게임 상태)
+ * -> Advance() 는 heap 의 맨 앞에서 만료된 timer 만 꺼내므로, 매 프레임 비용은 전체 timer 개수가 아니라 만료되는 timer 개수에 비례함.
+ * -> 취소, 연장 시 heap 항목을 직접 찾아 지우지 않고 slot 의 version 만 바꿈. 이전 version 의 항목은 heap 에서 꺼낼 때 버려짐.
+ * -> 만료 시각이 같은 timer 들은 예약한 순서대로 만료됨. (같은 입력이면 항상 같은 순서로 처리되어 입력 기록 재생 결과가 달라지지 않음)
+ *
+ * 만료 시 함수를 직접 호출하는 대신 TimerEvent 를 돌려주고, 예약한 쪽(Game)이 종류별로 처리함.
+ * -> Game 인스턴스는 값으로 복사되므로(BatchEnv 의 episode reset), 특정 인스턴스를 가리키는 callback 을 저장하면 복사본에서 잘못된 인스턴스를 가리키게 됨.
+ */
+class TimerQueue
+{
+public:
+  TimerQueue();
+
+  // 현재 시각으로부터 delay 초 뒤에 만료되는 timer 예약 (delay <= 0 이면 다음 Advance() 에서 만료)
+  TimerHandle Schedule(float delay, unsigned int kind, unsigned int payload);
+
+  // 아직 만료되지 않은 timer 취소 (이미 만료되었거나 취소된 handle 이면 false 반환)
+  bool Cancel(TimerHandle handle);
+
+  // 만료 시각을 extra 초 뒤로 연장 / 현재 시각으로부터 delay 초 뒤로 재설정 (이미 만료되었거나 취소된 handle 이면 false 반환)
+  // -> Reschedule() 은 만료 시각이 바뀌지 않으면 heap 에 항목을 추가하지 않음 (같은 tick 에 여러 번 호출해도 항목은 하나)
+  bool Extend(TimerHandle handle, float extra);
+  bool Reschedule(TimerHandle handle, float delay);
+
+  // timer 가 아직 만료되지 않았는 지 여부 및 남은 시간 (만료되었다면 0.0f)
+  bool IsPending(TimerHandle handle) const;
+  float Remaining(TimerHandle handle) const;
+
+  // 시각을 dt 초 진행하고, 그 사이에 만료된 timer 들을 만료 시각 순서대로 out 에 추가
+  void Advance(float dt, std::vector<TimerEvent> &out);
+
+  // 모든 timer 제거 및 시각 초기화 (이전에 발급한 handle 은 모두 무효화됨)
+  void Clear();
+
+  // timer slot 및 heap 공간을 미리 확보 (동시에 예약된 timer 가 count 개 이하라면 예약, 연장 시 heap 할당이 일어나지 않음)
+  void Reserve(unsigned int count);
+
+  // 아직 만료되지 않은 timer 개수 및 지금까지 동시에 예약되었던 최대 timer 개수
+  unsigned int PendingCount() const { return this->pendingCount; };
+  unsigned int HighWater() const { return this->highWater; };
+
+private:
+  struct Slot
+  {
+    double Deadline;
+    unsigned int Kind, Payload;
+    unsigned int Version;     // 예약, 연장, 취소할 때마다 증가 -> heap 항목의 version 과 다르면 무효한 항목
+    unsigned char Generation; // slot 재사용 시 증가 -> handle 의 세대 번호와 다르면 무효한 handle
+    bool Active;
+  };
+
+  struct Entry
+  {
+    double Deadline;
+    unsigned long long Order; // 같은 만료 시각이면 먼저 예약(연장)한 timer 우선
+    unsigned int Slot;
+    unsigned int Version;
+  };
+
+  // float 로 시각을 누적하면 게임을 오래 진행할수록 dt 가 반올림되어 사라지므로 double 사용
+  double now;
+  unsigned long long nextOrder;
+  unsigned int pendingCount;
+  unsigned int highWater;
+
+  std::vector<Slot> slots;
+  std::vector<unsigned int> freeSlots;
+  std::vector<Entry> heap;
+
+  // heap 정렬 기준 (만료 시각이 더 늦은 항목이 뒤로)
+  static bool later(const Entry &a, const Entry &b);
+
+  // handle 이 가리키는 아직 만료되지 않은 timer slot (무효한 handle 이면 nullptr)
+  Slot *find(TimerHandle handle);
+  const Slot *find(TimerHandle handle) const;
+
+  // slot 의 현재 만료 시각으로 heap 항목 추가
+  void push(unsigned int index);
+
+  // slot 반납 (세대 번호를 올려서 이전 handle 무효화)
+  void release(unsigned int index);
+};
+
+#endif /* TIMER_QUEUE_HPP */
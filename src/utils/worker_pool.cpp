@@ -0,0 +1,85 @@
+#include "worker_pool.hpp"
+
+#include <algorithm>
+
+WorkerPool::WorkerPool(unsigned int threads)
+    : generation(0), remaining(0), stopping(false), pendingTask(nullptr)
+{
+  if (threads == 0)
+  {
+    threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+
+  // 호출한 스레드가 0 번 구간을 담당하므로 worker 는 (threads - 1) 개만 생성
+  for (unsigned int chunk = 1; chunk < threads; chunk++)
+  {
+    this->workers.push_back(std::thread(&WorkerPool::workerLoop, this, chunk));
+  }
+}
+
+WorkerPool::~WorkerPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->stopping = true;
+  }
+  this->startCondition.notify_all();
+  for (std::thread &worker : this->workers)
+  {
+    worker.join();
+  }
+}
+
+void WorkerPool::Run(const std::function<void(unsigned int)> &task)
+{
+  // worker 가 없으면 동기화 없이 바로 실행
+  if (this->workers.empty())
+  {
+    task(0);
+    return;
+  }
+
+  // worker 들에게 작업 시작을 알리고, 호출한 스레드는 0 번 구간을 직접 진행
+  {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->pendingTask = &task;
+    this->remaining = static_cast<unsigned int>(this->workers.size());
+    this->generation++;
+  }
+  this->startCondition.notify_all();
+
+  task(0);
+
+  // 모든 worker 가 담당 구간을 끝낼 때까지 대기
+  std::unique_lock<std::mutex> lock(this->mutex);
+  this->doneCondition.wait(lock, [this]()
+                           { return this->remaining == 0; });
+  this->pendingTask = nullptr;
+}
+
+void WorkerPool::workerLoop(unsigned int chunk)
+{
+  unsigned long long seen = 0;
+  std::unique_lock<std::mutex> lock(this->mutex);
+  while (true)
+  {
+    this->startCondition.wait(lock, [this, &seen]()
+                              { return this->stopping || this->generation != seen; });
+    if (this->stopping)
+    {
+      return;
+    }
+    seen = this->generation;
+    const std::function<void(unsigned int)> *task = this->pendingTask;
+
+    // 작업 진행 중에는 lock 을 풀어서 다른 worker 와 동시에 진행
+    lock.unlock();
+    (*task)(chunk);
+    lock.lock();
+
+    if (--this->remaining == 0)
+    {
+      this->doneCondition.notify_one();
+    }
+  }
+}
@@ -0,0 +1,48 @@
+#ifndef WORKER_POOL_HPP
+#define WORKER_POOL_HPP
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+/**
+ * WorkerPool 클래스
+ *
+ * 생성 시 만들어 둔 worker 스레드들에게 작업을 나누어 맡기는 고정 크기 스레드 pool.
+ * -> Run() 호출마다 스레드를 새로 만들지 않고, generation 을 증가시켜 대기 중인 worker 들을 깨움.
+ * -> Run() 을 호출한 스레드도 0 번 구간을 직접 담당하므로, worker 스레드는 (ThreadCount() - 1) 개만 생성함.
+ *
+ * Run() 은 한 번에 한 스레드에서만 호출해야 함. (worker 스레드 안에서 같은 pool 의 Run() 을 다시 호출하는 것도 불가)
+ */
+class WorkerPool
+{
+public:
+  // threads: 사용할 스레드 개수 (0 이면 하드웨어 스레드 개수)
+  explicit WorkerPool(unsigned int threads = 0);
+  ~WorkerPool();
+
+  // 0 ~ (ThreadCount() - 1) 번 구간을 스레드마다 하나씩 맡아 task(구간 번호) 실행 -> 모든 구간이 끝날 때까지 대기
+  void Run(const std::function<void(unsigned int)> &task);
+
+  unsigned int ThreadCount() const { return static_cast<unsigned int>(this->workers.size()) + 1; };
+
+private:
+  std::vector<std::thread> workers;
+  std::mutex mutex;
+  std::condition_variable startCondition, doneCondition;
+  unsigned long long generation;
+  unsigned int remaining; // 아직 작업을 끝내지 않은 worker 개수
+  bool stopping;
+  const std::function<void(unsigned int)> *pendingTask;
+
+  // worker 스레드 본문 (chunk 번 구간을 담당)
+  void workerLoop(unsigned int chunk);
+
+  // 복사 금지 (worker 스레드가 this 를 참조하므로)
+  WorkerPool(const WorkerPool &);
+  WorkerPool &operator=(const WorkerPool &);
+};
+
+#endif /* WORKER_POOL_HPP */